@@ -0,0 +1,3076 @@
+// King and pawn against king bitbase, written by main.exe --write-kpk kpk_bitbase.h (do not edit)
+// 2 bits per position in KPK_INDEX order, lowest bits first: 0 unknown, 1 draw, 2 win, 3 invalid
+static const unsigned char kpkBitbase[KPK_POSITIONS / 4] = {
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,221,170,89,169,89,165,89,149,
+89,85,89,85,122,171,106,165,106,149,106,85,106,85,106,85,234,173,106,149,106,85,106,85,106,85,106,85,170,183,170,85,
+170,85,170,85,170,85,170,85,170,222,170,85,170,85,170,85,170,85,170,85,170,122,170,86,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,121,170,221,169,89,165,89,149,
+89,85,89,85,234,169,122,167,106,149,106,85,106,85,106,85,106,167,234,157,106,85,106,85,106,85,106,85,170,157,170,119,
+170,85,170,85,170,85,170,85,170,118,170,221,170,85,170,85,170,85,170,85,170,218,170,118,170,86,170,86,170,86,170,86,
+170,170,171,170,93,170,85,169,85,165,85,165,170,170,93,170,119,169,85,165,85,149,85,149,170,170,122,169,221,165,85,149,
+85,85,85,85,170,170,234,165,122,151,90,85,85,85,85,85,170,170,106,151,234,93,106,85,90,85,86,85,170,170,170,93,
+170,119,170,85,106,85,90,85,170,170,170,117,170,221,170,85,170,85,106,85,170,170,170,214,170,118,170,86,170,86,170,85,
+170,170,170,170,167,170,93,169,85,165,85,165,170,170,170,170,93,169,119,165,85,149,85,149,170,170,170,170,118,165,221,149,
+85,85,85,85,170,170,170,170,218,149,118,87,85,85,85,85,170,170,170,170,106,87,218,93,86,85,86,85,170,170,170,170,
+170,93,106,119,90,85,90,85,170,170,170,170,170,117,170,221,106,85,106,85,170,170,170,170,170,214,170,118,170,85,170,85,
+170,170,170,170,170,170,87,169,93,165,85,165,170,170,170,170,170,170,93,165,119,149,85,149,170,170,170,170,170,170,117,149,
+221,85,85,85,170,170,170,170,170,170,214,85,117,87,85,85,170,170,170,170,170,170,90,87,214,93,86,85,170,170,170,170,
+170,170,106,93,90,119,90,85,170,170,170,170,170,170,170,117,106,221,106,85,170,170,170,170,170,170,170,214,170,117,170,85,
+170,170,170,170,170,170,170,170,87,165,93,165,170,170,170,170,170,170,170,170,93,149,119,149,170,170,170,170,170,170,170,170,
+117,85,221,85,170,170,170,170,170,170,170,170,213,85,117,87,170,170,170,170,170,170,170,170,86,87,214,93,170,170,170,170,
+170,170,170,170,90,93,90,119,170,170,170,170,170,170,170,170,106,117,106,221,170,170,170,170,170,170,170,170,170,213,170,117,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,122,171,106,165,106,149,106,85,106,85,106,85,234,173,170,149,170,85,170,85,170,85,170,85,170,183,170,85,
+170,85,170,85,170,85,170,85,170,222,170,86,170,86,170,86,170,86,170,86,170,122,170,86,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,234,169,122,167,106,149,106,85,106,85,106,85,170,167,234,157,170,85,170,85,170,85,170,85,170,157,170,119,
+170,85,170,85,170,85,170,85,170,118,170,222,170,86,170,86,170,86,170,86,170,218,170,118,170,86,170,86,170,86,170,86,
+170,170,171,170,173,170,165,170,149,170,85,170,170,170,174,170,119,169,85,165,85,149,85,149,170,170,122,169,222,165,85,149,
+85,85,85,85,170,170,234,165,122,151,90,85,85,85,85,85,170,170,170,151,234,93,106,85,90,85,86,85,170,170,170,93,
+170,119,170,85,106,85,90,85,170,170,170,118,170,222,170,86,170,85,106,85,170,170,170,214,170,118,170,86,170,86,170,85,
+170,170,170,170,167,170,157,170,85,170,85,170,170,170,170,170,157,170,119,165,85,149,85,149,170,170,170,170,118,165,221,149,
+85,85,85,85,170,170,170,170,218,149,118,87,85,85,85,85,170,170,170,170,106,87,218,93,86,85,86,85,170,170,170,170,
+170,93,106,119,90,85,90,85,170,170,170,170,170,118,170,221,106,85,106,85,170,170,170,170,170,214,170,118,170,85,170,85,
+170,170,170,170,170,170,151,170,93,170,85,170,170,170,170,170,170,170,93,165,119,149,85,149,170,170,170,170,170,170,117,149,
+221,85,85,85,170,170,170,170,170,170,214,85,117,87,85,85,170,170,170,170,170,170,90,87,214,93,86,85,170,170,170,170,
+170,170,106,93,90,119,90,85,170,170,170,170,170,170,170,117,106,221,106,85,170,170,170,170,170,170,170,214,170,117,170,85,
+170,170,170,170,170,170,170,170,87,170,93,170,170,170,170,170,170,170,170,170,93,149,119,149,170,170,170,170,170,170,170,170,
+117,85,221,85,170,170,170,170,170,170,170,170,213,85,117,87,170,170,170,170,170,170,170,170,86,87,214,93,170,170,170,170,
+170,170,170,170,90,93,90,119,170,170,170,170,170,170,170,170,106,117,106,221,170,170,170,170,170,170,170,170,170,213,170,117,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+173,170,169,170,169,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,234,173,170,149,170,85,170,85,170,85,170,85,170,183,170,86,
+170,86,170,86,170,86,170,86,170,222,170,86,170,86,170,86,170,86,170,86,170,122,170,90,170,90,170,90,170,90,170,90,
+171,170,173,170,169,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,167,234,157,170,85,170,85,170,85,170,85,170,158,170,119,
+170,86,170,86,170,86,170,86,170,118,170,222,170,86,170,86,170,86,170,86,170,218,170,122,170,90,170,90,170,90,170,90,
+170,170,171,170,173,170,165,170,149,170,85,170,170,170,173,170,183,170,149,170,85,170,85,169,170,170,186,170,221,165,85,149,
+85,85,85,85,170,170,234,165,122,151,90,85,85,85,85,85,170,170,170,151,234,93,106,85,90,85,86,85,170,170,170,94,
+170,119,170,85,106,85,90,85,170,170,170,118,170,222,170,86,170,85,106,85,170,170,170,218,170,122,170,90,170,86,170,85,
+170,170,170,170,167,170,157,170,85,170,85,170,170,170,170,170,157,170,119,170,85,169,85,169,170,170,170,170,118,170,221,149,
+85,85,85,85,170,170,170,170,218,149,118,87,85,85,85,85,170,170,170,170,106,87,218,93,86,85,86,85,170,170,170,170,
+170,93,106,119,90,85,90,85,170,170,170,170,170,118,170,221,106,85,106,85,170,170,170,170,170,218,170,118,170,85,170,85,
+170,170,170,170,170,170,151,170,93,170,85,170,170,170,170,170,170,170,93,170,119,169,85,169,170,170,170,170,170,170,117,149,
+221,85,85,85,170,170,170,170,170,170,214,85,117,87,85,85,170,170,170,170,170,170,90,87,214,93,86,85,170,170,170,170,
+170,170,106,93,90,119,90,85,170,170,170,170,170,170,170,117,106,221,106,85,170,170,170,170,170,170,170,214,170,117,170,85,
+170,170,170,170,170,170,170,170,87,170,93,170,170,170,170,170,170,170,170,170,93,169,119,169,170,170,170,170,170,170,170,170,
+117,85,221,85,170,170,170,170,170,170,170,170,213,85,117,87,170,170,170,170,170,170,170,170,86,87,214,93,170,170,170,170,
+170,170,170,170,90,93,90,119,170,170,170,170,170,170,170,170,106,117,106,221,170,170,170,170,170,170,170,170,170,213,170,117,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+173,170,165,170,169,170,169,170,169,170,169,170,183,170,165,170,165,170,165,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,183,170,86,
+170,86,170,86,170,86,170,86,170,222,170,90,170,90,170,90,170,90,170,90,170,122,170,90,170,90,170,90,170,90,170,90,
+171,170,173,170,169,170,169,170,169,170,169,170,173,170,183,170,165,170,165,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,158,170,119,
+170,86,170,86,170,86,170,86,170,122,170,222,170,90,170,90,170,90,170,90,170,218,170,122,170,90,170,90,170,90,170,90,
+170,170,171,170,173,170,165,170,149,170,85,170,170,170,173,170,183,170,149,170,85,170,85,169,170,170,181,170,221,170,85,170,
+85,169,85,165,170,170,234,170,117,151,85,85,85,85,85,85,170,170,170,151,234,93,106,85,90,85,86,85,170,170,170,94,
+170,119,170,85,106,85,90,85,170,170,170,122,170,222,170,86,170,85,106,85,170,170,170,218,170,122,170,90,170,86,170,85,
+170,170,170,170,167,170,157,170,85,170,85,170,170,170,170,170,157,170,119,170,85,169,85,169,170,170,170,170,117,170,221,169,
+85,165,85,165,170,170,170,170,218,169,117,87,85,85,85,85,170,170,170,170,106,87,218,93,86,85,86,85,170,170,170,170,
+170,93,106,119,90,85,90,85,170,170,170,170,170,118,170,221,106,85,106,85,170,170,170,170,170,218,170,118,170,85,170,85,
+170,170,170,170,170,170,151,170,93,170,85,170,170,170,170,170,170,170,93,170,119,169,85,169,170,170,170,170,170,170,117,169,
+221,165,85,165,170,170,170,170,170,170,213,85,117,87,85,85,170,170,170,170,170,170,90,87,214,93,86,85,170,170,170,170,
+170,170,106,93,90,119,90,85,170,170,170,170,170,170,170,117,106,221,106,85,170,170,170,170,170,170,170,214,170,117,170,85,
+170,170,170,170,170,170,170,170,87,170,93,170,170,170,170,170,170,170,170,170,93,169,119,169,170,170,170,170,170,170,170,170,
+117,165,221,165,170,170,170,170,170,170,170,170,213,85,117,87,170,170,170,170,170,170,170,170,86,87,214,93,170,170,170,170,
+170,170,170,170,90,93,90,119,170,170,170,170,170,170,170,170,106,117,106,221,170,170,170,170,170,170,170,170,170,213,170,117,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+173,170,165,170,165,170,165,170,165,170,165,170,183,170,165,170,165,170,165,170,165,170,165,170,222,170,149,170,149,170,149,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,222,170,90,170,90,170,90,170,90,170,90,170,122,170,90,170,106,170,106,170,106,170,106,
+167,170,173,170,165,170,165,170,165,170,165,170,173,170,183,170,165,170,165,170,165,170,165,170,182,170,221,170,149,170,149,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,122,170,222,170,90,170,90,170,90,170,90,170,234,170,122,170,106,170,106,170,106,170,106,
+170,170,167,170,173,170,165,170,149,170,85,170,170,170,173,170,183,170,149,170,85,170,85,169,170,170,181,170,221,170,85,170,
+85,169,85,165,170,170,214,170,117,171,85,169,85,165,85,149,170,170,170,171,214,93,85,85,85,85,85,85,170,170,170,94,
+170,119,170,85,106,85,90,85,170,170,170,122,170,222,170,86,170,85,106,85,170,170,170,234,170,122,170,90,170,86,170,85,
+170,170,170,170,167,170,157,170,85,170,85,170,170,170,170,170,157,170,119,170,85,169,85,169,170,170,170,170,117,170,221,169,
+85,165,85,165,170,170,170,170,213,169,117,167,85,149,85,149,170,170,170,170,106,167,213,93,85,85,85,85,170,170,170,170,
+170,93,106,119,90,85,90,85,170,170,170,170,170,118,170,221,106,85,106,85,170,170,170,170,170,218,170,118,170,85,170,85,
+170,170,170,170,170,170,151,170,93,170,85,170,170,170,170,170,170,170,93,170,119,169,85,169,170,170,170,170,170,170,117,169,
+221,165,85,165,170,170,170,170,170,170,213,165,117,151,85,149,170,170,170,170,170,170,85,87,213,93,85,85,170,170,170,170,
+170,170,106,93,90,119,90,85,170,170,170,170,170,170,170,117,106,221,106,85,170,170,170,170,170,170,170,214,170,117,170,85,
+170,170,170,170,170,170,170,170,87,170,93,170,170,170,170,170,170,170,170,170,93,169,119,169,170,170,170,170,170,170,170,170,
+117,165,221,165,170,170,170,170,170,170,170,170,213,149,117,151,170,170,170,170,170,170,170,170,85,87,213,93,170,170,170,170,
+170,170,170,170,90,93,90,119,170,170,170,170,170,170,170,170,106,117,106,221,170,170,170,170,170,170,170,170,170,213,170,117,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+173,170,165,170,165,170,165,170,165,170,165,170,183,170,149,170,149,170,149,170,149,170,149,170,222,170,149,170,149,170,149,170,
+149,170,149,170,122,171,86,170,85,170,85,170,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,122,170,106,170,106,170,106,170,106,170,106,
+167,170,173,170,165,170,165,170,165,170,165,170,157,170,183,170,149,170,149,170,149,170,149,170,182,170,221,170,149,170,149,170,
+149,170,149,170,218,170,118,171,85,170,85,170,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,234,170,122,170,106,170,106,170,106,170,106,
+170,170,167,170,173,170,165,170,149,170,85,170,170,170,157,170,183,170,149,170,85,170,85,169,170,170,181,170,221,170,85,170,
+85,169,85,165,170,170,214,170,117,171,85,169,85,165,85,149,170,170,90,171,214,173,85,165,85,85,85,85,170,170,170,174,
+90,119,86,85,85,85,85,85,170,170,170,122,170,222,170,86,170,85,106,85,170,170,170,234,170,122,170,90,170,86,170,85,
+170,170,170,170,167,170,157,170,85,170,85,170,170,170,170,170,157,170,119,170,85,169,85,169,170,170,170,170,117,170,221,169,
+85,165,85,165,170,170,170,170,213,169,117,167,85,149,85,149,170,170,170,170,86,167,213,157,85,85,85,85,170,170,170,170,
+170,157,86,119,85,85,85,85,170,170,170,170,170,118,170,221,106,85,106,85,170,170,170,170,170,218,170,118,170,85,170,85,
+170,170,170,170,170,170,151,170,93,170,85,170,170,170,170,170,170,170,93,170,119,169,85,169,170,170,170,170,170,170,117,169,
+221,165,85,165,170,170,170,170,170,170,213,165,117,151,85,149,170,170,170,170,170,170,85,151,213,93,85,85,170,170,170,170,
+170,170,86,93,85,119,85,85,170,170,170,170,170,170,170,117,106,221,106,85,170,170,170,170,170,170,170,214,170,117,170,85,
+170,170,170,170,170,170,170,170,87,170,93,170,170,170,170,170,170,170,170,170,93,169,119,169,170,170,170,170,170,170,170,170,
+117,165,221,165,170,170,170,170,170,170,170,170,213,149,117,151,170,170,170,170,170,170,170,170,85,87,213,93,170,170,170,170,
+170,170,170,170,85,93,85,119,170,170,170,170,170,170,170,170,106,117,106,221,170,170,170,170,170,170,170,170,170,213,170,117,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+173,170,149,170,149,170,149,170,149,170,149,170,183,170,149,170,149,170,149,170,149,170,149,170,222,170,85,170,85,170,85,170,
+85,170,85,170,122,171,86,170,85,170,85,170,85,170,85,170,234,173,90,169,86,169,85,169,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+167,170,157,170,149,170,149,170,149,170,149,170,157,170,183,170,149,170,149,170,149,170,149,170,118,170,221,170,85,170,85,170,
+85,170,85,170,218,170,118,171,85,170,85,170,85,170,85,170,106,171,218,173,86,169,85,169,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,151,170,157,170,149,170,149,170,85,170,170,170,157,170,183,170,149,170,85,170,85,169,170,170,117,170,221,170,85,170,
+85,169,85,165,170,170,214,170,117,171,85,169,85,165,85,149,170,170,90,171,214,173,85,165,85,85,85,85,170,170,106,173,
+90,183,86,85,85,85,85,85,170,170,170,186,106,221,90,85,86,85,86,85,170,170,170,234,170,122,170,90,170,86,170,85,
+170,170,170,170,151,170,157,170,85,170,85,170,170,170,170,170,157,170,119,170,85,169,85,169,170,170,170,170,117,170,221,169,
+85,165,85,165,170,170,170,170,213,169,117,167,85,149,85,149,170,170,170,170,86,167,213,157,85,85,85,85,170,170,170,170,
+90,157,86,119,85,85,85,85,170,170,170,170,170,118,90,221,86,85,86,85,170,170,170,170,170,218,170,118,170,85,170,85,
+170,170,170,170,170,170,151,170,93,170,85,170,170,170,170,170,170,170,93,170,119,169,85,169,170,170,170,170,170,170,117,169,
+221,165,85,165,170,170,170,170,170,170,213,165,117,151,85,149,170,170,170,170,170,170,85,151,213,93,85,85,170,170,170,170,
+170,170,86,93,85,119,85,85,170,170,170,170,170,170,90,117,86,221,86,85,170,170,170,170,170,170,170,214,170,117,170,85,
+170,170,170,170,170,170,170,170,87,170,93,170,170,170,170,170,170,170,170,170,93,169,119,169,170,170,170,170,170,170,170,170,
+117,165,221,165,170,170,170,170,170,170,170,170,213,149,117,151,170,170,170,170,170,170,170,170,85,87,213,93,170,170,170,170,
+170,170,170,170,85,93,85,119,170,170,170,170,170,170,170,170,86,117,86,221,170,170,170,170,170,170,170,170,170,213,170,117,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+173,170,149,170,149,170,149,170,149,170,149,170,183,170,85,170,85,170,85,170,85,170,85,170,222,170,85,170,85,170,85,170,
+85,170,85,170,122,171,86,169,85,169,85,169,85,169,85,169,234,173,90,169,86,169,85,169,85,169,85,169,170,119,106,101,
+90,101,86,101,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+167,170,157,170,149,170,149,170,149,170,149,170,157,170,119,170,85,170,85,170,85,170,85,170,118,170,221,170,85,170,85,170,
+85,170,85,170,218,169,118,171,85,169,85,169,85,169,85,169,106,171,218,173,86,169,85,169,85,169,85,169,170,109,106,119,
+90,101,86,101,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,151,170,157,170,149,170,149,170,85,170,170,170,93,170,119,170,85,170,85,170,85,169,170,170,117,170,221,170,85,170,
+85,169,85,165,170,170,214,169,117,171,85,169,85,165,85,149,170,170,90,171,214,173,85,165,85,85,85,85,170,170,106,173,
+90,119,86,85,85,85,85,85,170,170,170,117,106,221,90,85,86,85,86,85,170,170,170,234,170,117,106,85,90,85,90,85,
+170,170,170,170,151,170,157,170,85,170,85,170,170,170,170,170,93,170,119,170,85,169,85,169,170,170,170,170,117,170,221,169,
+85,165,85,165,170,170,170,170,213,169,117,167,85,149,85,149,170,170,170,170,86,167,213,157,85,85,85,85,170,170,170,170,
+90,157,86,119,85,85,85,85,170,170,170,170,106,117,90,221,86,85,86,85,170,170,170,170,170,218,106,117,90,85,90,85,
+170,170,170,170,170,170,151,170,93,170,85,170,170,170,170,170,170,170,93,170,119,169,85,169,170,170,170,170,170,170,117,169,
+221,165,85,165,170,170,170,170,170,170,213,165,117,151,85,149,170,170,170,170,170,170,85,151,213,93,85,85,170,170,170,170,
+170,170,86,93,85,119,85,85,170,170,170,170,170,170,90,117,86,221,86,85,170,170,170,170,170,170,106,213,90,117,90,85,
+170,170,170,170,170,170,170,170,87,170,93,170,170,170,170,170,170,170,170,170,93,169,119,169,170,170,170,170,170,170,170,170,
+117,165,221,165,170,170,170,170,170,170,170,170,213,149,117,151,170,170,170,170,170,170,170,170,85,87,213,93,170,170,170,170,
+170,170,170,170,85,93,85,119,170,170,170,170,170,170,170,170,86,117,86,221,170,170,170,170,170,170,170,170,90,213,90,117,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,239,170,89,169,105,165,105,149,
+169,85,169,86,123,171,106,165,106,149,106,85,170,85,170,86,235,173,106,149,106,85,106,85,170,85,170,86,171,183,170,85,
+170,85,170,85,170,85,170,86,171,222,170,85,170,85,170,85,170,85,170,86,171,122,170,86,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,123,170,221,169,89,165,89,149,
+89,85,89,85,235,169,122,167,106,149,106,85,106,85,106,85,107,167,234,157,106,85,106,85,106,85,106,85,171,157,170,119,
+170,85,170,85,170,85,170,85,171,118,170,221,170,85,170,85,170,85,170,85,171,218,170,118,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,171,170,122,169,221,165,89,149,
+89,85,89,85,171,170,234,165,122,151,106,85,106,85,106,85,171,170,106,151,234,93,106,85,106,85,106,85,171,170,170,93,
+170,119,170,85,170,85,170,85,171,170,170,117,170,221,170,85,170,85,170,85,171,170,170,214,170,118,170,86,170,86,170,86,
+171,170,170,170,171,170,93,169,85,165,85,165,171,170,170,170,94,169,119,165,85,149,85,149,171,170,170,170,122,165,221,149,
+85,85,85,85,171,170,170,170,234,149,122,87,90,85,86,85,171,170,170,170,106,87,234,93,106,85,90,85,171,170,170,170,
+170,93,170,119,170,85,106,85,171,170,170,170,170,117,170,221,170,85,170,85,171,170,170,170,170,214,170,118,170,86,170,86,
+171,170,170,170,170,170,167,170,93,165,85,165,171,170,170,170,170,170,93,165,119,149,85,149,171,170,170,170,170,170,118,149,
+221,85,85,85,171,170,170,170,170,170,218,85,118,87,86,85,171,170,170,170,170,170,106,87,218,93,90,85,171,170,170,170,
+170,170,170,93,106,119,106,85,171,170,170,170,170,170,170,117,170,221,170,85,171,170,170,170,170,170,170,214,170,118,170,86,
+171,170,170,170,170,170,170,170,87,165,93,165,171,170,170,170,170,170,170,170,93,149,119,149,171,170,170,170,170,170,170,170,
+117,85,221,85,171,170,170,170,170,170,170,170,214,85,118,87,171,170,170,170,170,170,170,170,90,87,218,93,171,170,170,170,
+170,170,170,170,106,93,106,119,171,170,170,170,170,170,170,170,170,117,170,221,171,170,170,170,170,170,170,170,170,214,170,118,
+171,170,170,170,170,170,170,170,170,170,171,170,171,170,170,170,170,170,170,170,170,170,174,170,171,170,170,170,170,170,170,170,
+170,170,186,170,171,170,170,170,170,170,170,170,170,170,234,170,171,170,170,170,170,170,170,170,170,170,170,171,171,170,170,170,
+170,170,170,170,170,170,170,174,171,170,170,170,170,170,170,170,170,170,170,186,171,170,170,170,170,170,170,170,170,170,170,234,
+171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,
+170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,
+170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,190,171,106,165,170,149,170,85,170,86,170,90,238,173,170,149,170,85,170,85,170,86,170,90,174,183,170,85,
+170,85,170,85,170,86,170,90,174,222,170,86,170,86,170,86,170,86,170,90,174,122,170,86,170,86,170,86,170,86,170,90,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,238,169,122,167,106,149,106,85,106,85,106,85,174,167,234,157,170,85,170,85,170,85,170,85,174,157,170,119,
+170,85,170,85,170,85,170,85,174,118,170,222,170,86,170,86,170,86,170,86,174,218,170,118,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,174,170,234,165,122,151,106,85,106,85,106,85,174,170,170,151,234,93,170,85,170,85,170,85,174,170,170,93,
+170,119,170,85,170,85,170,85,174,170,170,118,170,222,170,86,170,86,170,86,174,170,170,214,170,118,170,86,170,86,170,86,
+174,170,170,170,171,170,173,170,165,170,149,170,174,170,170,170,174,170,119,165,85,149,85,149,174,170,170,170,122,165,222,149,
+85,85,85,85,174,170,170,170,234,149,122,87,90,85,86,85,174,170,170,170,170,87,234,93,106,85,90,85,174,170,170,170,
+170,93,170,119,170,85,106,85,174,170,170,170,170,118,170,222,170,86,170,85,174,170,170,170,170,214,170,118,170,86,170,86,
+174,170,170,170,170,170,167,170,157,170,149,170,174,170,170,170,170,170,157,170,119,149,85,149,174,170,170,170,170,170,118,149,
+221,85,85,85,174,170,170,170,170,170,218,85,118,87,86,85,174,170,170,170,170,170,106,87,218,93,90,85,174,170,170,170,
+170,170,170,93,106,119,106,85,174,170,170,170,170,170,170,118,170,221,170,85,174,170,170,170,170,170,170,214,170,118,170,86,
+174,170,170,170,170,170,170,170,151,170,157,170,174,170,170,170,170,170,170,170,93,149,119,149,174,170,170,170,170,170,170,170,
+117,85,221,85,174,170,170,170,170,170,170,170,214,85,118,87,174,170,170,170,170,170,170,170,90,87,218,93,174,170,170,170,
+170,170,170,170,106,93,106,119,174,170,170,170,170,170,170,170,170,117,170,221,174,170,170,170,170,170,170,170,170,214,170,118,
+174,170,170,170,170,170,170,170,170,170,171,170,174,170,170,170,170,170,170,170,170,170,174,170,174,170,170,170,170,170,170,170,
+170,170,186,170,174,170,170,170,170,170,170,170,170,170,234,170,174,170,170,170,170,170,170,170,170,170,170,171,174,170,170,170,
+170,170,170,170,170,170,170,174,174,170,170,170,170,170,170,170,170,170,170,186,174,170,170,170,170,170,170,170,170,170,170,234,
+174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,
+170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,
+170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,
+189,170,169,170,169,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,250,174,170,149,170,86,170,86,170,90,170,106,186,183,170,86,
+170,86,170,86,170,90,170,106,186,222,170,86,170,86,170,86,170,90,170,106,186,122,170,90,170,90,170,90,170,90,170,106,
+187,170,173,170,169,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,186,167,234,157,170,85,170,85,170,85,170,85,186,158,170,119,
+170,86,170,86,170,86,170,86,186,118,170,222,170,86,170,86,170,86,170,86,186,218,170,122,170,90,170,90,170,90,170,90,
+186,170,171,170,173,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,186,170,170,151,234,93,170,85,170,85,170,85,186,170,170,94,
+170,119,170,86,170,86,170,86,186,170,170,118,170,222,170,86,170,86,170,86,186,170,170,218,170,122,170,90,170,90,170,90,
+186,170,170,170,171,170,173,170,165,170,149,170,186,170,170,170,173,170,183,170,149,170,85,170,186,170,170,170,186,170,221,149,
+85,85,85,85,186,170,170,170,234,149,122,87,90,85,86,85,186,170,170,170,170,87,234,93,106,85,90,85,186,170,170,170,
+170,94,170,119,170,85,106,85,186,170,170,170,170,118,170,222,170,86,170,85,186,170,170,170,170,218,170,122,170,90,170,86,
+186,170,170,170,170,170,167,170,157,170,149,170,186,170,170,170,170,170,157,170,119,170,85,170,186,170,170,170,170,170,118,170,
+221,85,85,85,186,170,170,170,170,170,218,85,118,87,86,85,186,170,170,170,170,170,106,87,218,93,90,85,186,170,170,170,
+170,170,170,93,106,119,106,85,186,170,170,170,170,170,170,118,170,221,170,85,186,170,170,170,170,170,170,218,170,118,170,86,
+186,170,170,170,170,170,170,170,151,170,157,170,186,170,170,170,170,170,170,170,93,170,119,170,186,170,170,170,170,170,170,170,
+117,85,221,85,186,170,170,170,170,170,170,170,214,85,118,87,186,170,170,170,170,170,170,170,90,87,218,93,186,170,170,170,
+170,170,170,170,106,93,106,119,186,170,170,170,170,170,170,170,170,117,170,221,186,170,170,170,170,170,170,170,170,214,170,118,
+186,170,170,170,170,170,170,170,170,170,171,170,186,170,170,170,170,170,170,170,170,170,174,170,186,170,170,170,170,170,170,170,
+170,170,186,170,186,170,170,170,170,170,170,170,170,170,234,170,186,170,170,170,170,170,170,170,170,170,170,171,186,170,170,170,
+170,170,170,170,170,170,170,174,186,170,170,170,170,170,170,170,170,170,170,186,186,170,170,170,170,170,170,170,170,170,170,234,
+186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,
+170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,
+170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,
+237,170,169,170,169,170,169,170,169,170,169,170,251,170,165,170,169,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,234,187,170,86,
+170,90,170,90,170,106,170,106,234,222,170,90,170,90,170,90,170,106,170,106,234,122,170,90,170,90,170,90,170,106,170,106,
+235,170,173,170,169,170,169,170,169,170,169,170,237,170,183,170,165,170,165,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,234,158,170,119,
+170,86,170,86,170,86,170,86,234,122,170,222,170,90,170,90,170,90,170,90,234,218,170,122,170,90,170,90,170,90,170,90,
+234,170,171,170,173,170,169,170,169,170,169,170,234,170,173,170,183,170,165,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,234,170,170,94,
+170,119,170,86,170,86,170,86,234,170,170,122,170,222,170,90,170,90,170,90,234,170,170,218,170,122,170,90,170,90,170,90,
+234,170,170,170,171,170,173,170,165,170,149,170,234,170,170,170,173,170,183,170,149,170,85,170,234,170,170,170,181,170,221,170,
+85,170,85,169,234,170,170,170,234,170,117,87,85,85,85,85,234,170,170,170,170,87,234,93,106,85,90,85,234,170,170,170,
+170,94,170,119,170,85,106,85,234,170,170,170,170,122,170,222,170,86,170,85,234,170,170,170,170,218,170,122,170,90,170,86,
+234,170,170,170,170,170,167,170,157,170,149,170,234,170,170,170,170,170,157,170,119,170,85,170,234,170,170,170,170,170,117,170,
+221,169,85,169,234,170,170,170,170,170,218,169,117,87,85,85,234,170,170,170,170,170,106,87,218,93,90,85,234,170,170,170,
+170,170,170,93,106,119,106,85,234,170,170,170,170,170,170,118,170,221,170,85,234,170,170,170,170,170,170,218,170,118,170,86,
+234,170,170,170,170,170,170,170,151,170,157,170,234,170,170,170,170,170,170,170,93,170,119,170,234,170,170,170,170,170,170,170,
+117,169,221,169,234,170,170,170,170,170,170,170,213,85,117,87,234,170,170,170,170,170,170,170,90,87,218,93,234,170,170,170,
+170,170,170,170,106,93,106,119,234,170,170,170,170,170,170,170,170,117,170,221,234,170,170,170,170,170,170,170,170,214,170,118,
+234,170,170,170,170,170,170,170,170,170,171,170,234,170,170,170,170,170,170,170,170,170,174,170,234,170,170,170,170,170,170,170,
+170,170,186,170,234,170,170,170,170,170,170,170,170,170,234,170,234,170,170,170,170,170,170,170,170,170,170,171,234,170,170,170,
+170,170,170,170,170,170,170,174,234,170,170,170,170,170,170,170,170,170,170,186,234,170,170,170,170,170,170,170,170,170,170,234,
+234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,
+170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,
+170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,
+173,171,165,170,165,170,165,170,169,170,169,170,183,171,165,170,165,170,165,170,169,170,169,170,238,171,149,170,165,170,165,170,
+169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,239,170,90,170,106,170,106,170,106,170,106,170,123,170,106,170,106,170,106,170,106,170,106,
+167,171,173,170,165,170,165,170,165,170,165,170,173,171,183,170,165,170,165,170,165,170,165,170,182,171,221,170,149,170,149,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,123,170,222,170,90,170,90,170,90,170,90,170,235,170,122,170,106,170,106,170,106,170,106,
+170,171,167,170,173,170,165,170,165,170,165,170,170,171,173,170,183,170,165,170,165,170,165,170,170,171,181,170,221,170,149,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,171,170,122,170,222,170,90,170,90,170,90,170,171,170,234,170,122,170,106,170,106,170,106,
+170,171,170,170,167,170,173,170,165,170,149,170,170,171,170,170,173,170,183,170,149,170,85,170,170,171,170,170,181,170,221,170,
+85,170,85,169,170,171,170,170,213,170,117,171,85,169,85,165,170,171,170,170,170,171,213,93,85,85,85,85,170,171,170,170,
+170,94,170,119,170,85,106,85,170,171,170,170,170,122,170,222,170,86,170,85,170,171,170,170,170,234,170,122,170,90,170,86,
+170,171,170,170,170,170,167,170,157,170,149,170,170,171,170,170,170,170,157,170,119,170,85,170,170,171,170,170,170,170,117,170,
+221,169,85,169,170,171,170,170,170,170,213,169,117,167,85,165,170,171,170,170,170,170,106,167,213,93,85,85,170,171,170,170,
+170,170,170,93,106,119,106,85,170,171,170,170,170,170,170,118,170,221,170,85,170,171,170,170,170,170,170,218,170,118,170,86,
+170,171,170,170,170,170,170,170,151,170,157,170,170,171,170,170,170,170,170,170,93,170,119,170,170,171,170,170,170,170,170,170,
+117,169,221,169,170,171,170,170,170,170,170,170,213,165,117,167,170,171,170,170,170,170,170,170,85,87,213,93,170,171,170,170,
+170,170,170,170,106,93,106,119,170,171,170,170,170,170,170,170,170,117,170,221,170,171,170,170,170,170,170,170,170,214,170,118,
+170,171,170,170,170,170,170,170,170,170,171,170,170,171,170,170,170,170,170,170,170,170,174,170,170,171,170,170,170,170,170,170,
+170,170,186,170,170,171,170,170,170,170,170,170,170,170,234,170,170,171,170,170,170,170,170,170,170,170,170,171,170,171,170,170,
+170,170,170,170,170,170,170,174,170,171,170,170,170,170,170,170,170,170,170,186,170,171,170,170,170,170,170,170,170,170,170,234,
+170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,
+170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,
+170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,
+173,174,165,170,165,170,165,170,165,170,169,170,183,174,149,170,149,170,149,170,165,170,169,170,222,174,149,170,149,170,149,170,
+165,170,169,170,186,175,86,170,149,170,149,170,165,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,126,170,106,170,106,170,106,170,106,170,106,
+167,174,173,170,165,170,165,170,165,170,165,170,157,174,183,170,149,170,149,170,149,170,149,170,182,174,221,170,149,170,149,170,
+149,170,149,170,218,174,118,171,85,170,85,170,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,238,170,122,170,106,170,106,170,106,170,106,
+170,174,167,170,173,170,165,170,165,170,165,170,170,174,157,170,183,170,149,170,149,170,149,170,170,174,181,170,221,170,149,170,
+149,170,149,170,170,174,214,170,117,171,85,170,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,174,170,234,170,122,170,106,170,106,170,106,
+170,174,170,170,167,170,173,170,165,170,149,170,170,174,170,170,157,170,183,170,149,170,85,170,170,174,170,170,181,170,221,170,
+85,170,85,169,170,174,170,170,213,170,117,171,85,169,85,165,170,174,170,170,86,171,213,173,85,165,85,149,170,174,170,170,
+170,174,86,119,85,85,85,85,170,174,170,170,170,122,170,222,170,86,170,85,170,174,170,170,170,234,170,122,170,90,170,86,
+170,174,170,170,170,170,167,170,157,170,149,170,170,174,170,170,170,170,157,170,119,170,85,170,170,174,170,170,170,170,117,170,
+221,169,85,169,170,174,170,170,170,170,213,169,117,167,85,165,170,174,170,170,170,170,85,167,213,157,85,149,170,174,170,170,
+170,170,170,157,85,119,85,85,170,174,170,170,170,170,170,118,170,221,170,85,170,174,170,170,170,170,170,218,170,118,170,86,
+170,174,170,170,170,170,170,170,151,170,157,170,170,174,170,170,170,170,170,170,93,170,119,170,170,174,170,170,170,170,170,170,
+117,169,221,169,170,174,170,170,170,170,170,170,213,165,117,167,170,174,170,170,170,170,170,170,85,151,213,157,170,174,170,170,
+170,170,170,170,85,93,85,119,170,174,170,170,170,170,170,170,170,117,170,221,170,174,170,170,170,170,170,170,170,214,170,118,
+170,174,170,170,170,170,170,170,170,170,171,170,170,174,170,170,170,170,170,170,170,170,174,170,170,174,170,170,170,170,170,170,
+170,170,186,170,170,174,170,170,170,170,170,170,170,170,234,170,170,174,170,170,170,170,170,170,170,170,170,171,170,174,170,170,
+170,170,170,170,170,170,170,174,170,174,170,170,170,170,170,170,170,170,170,186,170,174,170,170,170,170,170,170,170,170,170,234,
+170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,
+170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,
+170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,
+173,186,149,170,149,170,149,170,149,170,165,170,183,186,149,170,149,170,149,170,149,170,165,170,222,186,85,170,85,170,85,170,
+149,170,165,170,122,187,86,170,85,170,85,170,149,170,165,170,234,190,90,169,86,170,85,170,149,170,165,170,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+167,186,157,170,149,170,149,170,149,170,149,170,157,186,183,170,149,170,149,170,149,170,149,170,118,186,221,170,85,170,85,170,
+85,170,85,170,218,186,118,171,85,170,85,170,85,170,85,170,106,187,218,173,86,169,85,169,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,186,151,170,157,170,149,170,149,170,149,170,170,186,157,170,183,170,149,170,149,170,149,170,170,186,117,170,221,170,85,170,
+85,170,85,170,170,186,214,170,117,171,85,170,85,170,85,170,170,186,90,171,214,173,85,169,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,186,170,170,151,170,157,170,149,170,149,170,170,186,170,170,157,170,183,170,149,170,85,170,170,186,170,170,117,170,221,170,
+85,170,85,169,170,186,170,170,213,170,117,171,85,169,85,165,170,186,170,170,86,171,213,173,85,165,85,149,170,186,170,170,
+90,173,86,183,85,85,85,85,170,186,170,170,170,186,90,221,86,85,86,85,170,186,170,170,170,234,170,122,170,90,170,86,
+170,186,170,170,170,170,151,170,157,170,149,170,170,186,170,170,170,170,157,170,119,170,85,170,170,186,170,170,170,170,117,170,
+221,169,85,169,170,186,170,170,170,170,213,169,117,167,85,165,170,186,170,170,170,170,85,167,213,157,85,149,170,186,170,170,
+170,170,86,157,85,119,85,85,170,186,170,170,170,170,170,118,86,221,86,85,170,186,170,170,170,170,170,218,170,118,170,86,
+170,186,170,170,170,170,170,170,151,170,157,170,170,186,170,170,170,170,170,170,93,170,119,170,170,186,170,170,170,170,170,170,
+117,169,221,169,170,186,170,170,170,170,170,170,213,165,117,167,170,186,170,170,170,170,170,170,85,151,213,157,170,186,170,170,
+170,170,170,170,85,93,85,119,170,186,170,170,170,170,170,170,86,117,86,221,170,186,170,170,170,170,170,170,170,214,170,118,
+170,186,170,170,170,170,170,170,170,170,171,170,170,186,170,170,170,170,170,170,170,170,174,170,170,186,170,170,170,170,170,170,
+170,170,186,170,170,186,170,170,170,170,170,170,170,170,234,170,170,186,170,170,170,170,170,170,170,170,170,171,170,186,170,170,
+170,170,170,170,170,170,170,174,170,186,170,170,170,170,170,170,170,170,170,186,170,186,170,170,170,170,170,170,170,170,170,234,
+170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,
+170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,
+170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,
+173,234,149,170,149,170,149,170,149,170,149,170,183,234,85,170,85,170,85,170,85,170,149,170,222,234,85,170,85,170,85,170,
+85,170,149,170,122,235,86,169,85,169,85,169,85,170,149,170,234,237,90,169,86,169,85,169,85,170,149,170,170,251,106,101,
+90,105,86,105,85,106,149,106,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+167,234,157,170,149,170,149,170,149,170,149,170,157,234,119,170,85,170,85,170,85,170,85,170,118,234,221,170,85,170,85,170,
+85,170,85,170,218,233,118,171,85,169,85,169,85,169,85,169,106,235,218,173,86,169,85,169,85,169,85,169,170,237,106,119,
+90,101,86,101,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,234,151,170,157,170,149,170,149,170,149,170,170,234,93,170,119,170,85,170,85,170,85,170,170,234,117,170,221,170,85,170,
+85,170,85,170,170,234,214,169,117,171,85,169,85,169,85,169,170,234,90,171,214,173,85,169,85,169,85,169,170,234,106,173,
+90,119,86,101,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,234,170,170,151,170,157,170,149,170,149,170,170,234,170,170,93,170,119,170,85,170,85,170,170,234,170,170,117,170,221,170,
+85,170,85,169,170,234,170,170,213,169,117,171,85,169,85,165,170,234,170,170,86,171,213,173,85,165,85,149,170,234,170,170,
+90,173,86,119,85,85,85,85,170,234,170,170,106,181,90,221,86,85,86,85,170,234,170,170,170,234,106,117,90,85,90,85,
+170,234,170,170,170,170,151,170,157,170,149,170,170,234,170,170,170,170,93,170,119,170,85,170,170,234,170,170,170,170,117,170,
+221,169,85,169,170,234,170,170,170,170,213,169,117,167,85,165,170,234,170,170,170,170,85,167,213,157,85,149,170,234,170,170,
+170,170,86,157,85,119,85,85,170,234,170,170,170,170,90,117,86,221,86,85,170,234,170,170,170,170,170,218,90,117,90,85,
+170,234,170,170,170,170,170,170,151,170,157,170,170,234,170,170,170,170,170,170,93,170,119,170,170,234,170,170,170,170,170,170,
+117,169,221,169,170,234,170,170,170,170,170,170,213,165,117,167,170,234,170,170,170,170,170,170,85,151,213,157,170,234,170,170,
+170,170,170,170,85,93,85,119,170,234,170,170,170,170,170,170,86,117,86,221,170,234,170,170,170,170,170,170,90,213,90,117,
+170,234,170,170,170,170,170,170,170,170,171,170,170,234,170,170,170,170,170,170,170,170,174,170,170,234,170,170,170,170,170,170,
+170,170,186,170,170,234,170,170,170,170,170,170,170,170,234,170,170,234,170,170,170,170,170,170,170,170,170,171,170,234,170,170,
+170,170,170,170,170,170,170,174,170,234,170,170,170,170,170,170,170,170,170,186,170,234,170,170,170,170,170,170,170,170,170,234,
+170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,
+170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,
+170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,
+173,170,167,170,169,170,169,170,169,170,169,170,183,170,171,170,169,170,169,170,169,170,169,170,238,170,91,169,105,165,105,149,
+169,85,169,86,122,171,107,165,106,149,106,85,170,85,170,86,234,173,107,149,106,85,106,85,170,85,170,86,170,183,171,85,
+170,85,170,85,170,85,170,86,170,222,171,85,170,85,170,85,170,85,170,86,170,122,171,86,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,122,170,223,169,89,165,89,149,
+105,85,169,85,234,169,123,167,106,149,106,85,106,85,170,85,106,167,235,157,106,85,106,85,106,85,170,85,170,157,171,119,
+170,85,170,85,170,85,170,85,170,118,171,221,170,85,170,85,170,85,170,85,170,218,171,118,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,123,169,221,165,89,149,
+89,85,89,85,170,170,235,165,122,151,106,85,106,85,106,85,170,170,107,151,234,93,106,85,106,85,106,85,170,170,171,93,
+170,119,170,85,170,85,170,85,170,170,171,117,170,221,170,85,170,85,170,85,170,170,171,214,170,118,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,171,170,122,165,221,149,
+89,85,89,85,170,170,171,170,234,149,122,87,106,85,106,85,170,170,171,170,106,87,234,93,106,85,106,85,170,170,171,170,
+170,93,170,119,170,85,170,85,170,170,171,170,170,117,170,221,170,85,170,85,170,170,171,170,170,214,170,118,170,86,170,86,
+170,170,171,170,170,170,171,170,93,165,85,165,170,170,171,170,170,170,94,165,119,149,85,149,170,170,171,170,170,170,122,149,
+221,85,85,85,170,170,171,170,170,170,234,85,122,87,90,85,170,170,171,170,170,170,106,87,234,93,106,85,170,170,171,170,
+170,170,170,93,170,119,170,85,170,170,171,170,170,170,170,117,170,221,170,85,170,170,171,170,170,170,170,214,170,118,170,86,
+170,170,171,170,170,170,170,170,167,170,173,170,170,170,171,170,170,170,170,170,93,149,183,170,170,170,171,170,170,170,170,170,
+118,85,222,85,170,170,171,170,170,170,170,170,218,85,122,87,170,170,171,170,170,170,170,170,106,87,234,93,170,170,171,170,
+170,170,170,170,170,93,170,119,170,170,171,170,170,170,170,170,170,117,170,221,170,170,171,170,170,170,170,170,170,214,170,118,
+170,170,171,170,170,170,170,170,170,170,171,170,170,170,171,170,170,170,170,170,170,170,174,170,170,170,171,170,170,170,170,170,
+170,170,186,170,170,170,171,170,170,170,170,170,170,170,234,170,170,170,171,170,170,170,170,170,170,170,170,171,170,170,171,170,
+170,170,170,170,170,170,170,174,170,170,171,170,170,170,170,170,170,170,170,186,170,170,171,170,170,170,170,170,170,170,170,234,
+170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,
+170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,
+173,170,173,170,169,170,169,170,169,170,169,170,187,170,157,170,169,170,169,170,169,170,169,170,222,170,174,170,169,170,169,170,
+169,106,169,106,186,171,110,165,170,149,170,85,170,86,170,90,234,173,174,149,170,85,170,85,170,86,170,90,170,183,174,85,
+170,85,170,85,170,86,170,90,170,222,174,86,170,86,170,86,170,86,170,90,170,122,174,86,170,86,170,86,170,86,170,90,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,234,169,126,167,106,149,106,85,170,85,170,86,170,167,238,157,170,85,170,85,170,85,170,86,170,157,174,119,
+170,85,170,85,170,85,170,86,170,118,174,222,170,86,170,86,170,86,170,86,170,218,174,118,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,238,165,122,151,106,85,106,85,106,85,170,170,174,151,234,93,170,85,170,85,170,85,170,170,174,93,
+170,119,170,85,170,85,170,85,170,170,174,118,170,222,170,86,170,86,170,86,170,170,174,214,170,118,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,174,170,234,149,122,87,106,85,106,85,170,170,174,170,170,87,234,93,170,85,170,85,170,170,174,170,
+170,93,170,119,170,85,170,85,170,170,174,170,170,118,170,222,170,86,170,86,170,170,174,170,170,214,170,118,170,86,170,86,
+170,170,174,170,170,170,171,170,173,170,165,170,170,170,174,170,170,170,174,170,119,149,85,149,170,170,174,170,170,170,122,149,
+222,85,86,85,170,170,174,170,170,170,234,85,122,87,90,85,170,170,174,170,170,170,170,87,234,93,106,85,170,170,174,170,
+170,170,170,93,170,119,170,85,170,170,174,170,170,170,170,118,170,222,170,86,170,170,174,170,170,170,170,214,170,118,170,86,
+170,170,174,170,170,170,170,170,167,170,173,170,170,170,174,170,170,170,170,170,157,170,183,170,170,170,174,170,170,170,170,170,
+118,85,222,170,170,170,174,170,170,170,170,170,218,85,122,87,170,170,174,170,170,170,170,170,106,87,234,93,170,170,174,170,
+170,170,170,170,170,93,170,119,170,170,174,170,170,170,170,170,170,118,170,222,170,170,174,170,170,170,170,170,170,214,170,118,
+170,170,174,170,170,170,170,170,170,170,171,170,170,170,174,170,170,170,170,170,170,170,174,170,170,170,174,170,170,170,170,170,
+170,170,186,170,170,170,174,170,170,170,170,170,170,170,234,170,170,170,174,170,170,170,170,170,170,170,170,171,170,170,174,170,
+170,170,170,170,170,170,170,174,170,170,174,170,170,170,170,170,170,170,170,186,170,170,174,170,170,170,170,170,170,170,170,234,
+170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,
+170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,
+170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+173,170,181,170,169,170,169,170,169,170,169,170,183,170,185,170,169,170,169,170,169,170,169,170,238,170,118,170,169,170,169,170,
+169,106,169,106,122,171,186,170,170,170,170,106,170,106,170,106,234,174,186,149,170,86,170,86,170,90,170,106,170,183,186,86,
+170,86,170,86,170,90,170,106,170,222,186,86,170,86,170,86,170,90,170,106,170,122,186,90,170,90,170,90,170,90,170,106,
+171,170,189,170,169,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,167,250,157,170,85,170,85,170,86,170,90,170,158,186,119,
+170,86,170,86,170,86,170,90,170,118,186,222,170,86,170,86,170,86,170,90,170,218,186,122,170,90,170,90,170,90,170,90,
+170,170,187,170,173,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,186,151,234,93,170,85,170,85,170,85,170,170,186,94,
+170,119,170,86,170,86,170,86,170,170,186,118,170,222,170,86,170,86,170,86,170,170,186,218,170,122,170,90,170,90,170,90,
+170,170,186,170,171,170,173,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,186,170,170,87,234,93,170,85,170,85,170,170,186,170,
+170,94,170,119,170,86,170,86,170,170,186,170,170,118,170,222,170,86,170,86,170,170,186,170,170,218,170,122,170,90,170,90,
+170,170,186,170,170,170,171,170,173,170,165,170,170,170,186,170,170,170,173,170,183,170,149,170,170,170,186,170,170,170,186,170,
+221,85,85,85,170,170,186,170,170,170,234,85,122,87,90,85,170,170,186,170,170,170,170,87,234,93,106,85,170,170,186,170,
+170,170,170,94,170,119,170,85,170,170,186,170,170,170,170,118,170,222,170,86,170,170,186,170,170,170,170,218,170,122,170,90,
+170,170,186,170,170,170,170,170,167,170,173,170,170,170,186,170,170,170,170,170,157,170,183,170,170,170,186,170,170,170,170,170,
+118,170,222,170,170,170,186,170,170,170,170,170,218,85,122,171,170,170,186,170,170,170,170,170,106,87,234,93,170,170,186,170,
+170,170,170,170,170,93,170,119,170,170,186,170,170,170,170,170,170,118,170,222,170,170,186,170,170,170,170,170,170,218,170,122,
+170,170,186,170,170,170,170,170,170,170,171,170,170,170,186,170,170,170,170,170,170,170,174,170,170,170,186,170,170,170,170,170,
+170,170,186,170,170,170,186,170,170,170,170,170,170,170,234,170,170,170,186,170,170,170,170,170,170,170,170,171,170,170,186,170,
+170,170,170,170,170,170,170,174,170,170,186,170,170,170,170,170,170,170,170,186,170,170,186,170,170,170,170,170,170,170,170,234,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,
+170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,
+170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,
+173,170,233,170,169,170,169,170,169,170,169,170,187,170,229,170,169,170,169,170,169,170,169,170,222,170,233,170,169,170,169,170,
+169,170,169,170,186,171,218,169,169,170,169,106,169,106,169,106,234,173,234,170,170,106,170,106,170,106,170,106,170,187,234,86,
+170,90,170,90,170,106,170,106,170,222,234,90,170,90,170,90,170,106,170,106,170,122,234,90,170,90,170,90,170,106,170,106,
+171,170,237,170,169,170,169,170,169,170,169,170,173,170,247,170,165,170,165,170,169,170,169,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,158,234,119,
+170,86,170,86,170,90,170,106,170,122,234,222,170,90,170,90,170,90,170,106,170,218,234,122,170,90,170,90,170,90,170,106,
+170,170,235,170,173,170,169,170,169,170,169,170,170,170,237,170,183,170,165,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,234,94,
+170,119,170,86,170,86,170,86,170,170,234,122,170,222,170,90,170,90,170,90,170,170,234,218,170,122,170,90,170,90,170,90,
+170,170,234,170,171,170,173,170,169,170,169,170,170,170,234,170,173,170,183,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,234,170,
+170,94,170,119,170,86,170,86,170,170,234,170,170,122,170,222,170,90,170,90,170,170,234,170,170,218,170,122,170,90,170,90,
+170,170,234,170,170,170,171,170,173,170,165,170,170,170,234,170,170,170,173,170,183,170,149,170,170,170,234,170,170,170,181,170,
+221,170,85,170,170,170,234,170,170,170,234,170,117,87,85,85,170,170,234,170,170,170,170,87,234,93,106,85,170,170,234,170,
+170,170,170,94,170,119,170,85,170,170,234,170,170,170,170,122,170,222,170,86,170,170,234,170,170,170,170,218,170,122,170,90,
+170,170,234,170,170,170,170,170,167,170,173,170,170,170,234,170,170,170,170,170,157,170,183,170,170,170,234,170,170,170,170,170,
+117,170,222,170,170,170,234,170,170,170,170,170,218,169,122,171,170,170,234,170,170,170,170,170,106,87,234,173,170,170,234,170,
+170,170,170,170,170,93,170,119,170,170,234,170,170,170,170,170,170,118,170,222,170,170,234,170,170,170,170,170,170,218,170,122,
+170,170,234,170,170,170,170,170,170,170,171,170,170,170,234,170,170,170,170,170,170,170,174,170,170,170,234,170,170,170,170,170,
+170,170,186,170,170,170,234,170,170,170,170,170,170,170,234,170,170,170,234,170,170,170,170,170,170,170,170,171,170,170,234,170,
+170,170,170,170,170,170,170,174,170,170,234,170,170,170,170,170,170,170,170,186,170,170,234,170,170,170,170,170,170,170,170,234,
+170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,
+170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,
+170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,
+173,170,165,171,165,170,165,170,169,170,169,170,183,170,165,171,165,170,165,170,169,170,169,170,238,170,149,171,165,170,165,170,
+169,170,169,170,122,171,170,171,169,170,169,170,169,170,169,170,234,174,106,167,170,106,169,106,169,106,169,106,170,183,170,107,
+170,106,170,106,170,106,170,106,170,238,170,91,170,106,170,106,170,106,170,106,170,122,170,107,170,106,170,106,170,106,170,106,
+167,170,173,171,165,170,165,170,165,170,169,170,173,170,183,171,165,170,165,170,165,170,169,170,182,170,221,171,149,170,149,170,
+165,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,122,170,223,170,90,170,90,170,106,170,106,170,234,170,123,170,106,170,106,170,106,170,106,
+170,170,167,171,173,170,165,170,165,170,165,170,170,170,173,171,183,170,165,170,165,170,165,170,170,170,181,171,221,170,149,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,123,170,222,170,90,170,90,170,90,170,170,170,235,170,122,170,106,170,106,170,106,
+170,170,170,171,167,170,173,170,165,170,165,170,170,170,170,171,173,170,183,170,165,170,165,170,170,170,170,171,181,170,221,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,171,170,122,170,222,170,90,170,90,170,170,170,171,170,234,170,122,170,106,170,106,
+170,170,170,171,170,170,167,170,173,170,165,170,170,170,170,171,170,170,173,170,183,170,149,170,170,170,170,171,170,170,181,170,
+221,170,85,170,170,170,170,171,170,170,213,170,117,171,85,169,170,170,170,171,170,170,170,171,213,93,85,85,170,170,170,171,
+170,170,170,94,170,119,170,85,170,170,170,171,170,170,170,122,170,222,170,86,170,170,170,171,170,170,170,234,170,122,170,90,
+170,170,170,171,170,170,170,170,167,170,173,170,170,170,170,171,170,170,170,170,157,170,183,170,170,170,170,171,170,170,170,170,
+117,170,221,170,170,170,170,171,170,170,170,170,213,169,122,171,170,170,170,171,170,170,170,170,106,167,234,173,170,170,170,171,
+170,170,170,170,170,93,170,183,170,170,170,171,170,170,170,170,170,118,170,222,170,170,170,171,170,170,170,170,170,218,170,122,
+170,170,170,171,170,170,170,170,170,170,171,170,170,170,170,171,170,170,170,170,170,170,174,170,170,170,170,171,170,170,170,170,
+170,170,186,170,170,170,170,171,170,170,170,170,170,170,234,170,170,170,170,171,170,170,170,170,170,170,170,171,170,170,170,171,
+170,170,170,170,170,170,170,174,170,170,170,171,170,170,170,170,170,170,170,186,170,170,170,171,170,170,170,170,170,170,170,234,
+170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,
+170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,
+173,170,165,174,165,170,165,170,165,170,169,170,183,170,149,174,149,170,149,170,165,170,169,170,222,170,149,174,149,170,149,170,
+165,170,169,170,186,171,86,174,149,170,149,170,165,170,169,170,234,173,170,174,170,170,169,170,169,170,169,170,170,187,170,157,
+170,106,170,106,169,106,169,106,170,222,170,110,170,106,170,106,170,106,170,106,170,122,170,94,170,106,170,106,170,106,170,106,
+167,170,173,174,165,170,165,170,165,170,165,170,157,170,183,174,149,170,149,170,149,170,165,170,182,170,221,174,149,170,149,170,
+149,170,165,170,218,170,118,175,85,170,85,170,149,170,165,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,234,170,126,170,106,170,106,170,106,170,106,
+170,170,167,174,173,170,165,170,165,170,165,170,170,170,157,174,183,170,149,170,149,170,149,170,170,170,181,174,221,170,149,170,
+149,170,149,170,170,170,214,174,117,171,85,170,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,238,170,122,170,106,170,106,170,106,
+170,170,170,174,167,170,173,170,165,170,165,170,170,170,170,174,157,170,183,170,149,170,149,170,170,170,170,174,181,170,221,170,
+149,170,149,170,170,170,170,174,213,170,117,171,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,174,170,234,170,122,170,106,170,106,
+170,170,170,174,170,170,167,170,173,170,165,170,170,170,170,174,170,170,157,170,183,170,149,170,170,170,170,174,170,170,181,170,
+221,170,85,170,170,170,170,174,170,170,213,170,117,171,85,169,170,170,170,174,170,170,85,171,213,173,85,165,170,170,170,174,
+170,170,170,174,85,119,85,85,170,170,170,174,170,170,170,122,170,222,170,86,170,170,170,174,170,170,170,234,170,122,170,90,
+170,170,170,174,170,170,170,170,167,170,173,170,170,170,170,174,170,170,170,170,157,170,183,170,170,170,170,174,170,170,170,170,
+117,170,221,170,170,170,170,174,170,170,170,170,213,169,117,171,170,170,170,174,170,170,170,170,85,167,234,173,170,170,170,174,
+170,170,170,170,170,157,170,183,170,170,170,174,170,170,170,170,170,118,170,222,170,170,170,174,170,170,170,170,170,218,170,122,
+170,170,170,174,170,170,170,170,170,170,171,170,170,170,170,174,170,170,170,170,170,170,174,170,170,170,170,174,170,170,170,170,
+170,170,186,170,170,170,170,174,170,170,170,170,170,170,234,170,170,170,170,174,170,170,170,170,170,170,170,171,170,170,170,174,
+170,170,170,170,170,170,170,174,170,170,170,174,170,170,170,170,170,170,170,186,170,170,170,174,170,170,170,170,170,170,170,234,
+170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,
+170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,
+173,170,149,186,149,170,149,170,149,170,165,170,183,170,149,186,149,170,149,170,149,170,165,170,222,170,85,186,85,170,85,170,
+149,170,165,170,122,171,86,186,85,170,85,170,149,170,165,170,234,174,90,185,86,170,85,170,149,170,165,170,170,183,170,186,
+170,106,170,106,169,106,169,106,170,238,170,118,170,106,170,106,170,106,170,106,170,122,170,122,170,106,170,106,170,106,170,106,
+167,170,157,186,149,170,149,170,149,170,149,170,157,170,183,186,149,170,149,170,149,170,149,170,118,170,221,186,85,170,85,170,
+85,170,149,170,218,170,118,187,85,170,85,170,85,170,149,170,106,171,218,189,86,169,85,169,85,170,149,170,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,151,186,157,170,149,170,149,170,149,170,170,170,157,186,183,170,149,170,149,170,149,170,170,170,117,186,221,170,85,170,
+85,170,85,170,170,170,214,186,117,171,85,170,85,170,85,170,170,170,90,187,214,173,85,169,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,186,151,170,157,170,149,170,149,170,170,170,170,186,157,170,183,170,149,170,149,170,170,170,170,186,117,170,221,170,
+85,170,85,170,170,170,170,186,213,170,117,171,85,170,85,170,170,170,170,186,86,171,213,173,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,186,170,170,151,170,157,170,149,170,170,170,170,186,170,170,157,170,183,170,149,170,170,170,170,186,170,170,117,170,
+221,170,85,170,170,170,170,186,170,170,213,170,117,171,85,169,170,170,170,186,170,170,85,171,213,173,85,165,170,170,170,186,
+170,170,86,173,85,183,85,149,170,170,170,186,170,170,170,186,86,221,86,85,170,170,170,186,170,170,170,234,170,122,170,90,
+170,170,170,186,170,170,170,170,151,170,157,170,170,170,170,186,170,170,170,170,157,170,183,170,170,170,170,186,170,170,170,170,
+117,170,221,170,170,170,170,186,170,170,170,170,213,169,117,171,170,170,170,186,170,170,170,170,85,167,213,173,170,170,170,186,
+170,170,170,170,85,157,170,183,170,170,170,186,170,170,170,170,170,118,170,222,170,170,170,186,170,170,170,170,170,218,170,122,
+170,170,170,186,170,170,170,170,170,170,171,170,170,170,170,186,170,170,170,170,170,170,174,170,170,170,170,186,170,170,170,170,
+170,170,186,170,170,170,170,186,170,170,170,170,170,170,234,170,170,170,170,186,170,170,170,170,170,170,170,171,170,170,170,186,
+170,170,170,170,170,170,170,174,170,170,170,186,170,170,170,170,170,170,170,186,170,170,170,186,170,170,170,170,170,170,170,234,
+170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,
+170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,
+170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,
+173,170,149,234,149,170,149,170,149,170,149,170,183,170,85,234,85,170,85,170,85,170,149,170,222,170,85,234,85,170,85,170,
+85,170,149,170,122,171,86,233,85,169,85,169,85,170,149,170,234,173,90,233,86,169,85,169,85,170,149,170,170,187,106,229,
+90,105,86,105,85,106,149,106,170,222,170,234,170,106,170,106,170,106,170,106,170,122,170,218,170,106,170,106,170,106,170,106,
+167,170,157,234,149,170,149,170,149,170,149,170,157,170,119,234,85,170,85,170,85,170,85,170,118,170,221,234,85,170,85,170,
+85,170,85,170,218,169,118,235,85,169,85,169,85,169,85,170,106,171,218,237,86,169,85,169,85,169,85,170,170,173,106,247,
+90,101,86,101,85,105,85,106,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,151,234,157,170,149,170,149,170,149,170,170,170,93,234,119,170,85,170,85,170,85,170,170,170,117,234,221,170,85,170,
+85,170,85,170,170,170,214,233,117,171,85,169,85,169,85,169,170,170,90,235,214,173,85,169,85,169,85,169,170,170,106,237,
+90,119,86,101,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,234,151,170,157,170,149,170,149,170,170,170,170,234,93,170,119,170,85,170,85,170,170,170,170,234,117,170,221,170,
+85,170,85,170,170,170,170,234,213,169,117,171,85,169,85,169,170,170,170,234,86,171,213,173,85,169,85,169,170,170,170,234,
+90,173,86,119,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,234,170,170,151,170,157,170,149,170,170,170,170,234,170,170,93,170,119,170,85,170,170,170,170,234,170,170,117,170,
+221,170,85,170,170,170,170,234,170,170,213,169,117,171,85,169,170,170,170,234,170,170,85,171,213,173,85,165,170,170,170,234,
+170,170,86,173,85,119,85,85,170,170,170,234,170,170,90,181,86,221,86,85,170,170,170,234,170,170,170,234,90,117,90,85,
+170,170,170,234,170,170,170,170,151,170,157,170,170,170,170,234,170,170,170,170,93,170,119,170,170,170,170,234,170,170,170,170,
+117,170,221,170,170,170,170,234,170,170,170,170,213,169,117,171,170,170,170,234,170,170,170,170,85,167,213,173,170,170,170,234,
+170,170,170,170,85,157,85,183,170,170,170,234,170,170,170,170,86,117,170,222,170,170,170,234,170,170,170,170,170,218,170,122,
+170,170,170,234,170,170,170,170,170,170,171,170,170,170,170,234,170,170,170,170,170,170,174,170,170,170,170,234,170,170,170,170,
+170,170,186,170,170,170,170,234,170,170,170,170,170,170,234,170,170,170,170,234,170,170,170,170,170,170,170,171,170,170,170,234,
+170,170,170,170,170,170,170,174,170,170,170,234,170,170,170,170,170,170,170,186,170,170,170,234,170,170,170,170,170,170,170,234,
+170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,
+170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,
+173,170,169,170,171,170,169,170,169,170,169,170,187,170,165,170,171,170,169,170,169,170,169,170,238,170,89,169,107,165,105,149,
+169,85,169,86,122,171,106,165,107,149,105,85,169,85,169,86,234,173,106,149,107,85,106,85,170,85,170,86,170,183,170,85,
+171,85,170,85,170,85,170,86,170,222,170,85,171,85,170,85,170,85,170,86,170,122,170,86,171,86,170,86,170,86,170,86,
+167,170,173,170,167,170,85,169,169,170,169,170,157,170,183,170,87,169,169,170,169,170,169,170,118,170,221,169,91,165,89,149,
+105,85,169,85,218,169,122,167,107,149,105,85,105,85,169,85,106,167,234,157,107,85,106,85,106,85,170,85,170,157,170,119,
+171,85,170,85,170,85,170,85,170,118,170,221,171,85,170,85,170,85,170,85,170,218,170,118,171,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,121,169,223,165,89,149,
+89,85,105,85,170,170,234,165,123,151,106,85,106,85,106,85,170,170,106,151,235,93,106,85,106,85,106,85,170,170,170,93,
+171,119,170,85,170,85,170,85,170,170,170,117,171,221,170,85,170,85,170,85,170,170,170,214,171,118,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,123,165,221,149,
+89,85,89,85,170,170,170,170,235,149,122,87,106,85,106,85,170,170,170,170,107,87,234,93,106,85,106,85,170,170,170,170,
+171,93,170,119,170,85,170,85,170,170,170,170,171,117,170,221,170,85,170,85,170,170,170,170,171,214,170,118,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,171,170,122,149,
+221,85,89,85,170,170,170,170,171,170,234,85,122,87,106,85,170,170,170,170,171,170,106,87,234,93,106,85,170,170,170,170,
+171,170,170,93,170,119,170,85,170,170,170,170,171,170,170,117,170,221,170,85,170,170,170,170,171,170,170,214,170,118,170,86,
+170,170,170,170,171,170,170,170,171,170,173,170,170,170,170,170,171,170,170,170,94,149,183,170,170,170,170,170,171,170,170,170,
+122,85,222,85,170,170,170,170,171,170,170,170,234,85,122,87,170,170,170,170,171,170,170,170,106,87,234,93,170,170,170,170,
+171,170,170,170,170,93,170,119,170,170,170,170,171,170,170,170,170,117,170,221,170,170,170,170,171,170,170,170,170,214,170,118,
+170,170,170,170,171,170,170,170,170,170,171,170,170,170,170,170,171,170,170,170,170,170,174,170,170,170,170,170,171,170,170,170,
+170,170,186,170,170,170,170,170,171,170,170,170,170,170,234,170,170,170,170,170,171,170,170,170,170,170,170,171,170,170,170,170,
+171,170,170,170,170,170,170,174,170,170,170,170,171,170,170,170,170,170,170,186,170,170,170,170,171,170,170,170,170,170,170,234,
+170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,
+170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,
+171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,
+173,170,169,170,173,170,169,170,169,170,169,170,187,170,165,170,173,170,169,170,169,170,169,170,238,170,153,170,173,170,169,170,
+169,106,169,106,186,171,106,165,173,149,169,85,169,86,169,90,234,173,170,149,174,85,170,85,170,86,170,90,170,183,170,85,
+174,85,170,85,170,86,170,90,170,222,170,86,174,86,170,86,170,86,170,90,170,122,170,86,174,86,170,86,170,86,170,90,
+167,170,173,170,173,170,169,170,169,170,169,170,157,170,183,170,157,170,85,165,169,170,169,170,118,170,221,170,93,165,169,170,
+169,106,169,106,218,169,122,167,109,149,105,85,169,85,169,86,106,167,234,157,174,85,170,85,170,85,170,86,170,157,170,119,
+174,85,170,85,170,85,170,86,170,118,170,222,174,86,170,86,170,86,170,86,170,218,170,118,174,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,234,165,126,151,106,85,106,85,170,85,170,170,170,151,238,93,170,85,170,85,170,85,170,170,170,93,
+174,119,170,85,170,85,170,85,170,170,170,118,174,222,170,86,170,86,170,86,170,170,170,214,174,118,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,238,149,122,87,106,85,106,85,170,170,170,170,174,87,234,93,170,85,170,85,170,170,170,170,
+174,93,170,119,170,85,170,85,170,170,170,170,174,118,170,222,170,86,170,86,170,170,170,170,174,214,170,118,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,174,170,234,85,122,87,106,85,170,170,170,170,174,170,170,87,234,93,170,85,170,170,170,170,
+174,170,170,93,170,119,170,85,170,170,170,170,174,170,170,118,170,222,170,86,170,170,170,170,174,170,170,214,170,118,170,86,
+170,170,170,170,174,170,170,170,171,170,173,170,170,170,170,170,174,170,170,170,174,170,183,170,170,170,170,170,174,170,170,170,
+122,85,222,170,170,170,170,170,174,170,170,170,234,85,122,87,170,170,170,170,174,170,170,170,170,87,234,93,170,170,170,170,
+174,170,170,170,170,93,170,119,170,170,170,170,174,170,170,170,170,118,170,222,170,170,170,170,174,170,170,170,170,214,170,118,
+170,170,170,170,174,170,170,170,170,170,171,170,170,170,170,170,174,170,170,170,170,170,174,170,170,170,170,170,174,170,170,170,
+170,170,186,170,170,170,170,170,174,170,170,170,170,170,234,170,170,170,170,170,174,170,170,170,170,170,170,171,170,170,170,170,
+174,170,170,170,170,170,170,174,170,170,170,170,174,170,170,170,170,170,170,186,170,170,170,170,174,170,170,170,170,170,170,234,
+170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,
+170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,
+174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,
+173,170,169,170,185,170,169,170,169,170,169,170,187,170,165,170,185,170,169,170,169,170,169,170,238,170,153,170,185,170,169,170,
+169,106,169,106,186,171,106,170,185,170,169,106,169,106,169,106,234,174,170,149,186,86,170,86,170,90,170,106,170,183,170,86,
+186,86,170,86,170,90,170,106,170,222,170,86,186,86,170,86,170,90,170,106,170,122,170,90,186,90,170,90,170,90,170,106,
+167,170,173,170,185,170,169,170,169,170,169,170,157,170,183,170,181,170,169,170,169,170,169,170,118,170,221,170,117,170,85,149,
+169,106,169,106,218,169,122,171,121,149,169,106,169,106,169,106,106,167,234,157,186,85,170,85,170,86,170,90,170,157,170,119,
+186,86,170,86,170,86,170,90,170,118,170,222,186,86,170,86,170,86,170,90,170,218,170,122,186,90,170,90,170,90,170,90,
+170,170,171,170,189,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,151,250,93,170,85,170,85,170,86,170,170,170,94,
+186,119,170,86,170,86,170,86,170,170,170,118,186,222,170,86,170,86,170,86,170,170,170,218,186,122,170,90,170,90,170,90,
+170,170,170,170,187,170,173,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,186,87,234,93,170,85,170,85,170,170,170,170,
+186,94,170,119,170,86,170,86,170,170,170,170,186,118,170,222,170,86,170,86,170,170,170,170,186,218,170,122,170,90,170,90,
+170,170,170,170,186,170,171,170,173,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,186,170,170,87,234,93,170,85,170,170,170,170,
+186,170,170,94,170,119,170,86,170,170,170,170,186,170,170,118,170,222,170,86,170,170,170,170,186,170,170,218,170,122,170,90,
+170,170,170,170,186,170,170,170,171,170,173,170,170,170,170,170,186,170,170,170,173,170,183,170,170,170,170,170,186,170,170,170,
+186,170,222,170,170,170,170,170,186,170,170,170,234,85,122,171,170,170,170,170,186,170,170,170,170,87,234,93,170,170,170,170,
+186,170,170,170,170,94,170,119,170,170,170,170,186,170,170,170,170,118,170,222,170,170,170,170,186,170,170,170,170,218,170,122,
+170,170,170,170,186,170,170,170,170,170,171,170,170,170,170,170,186,170,170,170,170,170,174,170,170,170,170,170,186,170,170,170,
+170,170,186,170,170,170,170,170,186,170,170,170,170,170,234,170,170,170,170,170,186,170,170,170,170,170,170,171,170,170,170,170,
+186,170,170,170,170,170,170,174,170,170,170,170,186,170,170,170,170,170,170,186,170,170,170,170,186,170,170,170,170,170,170,234,
+170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,
+170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,
+186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,
+173,170,169,170,233,170,169,170,169,170,169,170,187,170,165,170,233,170,169,170,169,170,169,170,238,170,153,170,233,170,169,170,
+169,170,169,170,186,171,106,170,233,170,169,106,169,106,169,106,234,174,170,169,234,106,170,106,170,106,170,106,170,187,170,86,
+234,90,170,90,170,106,170,106,170,222,170,90,234,90,170,90,170,106,170,106,170,122,170,90,234,90,170,90,170,106,170,106,
+167,170,173,170,233,170,169,170,169,170,169,170,157,170,183,170,229,170,165,170,169,170,169,170,118,170,221,170,213,170,169,170,
+169,170,169,170,218,169,122,171,217,169,85,85,169,106,169,106,106,167,234,173,234,85,170,106,170,106,170,106,170,157,170,119,
+234,86,170,86,170,90,170,106,170,118,170,222,234,90,170,90,170,90,170,106,170,218,170,122,234,90,170,90,170,90,170,106,
+170,170,171,170,237,170,169,170,169,170,169,170,170,170,173,170,247,170,165,170,165,170,169,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,94,
+234,119,170,86,170,86,170,90,170,170,170,122,234,222,170,90,170,90,170,90,170,170,170,218,234,122,170,90,170,90,170,90,
+170,170,170,170,235,170,173,170,169,170,169,170,170,170,170,170,237,170,183,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+234,94,170,119,170,86,170,86,170,170,170,170,234,122,170,222,170,90,170,90,170,170,170,170,234,218,170,122,170,90,170,90,
+170,170,170,170,234,170,171,170,173,170,169,170,170,170,170,170,234,170,173,170,183,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+234,170,170,94,170,119,170,86,170,170,170,170,234,170,170,122,170,222,170,90,170,170,170,170,234,170,170,218,170,122,170,90,
+170,170,170,170,234,170,170,170,171,170,173,170,170,170,170,170,234,170,170,170,173,170,183,170,170,170,170,170,234,170,170,170,
+181,170,222,170,170,170,170,170,234,170,170,170,234,170,122,171,170,170,170,170,234,170,170,170,170,87,234,173,170,170,170,170,
+234,170,170,170,170,94,170,119,170,170,170,170,234,170,170,170,170,122,170,222,170,170,170,170,234,170,170,170,170,218,170,122,
+170,170,170,170,234,170,170,170,170,170,171,170,170,170,170,170,234,170,170,170,170,170,174,170,170,170,170,170,234,170,170,170,
+170,170,186,170,170,170,170,170,234,170,170,170,170,170,234,170,170,170,170,170,234,170,170,170,170,170,170,171,170,170,170,170,
+234,170,170,170,170,170,170,174,170,170,170,170,234,170,170,170,170,170,170,186,170,170,170,170,234,170,170,170,170,170,170,234,
+170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,
+170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,
+234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,
+173,170,165,170,165,171,165,170,169,170,169,170,183,170,165,170,165,171,165,170,169,170,169,170,238,170,149,170,165,171,165,170,
+169,170,169,170,186,171,106,170,169,171,169,170,169,170,169,170,234,174,170,169,170,107,169,106,169,106,169,106,170,187,170,102,
+170,107,170,106,170,106,170,106,170,238,170,90,170,107,170,106,170,106,170,106,170,122,170,106,170,107,170,106,170,106,170,106,
+167,170,173,170,165,171,165,170,165,170,169,170,157,170,183,170,165,171,165,170,165,170,169,170,118,170,221,170,149,171,149,170,
+165,170,169,170,218,169,122,171,85,171,169,170,169,170,169,170,106,167,234,173,106,103,85,85,169,106,169,106,170,157,170,119,
+170,87,170,106,170,106,170,106,170,118,170,222,170,91,170,90,170,106,170,106,170,218,170,122,170,107,170,106,170,106,170,106,
+170,170,167,170,173,171,165,170,165,170,165,170,170,170,173,170,183,171,165,170,165,170,165,170,170,170,181,170,221,171,149,170,
+149,170,165,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,122,170,223,170,90,170,90,170,106,170,170,170,234,170,123,170,106,170,106,170,106,
+170,170,170,170,167,171,173,170,165,170,165,170,170,170,170,170,173,171,183,170,165,170,165,170,170,170,170,170,181,171,221,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,123,170,222,170,90,170,90,170,170,170,170,170,235,170,122,170,106,170,106,
+170,170,170,170,170,171,167,170,173,170,165,170,170,170,170,170,170,171,173,170,183,170,165,170,170,170,170,170,170,171,181,170,
+221,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,171,170,122,170,222,170,90,170,170,170,170,170,171,170,234,170,122,170,106,
+170,170,170,170,170,171,170,170,167,170,173,170,170,170,170,170,170,171,170,170,173,170,183,170,170,170,170,170,170,171,170,170,
+181,170,221,170,170,170,170,170,170,171,170,170,213,170,122,171,170,170,170,170,170,171,170,170,170,171,234,173,170,170,170,170,
+170,171,170,170,170,94,170,183,170,170,170,170,170,171,170,170,170,122,170,222,170,170,170,170,170,171,170,170,170,234,170,122,
+170,170,170,170,170,171,170,170,170,170,171,170,170,170,170,170,170,171,170,170,170,170,174,170,170,170,170,170,170,171,170,170,
+170,170,186,170,170,170,170,170,170,171,170,170,170,170,234,170,170,170,170,170,170,171,170,170,170,170,170,171,170,170,170,170,
+170,171,170,170,170,170,170,174,170,170,170,170,170,171,170,170,170,170,170,186,170,170,170,170,170,171,170,170,170,170,170,234,
+170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,
+170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,
+170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,
+173,170,165,170,165,174,165,170,165,170,169,170,183,170,149,170,149,174,149,170,165,170,169,170,222,170,149,170,149,174,149,170,
+165,170,169,170,186,171,86,170,149,174,149,170,165,170,169,170,234,174,170,169,170,110,169,106,169,106,169,106,170,187,170,102,
+170,110,170,106,169,106,169,106,170,238,170,90,170,110,170,106,170,106,170,106,170,122,170,106,170,110,170,106,170,106,170,106,
+167,170,173,170,165,174,165,170,165,170,165,170,157,170,183,170,149,174,149,170,149,170,165,170,118,170,221,170,149,174,149,170,
+149,170,165,170,218,169,118,171,85,174,85,170,149,170,165,170,106,167,234,173,86,109,169,106,169,106,169,106,170,157,170,119,
+170,93,86,85,169,106,169,106,170,118,170,222,170,94,170,106,170,106,170,106,170,218,170,122,170,110,170,106,170,106,170,106,
+170,170,167,170,173,174,165,170,165,170,165,170,170,170,157,170,183,174,149,170,149,170,149,170,170,170,181,170,221,174,149,170,
+149,170,149,170,170,170,214,170,117,175,85,170,85,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,234,170,126,170,106,170,106,170,106,
+170,170,170,170,167,174,173,170,165,170,165,170,170,170,170,170,157,174,183,170,149,170,149,170,170,170,170,170,181,174,221,170,
+149,170,149,170,170,170,170,170,213,174,117,171,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,238,170,122,170,106,170,106,
+170,170,170,170,170,174,167,170,173,170,165,170,170,170,170,170,170,174,157,170,183,170,149,170,170,170,170,170,170,174,181,170,
+221,170,149,170,170,170,170,170,170,174,213,170,117,171,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,174,170,234,170,122,170,106,
+170,170,170,170,170,174,170,170,167,170,173,170,170,170,170,170,170,174,170,170,157,170,183,170,170,170,170,170,170,174,170,170,
+181,170,221,170,170,170,170,170,170,174,170,170,213,170,117,171,170,170,170,170,170,174,170,170,85,171,234,173,170,170,170,170,
+170,174,170,170,170,174,170,183,170,170,170,170,170,174,170,170,170,122,170,222,170,170,170,170,170,174,170,170,170,234,170,122,
+170,170,170,170,170,174,170,170,170,170,171,170,170,170,170,170,170,174,170,170,170,170,174,170,170,170,170,170,170,174,170,170,
+170,170,186,170,170,170,170,170,170,174,170,170,170,170,234,170,170,170,170,170,170,174,170,170,170,170,170,171,170,170,170,170,
+170,174,170,170,170,170,170,174,170,170,170,170,170,174,170,170,170,170,170,186,170,170,170,170,170,174,170,170,170,170,170,234,
+170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,
+170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,
+170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,
+173,170,149,170,149,186,149,170,149,170,165,170,183,170,149,170,149,186,149,170,149,170,165,170,222,170,85,170,85,186,85,170,
+149,170,165,170,122,171,86,170,85,186,85,170,149,170,165,170,234,174,90,169,86,122,85,106,149,106,165,106,170,187,170,102,
+170,122,170,106,169,106,169,106,170,238,170,90,170,122,170,106,170,106,170,106,170,122,170,106,170,122,170,106,170,106,170,106,
+167,170,157,170,149,186,149,170,149,170,149,170,157,170,183,170,149,186,149,170,149,170,149,170,118,170,221,170,85,186,85,170,
+85,170,149,170,218,169,118,171,85,186,85,170,85,170,149,170,106,167,218,173,86,121,85,105,85,106,149,106,170,157,170,119,
+90,117,170,106,169,106,169,106,170,118,170,222,170,118,90,85,170,106,170,106,170,218,170,122,170,122,170,106,170,106,170,106,
+170,170,151,170,157,186,149,170,149,170,149,170,170,170,157,170,183,186,149,170,149,170,149,170,170,170,117,170,221,186,85,170,
+85,170,85,170,170,170,214,170,117,187,85,170,85,170,85,170,170,170,90,171,214,189,85,169,85,169,85,170,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,151,186,157,170,149,170,149,170,170,170,170,170,157,186,183,170,149,170,149,170,170,170,170,170,117,186,221,170,
+85,170,85,170,170,170,170,170,213,186,117,171,85,170,85,170,170,170,170,170,86,187,213,173,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,186,151,170,157,170,149,170,170,170,170,170,170,186,157,170,183,170,149,170,170,170,170,170,170,186,117,170,
+221,170,85,170,170,170,170,170,170,186,213,170,117,171,85,170,170,170,170,170,170,186,85,171,213,173,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,186,170,170,151,170,157,170,170,170,170,170,170,186,170,170,157,170,183,170,170,170,170,170,170,186,170,170,
+117,170,221,170,170,170,170,170,170,186,170,170,213,170,117,171,170,170,170,170,170,186,170,170,85,171,213,173,170,170,170,170,
+170,186,170,170,85,173,170,183,170,170,170,170,170,186,170,170,170,186,170,222,170,170,170,170,170,186,170,170,170,234,170,122,
+170,170,170,170,170,186,170,170,170,170,171,170,170,170,170,170,170,186,170,170,170,170,174,170,170,170,170,170,170,186,170,170,
+170,170,186,170,170,170,170,170,170,186,170,170,170,170,234,170,170,170,170,170,170,186,170,170,170,170,170,171,170,170,170,170,
+170,186,170,170,170,170,170,174,170,170,170,170,170,186,170,170,170,170,170,186,170,170,170,170,170,186,170,170,170,170,170,234,
+170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,
+170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,
+170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,
+173,170,149,170,149,234,149,170,149,170,149,170,183,170,85,170,85,234,85,170,85,170,149,170,222,170,85,170,85,234,85,170,
+85,170,149,170,122,171,86,169,85,233,85,169,85,170,149,170,234,173,90,169,86,233,85,105,85,106,149,106,170,187,106,101,
+90,233,86,105,85,106,149,106,170,238,170,90,170,234,170,106,170,106,170,106,170,122,170,106,170,234,170,106,170,106,170,106,
+167,170,157,170,149,234,149,170,149,170,149,170,157,170,119,170,85,234,85,170,85,170,85,170,118,170,221,170,85,234,85,170,
+85,170,85,170,218,169,118,171,85,233,85,169,85,169,85,170,106,167,218,173,86,233,85,105,85,105,85,106,170,157,106,119,
+90,229,86,101,85,105,85,106,170,118,170,222,106,213,170,106,170,106,170,106,170,218,170,122,170,218,106,85,170,106,170,106,
+170,170,151,170,157,234,149,170,149,170,149,170,170,170,93,170,119,234,85,170,85,170,85,170,170,170,117,170,221,234,85,170,
+85,170,85,170,170,170,214,169,117,235,85,169,85,169,85,169,170,170,90,171,214,237,85,169,85,169,85,169,170,170,106,109,
+90,247,86,101,85,101,85,105,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,151,234,157,170,149,170,149,170,170,170,170,170,93,234,119,170,85,170,85,170,170,170,170,170,117,234,221,170,
+85,170,85,170,170,170,170,170,213,233,117,171,85,169,85,169,170,170,170,170,86,235,213,173,85,169,85,169,170,170,170,170,
+90,237,86,119,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,234,151,170,157,170,149,170,170,170,170,170,170,234,93,170,119,170,85,170,170,170,170,170,170,234,117,170,
+221,170,85,170,170,170,170,170,170,234,213,169,117,171,85,169,170,170,170,170,170,234,85,171,213,173,85,169,170,170,170,170,
+170,234,86,173,85,119,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,234,170,170,151,170,157,170,170,170,170,170,170,234,170,170,93,170,119,170,170,170,170,170,170,234,170,170,
+117,170,221,170,170,170,170,170,170,234,170,170,213,169,117,171,170,170,170,170,170,234,170,170,85,171,213,173,170,170,170,170,
+170,234,170,170,85,173,85,183,170,170,170,170,170,234,170,170,86,181,170,222,170,170,170,170,170,234,170,170,170,234,170,122,
+170,170,170,170,170,234,170,170,170,170,171,170,170,170,170,170,170,234,170,170,170,170,174,170,170,170,170,170,170,234,170,170,
+170,170,186,170,170,170,170,170,170,234,170,170,170,170,234,170,170,170,170,170,170,234,170,170,170,170,170,171,170,170,170,170,
+170,234,170,170,170,170,170,174,170,170,170,170,170,234,170,170,170,170,170,186,170,170,170,170,170,234,170,170,170,170,170,234,
+170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,
+170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,
+170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,
+173,170,165,170,149,170,87,169,169,170,169,170,183,170,149,170,85,169,87,165,169,170,169,170,222,170,85,169,85,165,91,149,
+169,85,169,86,122,171,90,165,89,149,107,85,169,85,169,86,234,173,106,149,106,85,107,85,169,85,169,86,170,183,170,85,
+170,85,171,85,170,85,170,86,170,222,170,85,170,85,171,85,170,85,170,86,170,122,170,86,170,86,171,86,170,86,170,86,
+167,170,173,170,149,170,171,170,169,170,169,170,157,170,183,170,85,169,171,170,169,170,169,170,118,170,221,169,85,165,91,149,
+105,85,169,85,218,169,122,167,89,149,107,85,105,85,169,85,106,167,234,157,106,85,107,85,105,85,169,85,170,157,170,119,
+170,85,171,85,170,85,170,85,170,118,170,221,170,85,171,85,170,85,170,85,170,218,170,118,170,86,171,86,170,86,170,86,
+170,170,151,170,93,170,87,169,85,165,169,170,170,170,93,170,119,169,87,165,169,170,169,170,170,170,117,169,221,165,91,149,
+89,85,105,85,170,170,218,165,121,151,107,85,105,85,105,85,170,170,106,151,234,93,107,85,105,85,105,85,170,170,170,93,
+170,119,171,85,170,85,170,85,170,170,170,117,170,221,171,85,170,85,170,85,170,170,170,214,170,118,171,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,121,165,223,149,
+89,85,89,85,170,170,170,170,234,149,123,87,106,85,106,85,170,170,170,170,106,87,235,93,106,85,106,85,170,170,170,170,
+170,93,171,119,170,85,170,85,170,170,170,170,170,117,171,221,170,85,170,85,170,170,170,170,170,214,171,118,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,123,149,
+221,85,89,85,170,170,170,170,170,170,235,85,122,87,106,85,170,170,170,170,170,170,107,87,234,93,106,85,170,170,170,170,
+170,170,171,93,170,119,170,85,170,170,170,170,170,170,171,117,170,221,170,85,170,170,170,170,170,170,171,214,170,118,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,171,170,
+122,85,222,85,170,170,170,170,170,170,171,170,234,85,122,87,170,170,170,170,170,170,171,170,106,87,234,93,170,170,170,170,
+170,170,171,170,170,93,170,119,170,170,170,170,170,170,171,170,170,117,170,221,170,170,170,170,170,170,171,170,170,214,170,118,
+170,170,170,170,170,170,171,170,170,170,171,170,170,170,170,170,170,170,171,170,170,170,174,170,170,170,170,170,170,170,171,170,
+170,170,186,170,170,170,170,170,170,170,171,170,170,170,234,170,170,170,170,170,170,170,171,170,170,170,170,171,170,170,170,170,
+170,170,171,170,170,170,170,174,170,170,170,170,170,170,171,170,170,170,170,186,170,170,170,170,170,170,171,170,170,170,170,234,
+170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,
+170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,
+173,170,165,170,149,170,173,170,169,170,169,170,183,170,149,170,85,170,93,165,169,170,169,170,222,170,85,170,85,165,93,149,
+169,106,169,106,122,171,90,165,89,149,109,85,169,86,169,90,234,173,106,149,106,85,173,85,169,86,169,90,170,183,170,85,
+170,85,174,85,170,86,170,90,170,222,170,86,170,86,174,86,170,86,170,90,170,122,170,86,170,86,174,86,170,86,170,90,
+167,170,173,170,149,170,173,170,169,170,169,170,157,170,183,170,85,170,173,170,169,170,169,170,118,170,221,170,85,165,173,170,
+169,106,169,106,218,169,122,167,89,149,109,85,169,85,169,86,106,167,234,157,106,85,173,85,169,85,169,86,170,157,170,119,
+170,85,174,85,170,85,170,86,170,118,170,222,170,86,174,86,170,86,170,86,170,218,170,118,170,86,174,86,170,86,170,86,
+170,170,167,170,157,170,173,170,169,170,169,170,170,170,93,170,119,169,93,165,85,149,169,170,170,170,117,169,221,165,93,149,
+169,106,169,106,170,170,218,165,121,151,109,85,105,85,169,85,170,170,106,151,234,93,173,85,169,85,169,85,170,170,170,93,
+170,119,174,85,170,85,170,85,170,170,170,118,170,222,174,86,170,86,170,86,170,170,170,214,170,118,174,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,234,149,126,87,106,85,106,85,170,170,170,170,170,87,238,93,170,85,170,85,170,170,170,170,
+170,93,174,119,170,85,170,85,170,170,170,170,170,118,174,222,170,86,170,86,170,170,170,170,170,214,174,118,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,238,85,122,87,106,85,170,170,170,170,170,170,174,87,234,93,170,85,170,170,170,170,
+170,170,174,93,170,119,170,85,170,170,170,170,170,170,174,118,170,222,170,86,170,170,170,170,170,170,174,214,170,118,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,174,170,234,85,122,87,170,170,170,170,170,170,174,170,170,87,234,93,170,170,170,170,
+170,170,174,170,170,93,170,119,170,170,170,170,170,170,174,170,170,118,170,222,170,170,170,170,170,170,174,170,170,214,170,118,
+170,170,170,170,170,170,174,170,170,170,171,170,170,170,170,170,170,170,174,170,170,170,174,170,170,170,170,170,170,170,174,170,
+170,170,186,170,170,170,170,170,170,170,174,170,170,170,234,170,170,170,170,170,170,170,174,170,170,170,170,171,170,170,170,170,
+170,170,174,170,170,170,170,174,170,170,170,170,170,170,174,170,170,170,170,186,170,170,170,170,170,170,174,170,170,170,170,234,
+170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,
+170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,
+173,170,165,170,165,170,185,170,169,170,169,170,183,170,149,170,85,170,181,170,169,170,169,170,222,170,85,170,85,169,117,149,
+169,106,169,106,122,171,90,169,85,149,121,85,169,106,169,106,234,173,106,149,106,85,185,85,169,90,169,106,170,183,170,85,
+170,85,186,86,170,90,170,106,170,222,170,86,170,86,186,86,170,90,170,106,170,122,170,90,170,90,186,90,170,90,170,106,
+167,170,173,170,165,170,185,170,169,170,169,170,157,170,183,170,85,170,185,170,169,170,169,170,118,170,221,170,85,169,185,170,
+169,106,169,106,218,169,122,171,85,149,185,106,169,106,169,106,106,167,234,157,106,85,185,85,169,86,169,90,170,157,170,119,
+170,85,186,86,170,86,170,90,170,118,170,222,170,86,186,86,170,86,170,90,170,218,170,122,170,90,186,90,170,90,170,90,
+170,170,167,170,173,170,185,170,169,170,169,170,170,170,157,170,119,170,181,170,169,170,169,170,170,170,117,169,221,165,117,149,
+85,85,169,106,170,170,218,165,117,151,121,85,169,106,169,106,170,170,106,151,234,93,185,85,169,85,169,86,170,170,170,93,
+170,119,186,86,170,86,170,86,170,170,170,118,170,222,186,86,170,86,170,86,170,170,170,218,170,122,186,90,170,90,170,90,
+170,170,170,170,171,170,189,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,87,250,93,170,85,170,85,170,170,170,170,
+170,94,186,119,170,86,170,86,170,170,170,170,170,118,186,222,170,86,170,86,170,170,170,170,170,218,186,122,170,90,170,90,
+170,170,170,170,170,170,187,170,173,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,186,87,234,93,170,85,170,170,170,170,
+170,170,186,94,170,119,170,86,170,170,170,170,170,170,186,118,170,222,170,86,170,170,170,170,170,170,186,218,170,122,170,90,
+170,170,170,170,170,170,186,170,171,170,173,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,186,170,170,87,234,93,170,170,170,170,
+170,170,186,170,170,94,170,119,170,170,170,170,170,170,186,170,170,118,170,222,170,170,170,170,170,170,186,170,170,218,170,122,
+170,170,170,170,170,170,186,170,170,170,171,170,170,170,170,170,170,170,186,170,170,170,174,170,170,170,170,170,170,170,186,170,
+170,170,186,170,170,170,170,170,170,170,186,170,170,170,234,170,170,170,170,170,170,170,186,170,170,170,170,171,170,170,170,170,
+170,170,186,170,170,170,170,174,170,170,170,170,170,170,186,170,170,170,170,186,170,170,170,170,170,170,186,170,170,170,170,234,
+170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,
+170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,
+173,170,165,170,165,170,233,170,169,170,169,170,183,170,149,170,149,170,229,170,169,170,169,170,222,170,85,170,85,169,213,170,
+169,170,169,170,122,171,90,169,85,165,213,85,169,106,169,106,234,173,106,165,90,85,233,85,169,106,169,106,170,183,170,85,
+170,85,234,86,170,106,170,106,170,222,170,86,170,86,234,90,170,106,170,106,170,122,170,90,170,90,234,90,170,106,170,106,
+167,170,173,170,165,170,233,170,169,170,169,170,157,170,183,170,149,170,229,170,169,170,169,170,118,170,221,170,85,169,233,170,
+169,170,169,170,218,169,122,171,85,165,233,106,169,106,169,106,106,167,234,173,90,85,233,106,169,106,169,106,170,157,170,119,
+170,85,234,86,170,90,170,106,170,118,170,222,170,86,234,90,170,90,170,106,170,218,170,122,170,90,234,90,170,90,170,106,
+170,170,167,170,173,170,233,170,169,170,169,170,170,170,157,170,183,170,229,170,165,170,169,170,170,170,117,170,221,169,213,170,
+169,170,169,170,170,170,214,165,117,151,213,85,85,85,169,106,170,170,106,151,218,93,233,85,169,106,169,106,170,170,170,93,
+170,119,234,86,170,86,170,90,170,170,170,118,170,222,234,90,170,90,170,90,170,170,170,218,170,122,234,90,170,90,170,90,
+170,170,170,170,171,170,237,170,169,170,169,170,170,170,170,170,173,170,247,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,94,234,119,170,86,170,86,170,170,170,170,170,122,234,222,170,90,170,90,170,170,170,170,170,218,234,122,170,90,170,90,
+170,170,170,170,170,170,235,170,173,170,169,170,170,170,170,170,170,170,237,170,183,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,234,94,170,119,170,86,170,170,170,170,170,170,234,122,170,222,170,90,170,170,170,170,170,170,234,218,170,122,170,90,
+170,170,170,170,170,170,234,170,171,170,173,170,170,170,170,170,170,170,234,170,173,170,183,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,234,170,170,94,170,119,170,170,170,170,170,170,234,170,170,122,170,222,170,170,170,170,170,170,234,170,170,218,170,122,
+170,170,170,170,170,170,234,170,170,170,171,170,170,170,170,170,170,170,234,170,170,170,174,170,170,170,170,170,170,170,234,170,
+170,170,186,170,170,170,170,170,170,170,234,170,170,170,234,170,170,170,170,170,170,170,234,170,170,170,170,171,170,170,170,170,
+170,170,234,170,170,170,170,174,170,170,170,170,170,170,234,170,170,170,170,186,170,170,170,170,170,170,234,170,170,170,170,234,
+170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,
+170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,
+170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,
+173,170,165,170,165,170,165,171,169,170,169,170,183,170,149,170,149,170,165,171,169,170,169,170,222,170,85,170,85,170,149,171,
+169,170,169,170,122,171,90,169,85,165,85,107,169,106,169,106,234,173,106,165,90,85,85,87,169,106,169,106,170,183,170,85,
+106,85,170,87,170,106,170,106,170,222,170,86,170,86,170,91,170,106,170,106,170,122,170,90,170,90,170,107,170,106,170,106,
+167,170,173,170,165,170,165,171,165,170,169,170,157,170,183,170,149,170,165,171,165,170,169,170,118,170,221,170,85,170,149,171,
+165,170,169,170,218,169,122,171,85,165,169,107,169,106,169,106,106,167,234,173,90,85,169,107,169,106,169,106,170,157,170,119,
+106,85,170,107,170,106,170,106,170,118,170,222,170,86,170,91,170,106,170,106,170,218,170,122,170,90,170,107,170,106,170,106,
+170,170,167,170,173,170,165,171,165,170,165,170,170,170,157,170,183,170,165,171,165,170,165,170,170,170,117,170,221,170,149,171,
+149,170,165,170,170,170,214,169,117,167,85,107,169,106,169,106,170,170,90,151,214,93,85,87,85,85,169,106,170,170,170,93,
+106,119,170,87,170,106,170,106,170,170,170,118,170,222,170,91,170,90,170,106,170,170,170,218,170,122,170,107,170,106,170,106,
+170,170,170,170,167,170,173,171,165,170,165,170,170,170,170,170,173,170,183,171,165,170,165,170,170,170,170,170,181,170,221,171,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,122,170,223,170,90,170,90,170,170,170,170,170,234,170,123,170,106,170,106,
+170,170,170,170,170,170,167,171,173,170,165,170,170,170,170,170,170,170,173,171,183,170,165,170,170,170,170,170,170,170,181,171,
+221,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,123,170,222,170,90,170,170,170,170,170,170,170,235,170,122,170,106,
+170,170,170,170,170,170,170,171,167,170,173,170,170,170,170,170,170,170,170,171,173,170,183,170,170,170,170,170,170,170,170,171,
+181,170,221,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,171,170,122,170,222,170,170,170,170,170,170,170,171,170,234,170,122,
+170,170,170,170,170,170,170,171,170,170,171,170,170,170,170,170,170,170,170,171,170,170,174,170,170,170,170,170,170,170,170,171,
+170,170,186,170,170,170,170,170,170,170,170,171,170,170,234,170,170,170,170,170,170,170,170,171,170,170,170,171,170,170,170,170,
+170,170,170,171,170,170,170,174,170,170,170,170,170,170,170,171,170,170,170,186,170,170,170,170,170,170,170,171,170,170,170,234,
+170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,
+170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,
+170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+173,170,165,170,165,170,165,174,165,170,169,170,183,170,149,170,149,170,149,174,165,170,169,170,222,170,85,170,85,170,149,174,
+165,170,169,170,122,171,86,169,85,169,85,110,165,106,169,106,234,173,106,165,86,85,85,109,169,106,169,106,170,183,170,85,
+106,85,86,93,169,106,169,106,170,222,170,86,170,85,170,94,170,106,170,106,170,122,170,90,170,90,170,110,170,106,170,106,
+167,170,173,170,165,170,165,174,165,170,165,170,157,170,183,170,149,170,149,174,149,170,165,170,118,170,221,170,85,170,149,174,
+149,170,165,170,218,169,118,171,85,169,85,110,149,106,165,106,106,167,234,173,86,85,169,110,169,106,169,106,170,157,170,119,
+106,85,170,110,169,106,169,106,170,118,170,222,170,85,170,110,170,106,170,106,170,218,170,122,170,90,170,110,170,106,170,106,
+170,170,167,170,173,170,165,174,165,170,165,170,170,170,157,170,183,170,149,174,149,170,149,170,170,170,117,170,221,170,149,174,
+149,170,149,170,170,170,214,169,117,171,85,110,85,106,149,106,170,170,90,167,214,93,85,109,169,106,169,106,170,170,106,93,
+90,119,86,93,85,85,169,106,170,170,170,118,170,221,170,94,170,106,170,106,170,170,170,218,170,122,170,110,170,106,170,106,
+170,170,170,170,167,170,173,174,165,170,165,170,170,170,170,170,157,170,183,174,149,170,149,170,170,170,170,170,181,170,221,174,
+149,170,149,170,170,170,170,170,213,170,117,175,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,234,170,126,170,106,170,106,
+170,170,170,170,170,170,167,174,173,170,165,170,170,170,170,170,170,170,157,174,183,170,149,170,170,170,170,170,170,170,181,174,
+221,170,149,170,170,170,170,170,170,170,213,174,117,171,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,238,170,122,170,106,
+170,170,170,170,170,170,170,174,167,170,173,170,170,170,170,170,170,170,170,174,157,170,183,170,170,170,170,170,170,170,170,174,
+181,170,221,170,170,170,170,170,170,170,170,174,213,170,117,171,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,174,170,234,170,122,
+170,170,170,170,170,170,170,174,170,170,171,170,170,170,170,170,170,170,170,174,170,170,174,170,170,170,170,170,170,170,170,174,
+170,170,186,170,170,170,170,170,170,170,170,174,170,170,234,170,170,170,170,170,170,170,170,174,170,170,170,171,170,170,170,170,
+170,170,170,174,170,170,170,174,170,170,170,170,170,170,170,174,170,170,170,186,170,170,170,170,170,170,170,174,170,170,170,234,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,
+170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,
+170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,
+173,170,149,170,149,170,149,186,149,170,165,170,183,170,149,170,149,170,149,186,149,170,165,170,222,170,85,170,85,170,85,186,
+149,170,165,170,122,171,86,169,85,169,85,122,149,106,165,106,234,173,90,165,86,101,85,121,149,106,165,106,170,183,170,85,
+90,85,86,117,169,106,169,106,170,222,170,86,170,85,90,117,170,106,170,106,170,122,170,90,170,86,170,122,170,106,170,106,
+167,170,157,170,149,170,149,186,149,170,149,170,157,170,183,170,149,170,149,186,149,170,149,170,118,170,221,170,85,170,85,186,
+85,170,149,170,218,169,118,171,85,169,85,122,85,106,149,106,106,167,218,173,86,101,85,121,85,106,149,106,170,157,170,119,
+90,85,170,122,169,106,169,106,170,118,170,222,170,85,170,122,170,106,170,106,170,218,170,122,170,86,170,122,170,106,170,106,
+170,170,151,170,157,170,149,186,149,170,149,170,170,170,157,170,183,170,149,186,149,170,149,170,170,170,117,170,221,170,85,186,
+85,170,85,170,170,170,214,169,117,171,85,122,85,106,85,106,170,170,90,167,214,109,85,121,85,105,85,106,170,170,106,93,
+90,119,86,117,169,106,169,106,170,170,170,117,106,221,90,117,86,85,170,106,170,170,170,218,170,118,170,122,170,106,170,106,
+170,170,170,170,151,170,157,186,149,170,149,170,170,170,170,170,157,170,183,186,149,170,149,170,170,170,170,170,117,170,221,186,
+85,170,85,170,170,170,170,170,213,170,117,187,85,170,85,170,170,170,170,170,86,171,213,189,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,151,186,157,170,149,170,170,170,170,170,170,170,157,186,183,170,149,170,170,170,170,170,170,170,117,186,
+221,170,85,170,170,170,170,170,170,170,213,186,117,171,85,170,170,170,170,170,170,170,85,187,213,173,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,186,151,170,157,170,170,170,170,170,170,170,170,186,157,170,183,170,170,170,170,170,170,170,170,186,
+117,170,221,170,170,170,170,170,170,170,170,186,213,170,117,171,170,170,170,170,170,170,170,186,85,171,213,173,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,186,170,170,171,170,170,170,170,170,170,170,170,186,170,170,174,170,170,170,170,170,170,170,170,186,
+170,170,186,170,170,170,170,170,170,170,170,186,170,170,234,170,170,170,170,170,170,170,170,186,170,170,170,171,170,170,170,170,
+170,170,170,186,170,170,170,174,170,170,170,170,170,170,170,186,170,170,170,186,170,170,170,170,170,170,170,186,170,170,170,234,
+170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,
+170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,
+170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,
+173,170,149,170,149,170,149,234,149,170,149,170,183,170,85,170,85,170,85,234,85,170,149,170,222,170,85,170,85,170,85,234,
+85,170,149,170,122,171,86,169,85,169,85,233,85,106,149,106,234,173,90,165,86,101,85,233,85,106,149,106,170,183,106,85,
+90,85,86,229,85,106,149,106,170,222,170,86,106,85,90,213,170,106,170,106,170,122,170,90,170,86,106,213,170,106,170,106,
+167,170,157,170,149,170,149,234,149,170,149,170,157,170,119,170,85,170,85,234,85,170,85,170,118,170,221,170,85,170,85,234,
+85,170,85,170,218,169,118,171,85,169,85,233,85,105,85,106,106,167,218,173,86,101,85,233,85,105,85,106,170,157,106,119,
+90,85,86,229,85,105,85,106,170,118,170,222,106,85,170,234,170,106,170,106,170,218,170,122,170,86,170,234,170,106,170,106,
+170,170,151,170,157,170,149,234,149,170,149,170,170,170,93,170,119,170,85,234,85,170,85,170,170,170,117,170,221,170,85,234,
+85,170,85,170,170,170,214,169,117,171,85,233,85,105,85,105,170,170,90,167,214,109,85,233,85,105,85,105,170,170,106,93,
+90,119,86,229,85,101,85,105,170,170,170,117,106,221,90,213,170,106,170,106,170,170,170,214,170,117,106,213,90,85,170,106,
+170,170,170,170,151,170,157,234,149,170,149,170,170,170,170,170,93,170,119,234,85,170,85,170,170,170,170,170,117,170,221,234,
+85,170,85,170,170,170,170,170,213,169,117,235,85,169,85,169,170,170,170,170,86,171,213,237,85,169,85,169,170,170,170,170,
+90,109,86,247,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,151,234,157,170,149,170,170,170,170,170,170,170,93,234,119,170,85,170,170,170,170,170,170,170,117,234,
+221,170,85,170,170,170,170,170,170,170,213,233,117,171,85,169,170,170,170,170,170,170,85,235,213,173,85,169,170,170,170,170,
+170,170,86,237,85,119,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,234,151,170,157,170,170,170,170,170,170,170,170,234,93,170,119,170,170,170,170,170,170,170,170,234,
+117,170,221,170,170,170,170,170,170,170,170,234,213,169,117,171,170,170,170,170,170,170,170,234,85,171,213,173,170,170,170,170,
+170,170,170,234,85,173,85,183,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,234,170,170,171,170,170,170,170,170,170,170,170,234,170,170,174,170,170,170,170,170,170,170,170,234,
+170,170,186,170,170,170,170,170,170,170,170,234,170,170,234,170,170,170,170,170,170,170,170,234,170,170,170,171,170,170,170,170,
+170,170,170,234,170,170,170,174,170,170,170,170,170,170,170,234,170,170,170,186,170,170,170,170,170,170,170,234,170,170,170,234,
+170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,
+170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,
+173,170,149,170,85,170,85,169,171,170,169,170,183,170,85,170,85,169,85,165,171,170,169,170,222,170,85,169,85,165,85,149,
+171,85,169,86,122,171,86,165,85,149,89,85,171,85,169,86,234,173,90,149,90,85,105,85,171,85,169,86,170,183,106,85,
+106,85,170,85,171,85,169,86,170,222,170,85,170,85,170,85,171,85,170,86,170,122,170,86,170,86,170,86,171,86,170,86,
+167,170,157,170,85,170,85,169,87,165,169,170,157,170,119,170,85,169,85,165,87,149,169,170,118,170,221,169,85,165,85,149,
+91,85,169,85,218,169,118,167,85,149,89,85,107,85,169,85,106,167,218,157,90,85,105,85,107,85,169,85,170,157,106,119,
+106,85,170,85,171,85,169,85,170,118,170,221,170,85,170,85,171,85,170,85,170,218,170,118,170,86,170,86,171,86,170,86,
+170,170,151,170,93,170,85,169,171,170,169,170,170,170,93,170,119,169,85,165,171,170,169,170,170,170,117,169,221,165,85,149,
+91,85,105,85,170,170,214,165,117,151,89,85,107,85,105,85,170,170,90,151,218,93,105,85,107,85,105,85,170,170,106,93,
+106,119,170,85,171,85,169,85,170,170,170,117,170,221,170,85,171,85,170,85,170,170,170,214,170,118,170,86,171,86,170,86,
+170,170,170,170,87,170,93,169,87,165,85,165,170,170,170,170,93,169,119,165,87,149,169,170,170,170,170,170,117,165,221,149,
+91,85,89,85,170,170,170,170,217,149,121,87,107,85,105,85,170,170,170,170,106,87,233,93,107,85,105,85,170,170,170,170,
+170,93,170,119,171,85,169,85,170,170,170,170,170,117,170,221,171,85,170,85,170,170,170,170,170,214,170,118,171,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,121,149,
+223,85,89,85,170,170,170,170,170,170,234,85,123,87,106,85,170,170,170,170,170,170,106,87,235,93,106,85,170,170,170,170,
+170,170,170,93,171,119,170,85,170,170,170,170,170,170,170,117,171,221,170,85,170,170,170,170,170,170,170,214,171,118,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,
+123,85,221,85,170,170,170,170,170,170,170,170,235,85,122,87,170,170,170,170,170,170,170,170,107,87,234,93,170,170,170,170,
+170,170,170,170,171,93,170,119,170,170,170,170,170,170,170,170,171,117,170,221,170,170,170,170,170,170,170,170,171,214,170,118,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,
+171,170,186,170,170,170,170,170,170,170,170,170,171,170,234,170,170,170,170,170,170,170,170,170,171,170,170,171,170,170,170,170,
+170,170,170,170,171,170,170,174,170,170,170,170,170,170,170,170,171,170,170,186,170,170,170,170,170,170,170,170,171,170,170,234,
+170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,
+171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,
+170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,
+173,170,149,170,85,170,149,170,173,170,169,170,183,170,85,170,85,169,85,165,173,170,169,170,222,170,85,169,85,165,85,149,
+173,106,169,106,122,171,86,165,85,149,89,85,173,86,169,90,234,173,90,149,90,85,105,85,173,86,169,90,170,183,106,85,
+106,85,170,85,173,86,169,90,170,222,170,85,170,85,170,86,174,86,170,90,170,122,170,86,170,86,170,86,174,86,170,90,
+167,170,157,170,85,170,149,170,173,170,169,170,157,170,119,170,85,169,85,165,93,149,169,170,118,170,221,169,85,165,85,149,
+93,85,169,106,218,169,118,167,85,149,89,85,109,85,169,86,106,167,218,157,90,85,105,85,173,85,169,86,170,157,106,119,
+106,85,170,85,173,85,169,86,170,118,170,221,170,85,170,86,174,86,170,86,170,218,170,118,170,86,170,86,174,86,170,86,
+170,170,151,170,93,170,149,170,173,170,169,170,170,170,93,170,119,169,85,165,173,170,169,170,170,170,117,169,221,165,85,149,
+173,106,169,106,170,170,214,165,117,151,89,85,109,85,169,85,170,170,90,151,218,93,105,85,173,85,169,85,170,170,106,93,
+106,119,170,85,173,85,169,85,170,170,170,117,170,221,170,86,174,86,170,86,170,170,170,214,170,118,170,86,174,86,170,86,
+170,170,170,170,103,170,157,170,173,170,169,170,170,170,170,170,93,169,119,165,93,149,85,149,170,170,170,170,117,165,221,149,
+93,85,169,106,170,170,170,170,217,149,121,87,109,85,105,85,170,170,170,170,106,87,233,93,173,85,169,85,170,170,170,170,
+170,93,170,119,173,85,169,85,170,170,170,170,170,118,170,222,174,86,170,86,170,170,170,170,170,214,170,118,174,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,234,85,126,87,106,85,170,170,170,170,170,170,170,87,238,93,170,85,170,170,170,170,
+170,170,170,93,174,119,170,85,170,170,170,170,170,170,170,118,174,222,170,86,170,170,170,170,170,170,170,214,174,118,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,170,170,238,85,122,87,170,170,170,170,170,170,170,170,174,87,234,93,170,170,170,170,
+170,170,170,170,174,93,170,119,170,170,170,170,170,170,170,170,174,118,170,222,170,170,170,170,170,170,170,170,174,214,170,118,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,170,170,174,170,234,170,170,170,170,170,170,170,170,170,174,170,170,171,170,170,170,170,
+170,170,170,170,174,170,170,174,170,170,170,170,170,170,170,170,174,170,170,186,170,170,170,170,170,170,170,170,174,170,170,234,
+170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,
+174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,
+170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,
+173,170,149,170,149,170,165,170,185,170,169,170,183,170,85,170,85,169,85,170,185,170,169,170,222,170,85,169,85,165,85,149,
+185,106,169,106,122,171,86,165,85,149,85,85,185,106,169,106,234,173,90,149,90,85,105,85,185,90,169,106,170,183,106,85,
+106,85,170,85,185,90,169,106,170,222,170,85,170,85,170,86,186,90,170,106,170,122,170,86,170,86,170,90,186,90,170,106,
+167,170,157,170,149,170,165,170,185,170,169,170,157,170,119,170,85,169,85,170,181,170,169,170,118,170,221,169,85,165,85,149,
+117,85,169,106,218,169,118,167,85,149,85,85,121,85,169,106,106,167,218,157,90,85,105,85,185,85,169,90,170,157,106,119,
+106,85,170,85,185,86,169,90,170,118,170,221,170,85,170,86,186,86,170,90,170,218,170,118,170,86,170,90,186,90,170,90,
+170,170,151,170,157,170,165,170,185,170,169,170,170,170,93,170,119,169,85,170,185,170,169,170,170,170,117,169,221,165,85,149,
+185,106,169,106,170,170,214,165,117,151,85,85,185,106,169,106,170,170,90,151,218,93,105,85,185,85,169,86,170,170,106,93,
+106,119,170,85,185,86,169,86,170,170,170,117,170,221,170,86,186,86,170,86,170,170,170,214,170,118,170,90,186,90,170,90,
+170,170,170,170,167,170,173,170,185,170,169,170,170,170,170,170,157,169,119,170,181,170,169,170,170,170,170,170,117,165,221,149,
+117,85,85,85,170,170,170,170,217,149,117,87,121,85,169,106,170,170,170,170,106,87,233,93,185,85,169,85,170,170,170,170,
+170,93,170,119,185,86,169,86,170,170,170,170,170,118,170,222,186,86,170,86,170,170,170,170,170,218,170,122,186,90,170,90,
+170,170,170,170,170,170,171,170,189,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,87,250,93,170,85,170,170,170,170,
+170,170,170,94,186,119,170,86,170,170,170,170,170,170,170,118,186,222,170,86,170,170,170,170,170,170,170,218,186,122,170,90,
+170,170,170,170,170,170,170,170,187,170,173,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,186,87,234,93,170,170,170,170,
+170,170,170,170,186,94,170,119,170,170,170,170,170,170,170,170,186,118,170,222,170,170,170,170,170,170,170,170,186,218,170,122,
+170,170,170,170,170,170,170,170,186,170,171,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,186,170,170,171,170,170,170,170,
+170,170,170,170,186,170,170,174,170,170,170,170,170,170,170,170,186,170,170,186,170,170,170,170,170,170,170,170,186,170,170,234,
+170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,
+186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,
+170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,
+173,170,149,170,149,170,165,170,233,170,169,170,183,170,85,170,85,170,149,170,233,170,169,170,222,170,85,169,85,165,85,169,
+233,106,169,106,122,171,86,165,85,149,85,85,233,106,169,106,234,173,90,149,86,85,89,85,233,106,169,106,170,183,106,85,
+106,85,170,85,233,106,169,106,170,222,170,85,170,85,170,86,234,106,170,106,170,122,170,86,170,86,170,90,234,106,170,106,
+167,170,157,170,149,170,165,170,233,170,169,170,157,170,119,170,85,170,149,170,229,170,169,170,118,170,221,169,85,165,85,169,
+213,106,169,106,218,169,118,167,85,149,85,85,213,85,169,106,106,167,218,157,86,85,89,85,233,85,169,106,170,157,106,119,
+106,85,170,85,233,86,169,106,170,118,170,221,170,85,170,86,234,90,170,106,170,218,170,118,170,86,170,90,234,90,170,106,
+170,170,151,170,157,170,165,170,233,170,169,170,170,170,93,170,119,170,149,170,229,170,169,170,170,170,117,169,221,165,85,169,
+233,106,169,106,170,170,214,165,117,151,85,85,233,106,169,106,170,170,90,151,214,93,89,85,233,106,169,106,170,170,106,93,
+106,119,170,85,233,86,169,90,170,170,170,117,170,221,170,86,234,90,170,90,170,170,170,214,170,118,170,90,234,90,170,90,
+170,170,170,170,167,170,173,170,233,170,169,170,170,170,170,170,157,170,183,170,229,170,165,170,170,170,170,170,117,166,221,169,
+213,106,169,106,170,170,170,170,213,149,117,87,213,85,85,85,170,170,170,170,102,87,217,93,233,85,169,106,170,170,170,170,
+170,93,170,119,233,86,169,86,170,170,170,170,170,118,170,222,234,90,170,90,170,170,170,170,170,218,170,122,234,90,170,90,
+170,170,170,170,170,170,171,170,237,170,169,170,170,170,170,170,170,170,173,170,247,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,94,234,119,170,86,170,170,170,170,170,170,170,122,234,222,170,90,170,170,170,170,170,170,170,218,234,122,170,90,
+170,170,170,170,170,170,170,170,235,170,173,170,170,170,170,170,170,170,170,170,237,170,183,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,170,234,94,170,119,170,170,170,170,170,170,170,170,234,122,170,222,170,170,170,170,170,170,170,170,234,218,170,122,
+170,170,170,170,170,170,170,170,234,170,171,170,170,170,170,170,170,170,170,170,234,170,174,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,170,234,170,170,174,170,170,170,170,170,170,170,170,234,170,170,186,170,170,170,170,170,170,170,170,234,170,170,234,
+170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,
+234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,
+170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,
+173,170,149,170,149,170,165,170,169,171,169,170,183,170,85,170,85,170,149,170,169,171,169,170,222,170,85,169,85,169,85,170,
+169,107,169,106,122,171,86,165,85,149,85,101,169,107,169,106,234,173,90,149,86,85,85,85,169,107,169,106,170,183,106,85,
+90,85,106,85,169,107,169,106,170,222,170,85,170,85,170,86,170,107,170,106,170,122,170,86,170,86,170,90,170,107,170,106,
+167,170,157,170,149,170,165,170,165,171,169,170,157,170,119,170,85,170,149,170,165,171,169,170,118,170,221,169,85,169,85,170,
+149,107,169,106,218,169,118,167,85,149,85,101,85,107,169,106,106,167,218,157,86,85,85,85,85,87,169,106,170,157,106,119,
+90,85,106,85,169,87,169,106,170,118,170,221,170,85,170,86,170,91,170,106,170,218,170,118,170,86,170,90,170,107,170,106,
+170,170,151,170,157,170,165,170,165,171,165,170,170,170,93,170,119,170,149,170,165,171,165,170,170,170,117,169,221,169,85,170,
+149,107,165,106,170,170,214,165,117,151,85,101,169,107,169,106,170,170,90,151,214,93,85,85,169,107,169,106,170,170,106,93,
+90,119,106,85,169,107,169,106,170,170,170,117,170,221,170,86,170,91,170,106,170,170,170,214,170,118,170,90,170,107,170,106,
+170,170,170,170,167,170,173,170,165,171,165,170,170,170,170,170,157,170,183,170,165,171,165,170,170,170,170,170,117,170,221,170,
+149,107,149,106,170,170,170,170,213,153,117,103,85,107,169,106,170,170,170,170,86,87,213,93,85,87,85,85,170,170,170,170,
+154,93,106,119,169,87,169,106,170,170,170,170,170,118,170,222,170,91,170,90,170,170,170,170,170,218,170,122,170,107,170,106,
+170,170,170,170,170,170,167,170,173,171,165,170,170,170,170,170,170,170,173,170,183,171,165,170,170,170,170,170,170,170,181,170,
+221,171,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,122,170,223,170,90,170,170,170,170,170,170,170,234,170,123,170,106,
+170,170,170,170,170,170,170,170,167,171,173,170,170,170,170,170,170,170,170,170,173,171,183,170,170,170,170,170,170,170,170,170,
+181,171,221,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,123,170,222,170,170,170,170,170,170,170,170,170,235,170,122,
+170,170,170,170,170,170,170,170,170,171,171,170,170,170,170,170,170,170,170,170,170,171,174,170,170,170,170,170,170,170,170,170,
+170,171,186,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,171,170,186,170,170,170,170,170,170,170,170,170,171,170,234,
+170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,
+170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,
+170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,
+173,170,149,170,149,170,165,170,165,174,169,170,183,170,85,170,85,170,149,170,165,174,169,170,222,170,85,169,85,169,85,170,
+165,110,169,106,122,171,86,165,85,165,85,105,165,110,169,106,234,173,90,149,86,85,85,85,169,110,169,106,170,183,106,85,
+90,85,86,85,169,110,169,106,170,222,170,85,106,85,170,85,170,110,170,106,170,122,170,86,170,86,170,90,170,110,170,106,
+167,170,157,170,149,170,165,170,165,174,165,170,157,170,119,170,85,170,149,170,149,174,165,170,118,170,221,169,85,169,85,170,
+149,110,165,106,218,169,118,167,85,165,85,105,85,110,165,106,106,167,218,157,86,85,85,85,85,109,169,106,170,157,106,119,
+90,85,86,85,85,93,169,106,170,118,170,221,106,85,170,85,170,94,170,106,170,218,170,118,170,86,170,90,170,110,170,106,
+170,170,151,170,157,170,165,170,165,174,165,170,170,170,93,170,119,170,149,170,149,174,149,170,170,170,117,169,221,169,85,170,
+149,110,149,106,170,170,214,165,117,167,85,105,85,110,149,106,170,170,90,151,214,93,85,85,169,110,169,106,170,170,106,93,
+90,119,86,85,169,110,169,106,170,170,170,117,106,221,170,85,170,110,170,106,170,170,170,214,170,118,170,90,170,110,170,106,
+170,170,170,170,167,170,173,170,165,174,165,170,170,170,170,170,157,170,183,170,149,174,149,170,170,170,170,170,117,170,221,170,
+149,110,149,106,170,170,170,170,213,169,117,107,85,110,85,106,170,170,170,170,86,103,213,93,85,109,169,106,170,170,170,170,
+90,93,86,119,85,93,85,85,170,170,170,170,106,118,170,221,170,94,170,106,170,170,170,170,170,218,170,122,170,110,170,106,
+170,170,170,170,170,170,167,170,173,174,165,170,170,170,170,170,170,170,157,170,183,174,149,170,170,170,170,170,170,170,181,170,
+221,174,149,170,170,170,170,170,170,170,213,170,117,175,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,234,170,126,170,106,
+170,170,170,170,170,170,170,170,167,174,173,170,170,170,170,170,170,170,170,170,157,174,183,170,170,170,170,170,170,170,170,170,
+181,174,221,170,170,170,170,170,170,170,170,170,213,174,117,171,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,238,170,122,
+170,170,170,170,170,170,170,170,170,174,171,170,170,170,170,170,170,170,170,170,170,174,174,170,170,170,170,170,170,170,170,170,
+170,174,186,170,170,170,170,170,170,170,170,170,170,174,234,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,174,170,234,
+170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,
+170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,
+170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,
+173,170,149,170,149,170,149,170,149,186,165,170,183,170,85,170,85,170,149,170,149,186,165,170,222,170,85,169,85,169,85,170,
+149,122,165,106,122,171,86,165,85,165,85,105,149,122,165,106,234,173,90,149,86,85,85,101,149,122,165,106,170,183,106,85,
+90,85,86,85,169,122,169,106,170,222,170,85,106,85,90,85,170,122,170,106,170,122,170,86,170,85,170,86,170,122,170,106,
+167,170,157,170,149,170,149,170,149,186,149,170,157,170,119,170,85,170,149,170,149,186,149,170,118,170,221,169,85,169,85,170,
+85,122,149,106,218,169,118,167,85,165,85,105,85,122,149,106,106,167,218,157,86,85,85,101,85,121,149,106,170,157,106,119,
+90,85,86,85,85,117,169,106,170,118,170,221,106,85,90,85,86,117,170,106,170,218,170,118,170,85,170,86,170,122,170,106,
+170,170,151,170,157,170,149,170,149,186,149,170,170,170,93,170,119,170,149,170,149,186,149,170,170,170,117,169,221,169,85,170,
+85,122,85,106,170,170,214,165,117,167,85,105,85,122,85,106,170,170,90,151,214,93,85,101,85,121,85,106,170,170,106,93,
+90,119,86,85,169,122,169,106,170,170,170,117,106,221,90,85,170,122,170,106,170,170,170,214,170,117,170,86,170,122,170,106,
+170,170,170,170,151,170,157,170,149,186,149,170,170,170,170,170,157,170,183,170,149,186,149,170,170,170,170,170,117,170,221,170,
+85,122,85,106,170,170,170,170,213,169,117,107,85,122,85,106,170,170,170,170,86,103,213,109,85,121,85,105,170,170,170,170,
+90,93,86,119,85,117,169,106,170,170,170,170,106,117,90,221,86,117,86,85,170,170,170,170,170,217,170,118,170,122,170,106,
+170,170,170,170,170,170,151,170,157,186,149,170,170,170,170,170,170,170,157,170,183,186,149,170,170,170,170,170,170,170,117,170,
+221,186,85,170,170,170,170,170,170,170,213,170,117,187,85,170,170,170,170,170,170,170,85,171,213,189,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,151,186,157,170,170,170,170,170,170,170,170,170,157,186,183,170,170,170,170,170,170,170,170,170,
+117,186,221,170,170,170,170,170,170,170,170,170,213,186,117,171,170,170,170,170,170,170,170,170,85,187,213,173,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,186,171,170,170,170,170,170,170,170,170,170,170,186,174,170,170,170,170,170,170,170,170,170,
+170,186,186,170,170,170,170,170,170,170,170,170,170,186,234,170,170,170,170,170,170,170,170,170,170,186,170,171,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,
+170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,
+170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,
+173,170,149,170,149,170,149,170,149,234,149,170,183,170,85,170,85,170,85,170,85,234,149,170,222,170,85,169,85,169,85,170,
+85,234,149,106,122,171,86,165,85,165,85,105,85,234,149,106,234,173,90,149,86,85,85,101,85,234,149,106,170,183,106,85,
+90,85,86,85,85,234,149,106,170,222,170,85,106,85,90,85,170,234,170,106,170,122,170,86,170,85,106,85,170,234,170,106,
+167,170,157,170,149,170,149,170,149,234,149,170,157,170,119,170,85,170,85,170,85,234,85,170,118,170,221,169,85,169,85,170,
+85,234,85,106,218,169,118,167,85,165,85,105,85,233,85,106,106,167,218,157,86,85,85,101,85,233,85,106,170,157,106,119,
+90,85,86,85,85,229,85,106,170,118,170,221,106,85,90,85,86,213,170,106,170,218,170,118,170,85,106,85,90,213,170,106,
+170,170,151,170,157,170,149,170,149,234,149,170,170,170,93,170,119,170,85,170,85,234,85,170,170,170,117,169,221,169,85,170,
+85,234,85,106,170,170,214,165,117,167,85,105,85,233,85,105,170,170,90,151,214,93,85,101,85,233,85,105,170,170,106,93,
+90,119,86,85,85,229,85,105,170,170,170,117,106,221,90,85,170,234,170,106,170,170,170,214,170,117,106,85,170,234,170,106,
+170,170,170,170,151,170,157,170,149,234,149,170,170,170,170,170,93,170,119,170,85,234,85,170,170,170,170,170,117,170,221,170,
+85,234,85,106,170,170,170,170,213,169,117,107,85,233,85,105,170,170,170,170,86,103,213,109,85,233,85,105,170,170,170,170,
+90,93,86,119,85,229,85,101,170,170,170,170,106,117,90,221,86,213,170,106,170,170,170,170,170,213,106,117,90,213,90,85,
+170,170,170,170,170,170,151,170,157,234,149,170,170,170,170,170,170,170,93,170,119,234,85,170,170,170,170,170,170,170,117,170,
+221,234,85,170,170,170,170,170,170,170,213,169,117,235,85,169,170,170,170,170,170,170,85,171,213,237,85,169,170,170,170,170,
+170,170,86,109,85,247,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,151,234,157,170,170,170,170,170,170,170,170,170,93,234,119,170,170,170,170,170,170,170,170,170,
+117,234,221,170,170,170,170,170,170,170,170,170,213,233,117,171,170,170,170,170,170,170,170,170,85,235,213,173,170,170,170,170,
+170,170,170,170,85,237,85,119,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,234,171,170,170,170,170,170,170,170,170,170,170,234,174,170,170,170,170,170,170,170,170,170,
+170,234,186,170,170,170,170,170,170,170,170,170,170,234,234,170,170,170,170,170,170,170,170,170,170,234,170,171,170,170,170,170,
+170,170,170,170,170,234,170,174,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,
+170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,
+170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,
+173,170,149,170,85,170,85,169,85,165,171,170,183,170,85,170,85,169,85,165,85,149,171,170,222,170,85,169,85,165,85,149,
+85,85,171,86,122,171,86,165,85,149,85,85,89,85,171,86,234,173,90,149,86,85,89,85,105,85,171,86,170,183,106,85,
+90,85,106,85,169,85,171,86,170,222,170,85,106,85,170,85,170,85,171,86,170,122,170,86,170,85,170,86,170,86,171,86,
+167,170,157,170,85,170,85,169,85,165,171,170,157,170,119,170,85,169,85,165,85,149,171,170,118,170,221,169,85,165,85,149,
+85,85,171,85,218,169,118,167,85,149,85,85,89,85,171,85,106,167,218,157,86,85,89,85,105,85,171,85,170,157,106,119,
+90,85,106,85,169,85,171,85,170,118,170,221,106,85,170,85,170,85,171,85,170,218,170,118,170,85,170,86,170,86,171,86,
+170,170,151,170,93,170,85,169,85,165,87,165,170,170,93,170,119,169,85,165,85,149,87,149,170,170,117,169,221,165,85,149,
+85,85,91,85,170,170,214,165,117,151,85,85,89,85,107,85,170,170,90,151,214,93,89,85,105,85,107,85,170,170,106,93,
+90,119,106,85,169,85,171,85,170,170,170,117,106,221,170,85,170,85,171,85,170,170,170,214,170,117,170,86,170,86,171,86,
+170,170,170,170,87,170,93,169,85,165,171,170,170,170,170,170,93,169,119,165,85,149,171,170,170,170,170,170,117,165,221,149,
+85,85,91,85,170,170,170,170,213,149,117,87,89,85,107,85,170,170,170,170,86,87,217,93,105,85,107,85,170,170,170,170,
+90,93,106,119,169,85,171,85,170,170,170,170,106,117,170,221,170,85,171,85,170,170,170,170,170,213,170,118,170,86,171,86,
+170,170,170,170,170,170,87,169,93,165,87,165,170,170,170,170,170,170,93,165,119,149,87,149,170,170,170,170,170,170,117,149,
+221,85,91,85,170,170,170,170,170,170,217,85,121,87,107,85,170,170,170,170,170,170,105,87,233,93,107,85,170,170,170,170,
+170,170,170,93,169,119,171,85,170,170,170,170,170,170,170,117,170,221,171,85,170,170,170,170,170,170,170,214,170,118,171,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,
+121,85,223,85,170,170,170,170,170,170,170,170,234,85,123,87,170,170,170,170,170,170,170,170,106,87,235,93,170,170,170,170,
+170,170,170,170,170,93,171,119,170,170,170,170,170,170,170,170,170,117,171,221,170,170,170,170,170,170,170,170,170,214,171,118,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,
+170,170,187,170,170,170,170,170,170,170,170,170,170,170,235,170,170,170,170,170,170,170,170,170,170,170,171,171,170,170,170,170,
+170,170,170,170,170,170,171,174,170,170,170,170,170,170,170,170,170,170,171,186,170,170,170,170,170,170,170,170,170,170,171,234,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,
+170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,
+170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,
+173,170,149,170,85,170,85,170,149,170,173,170,183,170,85,170,85,169,85,165,85,149,173,170,222,170,85,169,85,165,85,149,
+85,85,173,106,122,171,86,165,85,149,85,85,89,85,173,90,234,173,90,149,86,85,89,85,105,85,173,90,170,183,106,85,
+90,85,106,85,169,85,173,90,170,222,170,85,106,85,170,85,170,86,174,90,170,122,170,86,170,85,170,86,170,86,174,90,
+167,170,157,170,85,170,85,170,149,170,173,170,157,170,119,170,85,169,85,165,85,149,173,170,118,170,221,169,85,165,85,149,
+85,85,173,106,218,169,118,167,85,149,85,85,89,85,173,86,106,167,218,157,86,85,89,85,105,85,173,86,170,157,106,119,
+90,85,106,85,169,85,173,86,170,118,170,221,106,85,170,85,170,86,174,86,170,218,170,118,170,85,170,86,170,86,174,86,
+170,170,151,170,93,170,85,170,149,170,173,170,170,170,93,170,119,169,85,165,85,149,93,149,170,170,117,169,221,165,85,149,
+85,85,93,85,170,170,214,165,117,151,85,85,89,85,109,85,170,170,90,151,214,93,89,85,105,85,173,85,170,170,106,93,
+90,119,106,85,169,85,173,85,170,170,170,117,106,221,170,85,170,86,174,86,170,170,170,214,170,117,170,86,170,86,174,86,
+170,170,170,170,87,170,93,170,149,170,173,170,170,170,170,170,93,169,119,165,85,149,173,170,170,170,170,170,117,165,221,149,
+85,85,173,106,170,170,170,170,213,149,117,87,89,85,109,85,170,170,170,170,86,87,217,93,105,85,173,85,170,170,170,170,
+90,93,106,119,169,85,173,85,170,170,170,170,106,117,170,221,170,86,174,86,170,170,170,170,170,213,170,118,170,86,174,86,
+170,170,170,170,170,170,103,170,157,170,173,170,170,170,170,170,170,170,93,165,119,149,93,149,170,170,170,170,170,170,117,149,
+221,85,93,85,170,170,170,170,170,170,217,85,121,87,109,85,170,170,170,170,170,170,105,87,233,93,173,85,170,170,170,170,
+170,170,170,93,169,119,173,85,170,170,170,170,170,170,170,118,170,222,174,86,170,170,170,170,170,170,170,214,170,118,174,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,170,170,234,85,126,87,170,170,170,170,170,170,170,170,170,87,238,93,170,170,170,170,
+170,170,170,170,170,93,174,119,170,170,170,170,170,170,170,170,170,118,174,222,170,170,170,170,170,170,170,170,170,214,174,118,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,170,170,170,170,238,170,170,170,170,170,170,170,170,170,170,170,174,171,170,170,170,170,
+170,170,170,170,170,170,174,174,170,170,170,170,170,170,170,170,170,170,174,186,170,170,170,170,170,170,170,170,170,170,174,234,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,
+170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,
+173,170,149,170,85,170,149,170,165,170,185,170,183,170,85,170,85,169,85,169,85,170,185,170,222,170,85,169,85,165,85,149,
+85,85,185,106,122,171,86,165,85,149,85,85,85,85,185,106,234,173,90,149,86,85,89,85,105,85,185,106,170,183,106,85,
+90,85,106,85,169,85,185,106,170,222,170,85,106,85,170,85,170,86,186,106,170,122,170,86,170,85,170,86,170,90,186,106,
+167,170,157,170,85,170,149,170,165,170,185,170,157,170,119,170,85,169,85,169,85,170,185,170,118,170,221,169,85,165,85,149,
+85,85,185,106,218,169,118,167,85,149,85,85,85,85,185,106,106,167,218,157,86,85,89,85,105,85,185,90,170,157,106,119,
+90,85,106,85,169,85,185,90,170,118,170,221,106,85,170,85,170,86,186,90,170,218,170,118,170,85,170,86,170,90,186,90,
+170,170,151,170,93,170,149,170,165,170,185,170,170,170,93,170,119,169,85,169,85,170,181,170,170,170,117,169,221,165,85,149,
+85,85,117,85,170,170,214,165,117,151,85,85,85,85,121,85,170,170,90,151,214,93,89,85,105,85,185,85,170,170,106,93,
+90,119,106,85,169,85,185,86,170,170,170,117,106,221,170,85,170,86,186,86,170,170,170,214,170,117,170,86,170,90,186,90,
+170,170,170,170,87,170,157,170,165,170,185,170,170,170,170,170,93,169,119,169,85,170,185,170,170,170,170,170,117,165,221,149,
+85,85,185,106,170,170,170,170,213,149,117,87,85,85,185,106,170,170,170,170,86,87,217,93,105,85,185,85,170,170,170,170,
+90,93,106,119,169,85,185,86,170,170,170,170,106,117,170,221,170,86,186,86,170,170,170,170,170,213,170,118,170,90,186,90,
+170,170,170,170,170,170,167,170,173,170,185,170,170,170,170,170,170,170,157,169,119,170,181,170,170,170,170,170,170,170,117,149,
+221,85,117,85,170,170,170,170,170,170,217,85,117,87,121,85,170,170,170,170,170,170,105,87,233,93,185,85,170,170,170,170,
+170,170,170,93,169,119,185,86,170,170,170,170,170,170,170,118,170,222,186,86,170,170,170,170,170,170,170,218,170,122,186,90,
+170,170,170,170,170,170,170,170,171,170,189,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,87,250,93,170,170,170,170,
+170,170,170,170,170,94,186,119,170,170,170,170,170,170,170,170,170,118,186,222,170,170,170,170,170,170,170,170,170,218,186,122,
+170,170,170,170,170,170,170,170,170,170,187,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,186,171,170,170,170,170,
+170,170,170,170,170,170,186,174,170,170,170,170,170,170,170,170,170,170,186,186,170,170,170,170,170,170,170,170,170,170,186,234,
+170,170,170,170,170,170,170,170,170,170,186,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,
+170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,
+173,170,149,170,85,170,149,170,165,170,233,170,183,170,85,170,85,169,85,170,149,170,233,170,222,170,85,169,85,165,85,165,
+85,105,233,106,122,171,86,165,85,149,85,85,85,85,233,106,234,173,90,149,86,85,85,85,89,85,233,106,170,183,106,85,
+90,85,106,85,169,85,233,106,170,222,170,85,106,85,170,85,170,86,234,106,170,122,170,86,170,85,170,86,170,90,234,106,
+167,170,157,170,85,170,149,170,165,170,233,170,157,170,119,170,85,169,85,170,149,170,233,170,118,170,221,169,85,165,85,165,
+85,105,233,106,218,169,118,167,85,149,85,85,85,85,233,106,106,167,218,157,86,85,85,85,89,85,233,106,170,157,106,119,
+90,85,106,85,169,85,233,106,170,118,170,221,106,85,170,85,170,86,234,106,170,218,170,118,170,85,170,86,170,90,234,106,
+170,170,151,170,93,170,149,170,165,170,233,170,170,170,93,170,119,169,85,170,149,170,229,170,170,170,117,169,221,165,85,165,
+85,105,213,106,170,170,214,165,117,151,85,85,85,85,213,85,170,170,90,151,214,93,85,85,89,85,233,85,170,170,106,93,
+90,119,106,85,169,85,233,86,170,170,170,117,106,221,170,85,170,86,234,90,170,170,170,214,170,117,170,86,170,90,234,90,
+170,170,170,170,87,170,157,170,165,170,233,170,170,170,170,170,93,169,119,170,149,170,229,170,170,170,170,170,117,165,221,165,
+85,105,233,106,170,170,170,170,213,149,117,87,85,85,233,106,170,170,170,170,86,87,213,93,89,85,233,106,170,170,170,170,
+90,93,106,119,169,85,233,86,170,170,170,170,106,117,170,221,170,86,234,90,170,170,170,170,170,213,170,118,170,90,234,90,
+170,170,170,170,170,170,167,170,173,170,233,170,170,170,170,170,170,170,157,170,183,170,229,170,170,170,170,170,170,170,117,166,
+221,105,213,106,170,170,170,170,170,170,213,85,117,87,213,85,170,170,170,170,170,170,101,87,217,93,233,85,170,170,170,170,
+170,170,170,93,169,119,233,86,170,170,170,170,170,170,170,118,170,222,234,90,170,170,170,170,170,170,170,218,170,122,234,90,
+170,170,170,170,170,170,170,170,171,170,237,170,170,170,170,170,170,170,170,170,173,170,247,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,170,170,94,234,119,170,170,170,170,170,170,170,170,170,122,234,222,170,170,170,170,170,170,170,170,170,218,234,122,
+170,170,170,170,170,170,170,170,170,170,235,170,170,170,170,170,170,170,170,170,170,170,238,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,170,170,170,234,174,170,170,170,170,170,170,170,170,170,170,234,186,170,170,170,170,170,170,170,170,170,170,234,234,
+170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,
+173,170,149,170,85,170,149,170,165,170,169,171,183,170,85,170,85,169,85,170,149,170,169,171,222,170,85,169,85,165,85,169,
+85,106,169,107,122,171,86,165,85,149,85,85,85,101,169,107,234,173,90,149,86,85,85,85,85,85,169,107,170,183,106,85,
+90,85,90,85,105,85,169,107,170,222,170,85,106,85,170,85,170,86,170,107,170,122,170,86,170,85,170,86,170,90,170,107,
+167,170,157,170,85,170,149,170,165,170,169,171,157,170,119,170,85,169,85,170,149,170,169,171,118,170,221,169,85,165,85,169,
+85,106,169,107,218,169,118,167,85,149,85,85,85,101,169,107,106,167,218,157,86,85,85,85,85,85,169,107,170,157,106,119,
+90,85,90,85,105,85,169,107,170,118,170,221,106,85,170,85,170,86,170,107,170,218,170,118,170,85,170,86,170,90,170,107,
+170,170,151,170,93,170,149,170,165,170,165,171,170,170,93,170,119,169,85,170,149,170,165,171,170,170,117,169,221,165,85,169,
+85,106,149,107,170,170,214,165,117,151,85,85,85,101,85,107,170,170,90,151,214,93,85,85,85,85,85,87,170,170,106,93,
+90,119,90,85,105,85,169,87,170,170,170,117,106,221,170,85,170,86,170,91,170,170,170,214,170,117,170,86,170,90,170,107,
+170,170,170,170,87,170,157,170,165,170,165,171,170,170,170,170,93,169,119,170,149,170,165,171,170,170,170,170,117,165,221,169,
+85,106,149,107,170,170,170,170,213,149,117,87,85,101,169,107,170,170,170,170,86,87,213,93,85,85,169,107,170,170,170,170,
+90,93,90,119,105,85,169,107,170,170,170,170,106,117,170,221,170,86,170,91,170,170,170,170,170,213,170,118,170,90,170,107,
+170,170,170,170,170,170,167,170,173,170,165,171,170,170,170,170,170,170,157,170,183,170,165,171,170,170,170,170,170,170,117,170,
+221,106,149,107,170,170,170,170,170,170,213,89,117,103,85,107,170,170,170,170,170,170,85,87,213,93,85,87,170,170,170,170,
+170,170,154,93,105,119,169,87,170,170,170,170,170,170,170,118,170,222,170,91,170,170,170,170,170,170,170,218,170,122,170,107,
+170,170,170,170,170,170,170,170,167,170,173,171,170,170,170,170,170,170,170,170,173,170,183,171,170,170,170,170,170,170,170,170,
+181,170,221,171,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,122,170,223,170,170,170,170,170,170,170,170,170,234,170,123,
+170,170,170,170,170,170,170,170,170,170,171,171,170,170,170,170,170,170,170,170,170,170,174,171,170,170,170,170,170,170,170,170,
+170,170,186,171,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,187,170,170,170,170,170,170,170,170,170,170,170,235,
+170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,
+170,170,170,171,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,
+173,170,149,170,85,170,149,170,165,170,169,174,183,170,85,170,85,169,85,170,149,170,169,174,222,170,85,169,85,165,85,169,
+85,106,169,110,122,171,86,165,85,149,85,101,85,105,169,110,234,173,90,149,86,85,85,85,85,85,169,110,170,183,106,85,
+90,85,86,85,85,85,169,110,170,222,170,85,106,85,106,85,170,85,170,110,170,122,170,86,170,85,170,86,170,90,170,110,
+167,170,157,170,85,170,149,170,165,170,165,174,157,170,119,170,85,169,85,170,149,170,165,174,118,170,221,169,85,165,85,169,
+85,106,165,110,218,169,118,167,85,149,85,101,85,105,165,110,106,167,218,157,86,85,85,85,85,85,169,110,170,157,106,119,
+90,85,86,85,85,85,169,110,170,118,170,221,106,85,106,85,170,85,170,110,170,218,170,118,170,85,170,86,170,90,170,110,
+170,170,151,170,93,170,149,170,165,170,165,174,170,170,93,170,119,169,85,170,149,170,149,174,170,170,117,169,221,165,85,169,
+85,106,149,110,170,170,214,165,117,151,85,101,85,105,85,110,170,170,90,151,214,93,85,85,85,85,85,109,170,170,106,93,
+90,119,86,85,85,85,85,93,170,170,170,117,106,221,106,85,170,85,170,94,170,170,170,214,170,117,170,86,170,90,170,110,
+170,170,170,170,87,170,157,170,165,170,165,174,170,170,170,170,93,169,119,170,149,170,149,174,170,170,170,170,117,165,221,169,
+85,106,149,110,170,170,170,170,213,149,117,103,85,105,85,110,170,170,170,170,86,87,213,93,85,85,169,110,170,170,170,170,
+90,93,86,119,85,85,169,110,170,170,170,170,106,117,106,221,170,85,170,110,170,170,170,170,170,213,170,118,170,90,170,110,
+170,170,170,170,170,170,167,170,173,170,165,174,170,170,170,170,170,170,157,170,183,170,149,174,170,170,170,170,170,170,117,170,
+221,106,149,110,170,170,170,170,170,170,213,105,117,107,85,110,170,170,170,170,170,170,85,103,213,93,85,109,170,170,170,170,
+170,170,86,93,85,119,85,93,170,170,170,170,170,170,106,118,170,221,170,94,170,170,170,170,170,170,170,218,170,122,170,110,
+170,170,170,170,170,170,170,170,167,170,173,174,170,170,170,170,170,170,170,170,157,170,183,174,170,170,170,170,170,170,170,170,
+181,170,221,174,170,170,170,170,170,170,170,170,213,170,117,175,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,234,170,126,
+170,170,170,170,170,170,170,170,170,170,171,174,170,170,170,170,170,170,170,170,170,170,174,174,170,170,170,170,170,170,170,170,
+170,170,186,174,170,170,170,170,170,170,170,170,170,170,234,174,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,238,
+170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,
+170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,174,
+173,170,149,170,85,170,149,170,149,170,165,186,183,170,85,170,85,169,85,170,149,170,165,186,222,170,85,169,85,165,85,169,
+85,106,165,122,122,171,86,165,85,149,85,101,85,105,165,122,234,173,90,149,86,85,85,85,85,101,165,122,170,183,106,85,
+90,85,86,85,85,85,169,122,170,222,170,85,106,85,90,85,86,85,170,122,170,122,170,86,170,85,170,85,170,86,170,122,
+167,170,157,170,85,170,149,170,149,170,149,186,157,170,119,170,85,169,85,170,149,170,149,186,118,170,221,169,85,165,85,169,
+85,106,149,122,218,169,118,167,85,149,85,101,85,105,149,122,106,167,218,157,86,85,85,85,85,101,149,122,170,157,106,119,
+90,85,86,85,85,85,169,122,170,118,170,221,106,85,90,85,86,85,170,122,170,218,170,118,170,85,170,85,170,86,170,122,
+170,170,151,170,93,170,149,170,149,170,149,186,170,170,93,170,119,169,85,170,149,170,149,186,170,170,117,169,221,165,85,169,
+85,106,85,122,170,170,214,165,117,151,85,101,85,105,85,122,170,170,90,151,214,93,85,85,85,101,85,121,170,170,106,93,
+90,119,86,85,85,85,85,117,170,170,170,117,106,221,90,85,86,85,86,117,170,170,170,214,170,117,170,85,170,86,170,122,
+170,170,170,170,87,170,157,170,149,170,149,186,170,170,170,170,93,169,119,170,149,170,149,186,170,170,170,170,117,165,221,169,
+85,106,85,122,170,170,170,170,213,149,117,103,85,105,85,122,170,170,170,170,86,87,213,93,85,101,85,121,170,170,170,170,
+90,93,86,119,85,85,169,122,170,170,170,170,106,117,90,221,86,85,170,122,170,170,170,170,170,213,170,117,170,86,170,122,
+170,170,170,170,170,170,151,170,157,170,149,186,170,170,170,170,170,170,157,170,183,170,149,186,170,170,170,170,170,170,117,170,
+221,106,85,122,170,170,170,170,170,170,213,105,117,107,85,122,170,170,170,170,170,170,85,103,213,109,85,121,170,170,170,170,
+170,170,86,93,85,119,85,117,170,170,170,170,170,170,90,117,86,221,86,117,170,170,170,170,170,170,170,217,170,118,170,122,
+170,170,170,170,170,170,170,170,151,170,157,186,170,170,170,170,170,170,170,170,157,170,183,186,170,170,170,170,170,170,170,170,
+117,170,221,186,170,170,170,170,170,170,170,170,213,170,117,187,170,170,170,170,170,170,170,170,85,171,213,189,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,170,171,186,170,170,170,170,170,170,170,170,170,170,174,186,170,170,170,170,170,170,170,170,
+170,170,186,186,170,170,170,170,170,170,170,170,170,170,234,186,170,170,170,170,170,170,170,170,170,170,170,187,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,
+170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+173,170,149,170,85,170,149,170,149,170,149,234,183,170,85,170,85,169,85,170,85,170,149,234,222,170,85,169,85,165,85,169,
+85,106,149,234,122,171,86,165,85,149,85,101,85,105,149,234,234,173,90,149,86,85,85,85,85,101,149,234,170,183,106,85,
+90,85,86,85,85,85,149,234,170,222,170,85,106,85,90,85,86,85,170,234,170,122,170,86,170,85,106,85,90,85,170,234,
+167,170,157,170,85,170,149,170,149,170,149,234,157,170,119,170,85,169,85,170,85,170,85,234,118,170,221,169,85,165,85,169,
+85,106,85,234,218,169,118,167,85,149,85,101,85,105,85,234,106,167,218,157,86,85,85,85,85,101,85,234,170,157,106,119,
+90,85,86,85,85,85,85,234,170,118,170,221,106,85,90,85,86,85,170,234,170,218,170,118,170,85,106,85,90,85,170,234,
+170,170,151,170,93,170,149,170,149,170,149,234,170,170,93,170,119,169,85,170,85,170,85,234,170,170,117,169,221,165,85,169,
+85,106,85,234,170,170,214,165,117,151,85,101,85,105,85,233,170,170,90,151,214,93,85,85,85,101,85,233,170,170,106,93,
+90,119,86,85,85,85,85,229,170,170,170,117,106,221,90,85,86,85,86,213,170,170,170,214,170,117,106,85,90,85,90,213,
+170,170,170,170,87,170,157,170,149,170,149,234,170,170,170,170,93,169,119,170,85,170,85,234,170,170,170,170,117,165,221,169,
+85,106,85,234,170,170,170,170,213,149,117,103,85,105,85,233,170,170,170,170,86,87,213,93,85,101,85,233,170,170,170,170,
+90,93,86,119,85,85,85,229,170,170,170,170,106,117,90,221,86,85,170,234,170,170,170,170,170,213,106,117,90,85,170,234,
+170,170,170,170,170,170,151,170,157,170,149,234,170,170,170,170,170,170,93,170,119,170,85,234,170,170,170,170,170,170,117,170,
+221,106,85,234,170,170,170,170,170,170,213,105,117,107,85,233,170,170,170,170,170,170,85,103,213,109,85,233,170,170,170,170,
+170,170,86,93,85,119,85,229,170,170,170,170,170,170,90,117,86,221,86,213,170,170,170,170,170,170,106,213,90,117,90,213,
+170,170,170,170,170,170,170,170,151,170,157,234,170,170,170,170,170,170,170,170,93,170,119,234,170,170,170,170,170,170,170,170,
+117,170,221,234,170,170,170,170,170,170,170,170,213,169,117,235,170,170,170,170,170,170,170,170,85,171,213,237,170,170,170,170,
+170,170,170,170,85,109,85,247,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,170,171,234,170,170,170,170,170,170,170,170,170,170,174,234,170,170,170,170,170,170,170,170,
+170,170,186,234,170,170,170,170,170,170,170,170,170,170,234,234,170,170,170,170,170,170,170,170,170,170,170,235,170,170,170,170,
+170,170,170,170,170,170,170,238,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,
+170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,
+170,170,170,170,170,170,170,234,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+173,170,149,170,85,170,85,169,85,165,169,170,183,170,85,170,85,169,85,165,85,149,169,170,222,170,85,169,85,165,85,149,
+85,85,169,86,122,171,86,165,85,149,85,85,85,85,169,86,234,173,90,149,86,85,85,85,89,85,169,86,170,183,106,85,
+90,85,90,85,105,85,169,86,170,222,170,85,106,85,106,85,170,85,170,86,170,122,170,86,170,85,170,85,170,86,170,86,
+167,170,157,170,85,170,85,169,85,165,85,165,157,170,119,170,85,169,85,165,85,149,85,149,118,170,221,169,85,165,85,149,
+85,85,85,85,218,169,118,167,85,149,85,85,85,85,89,85,106,167,218,157,86,85,85,85,89,85,105,85,170,157,106,119,
+90,85,90,85,105,85,169,85,170,118,170,221,106,85,106,85,170,85,170,85,170,218,170,118,170,85,170,85,170,86,170,86,
+170,170,151,170,93,170,85,169,85,165,85,165,170,170,93,170,119,169,85,165,85,149,85,149,170,170,117,169,221,165,85,149,
+85,85,85,85,170,170,214,165,117,151,85,85,85,85,89,85,170,170,90,151,214,93,85,85,89,85,105,85,170,170,106,93,
+90,119,90,85,105,85,169,85,170,170,170,117,106,221,106,85,170,85,170,85,170,170,170,214,170,117,170,85,170,86,170,86,
+170,170,170,170,87,170,93,169,85,165,85,165,170,170,170,170,93,169,119,165,85,149,85,149,170,170,170,170,117,165,221,149,
+85,85,85,85,170,170,170,170,213,149,117,87,85,85,89,85,170,170,170,170,86,87,213,93,89,85,105,85,170,170,170,170,
+90,93,90,119,105,85,169,85,170,170,170,170,106,117,106,221,170,85,170,85,170,170,170,170,170,213,170,117,170,86,170,86,
+170,170,170,170,170,170,87,169,93,165,85,165,170,170,170,170,170,170,93,165,119,149,85,149,170,170,170,170,170,170,117,149,
+221,85,85,85,170,170,170,170,170,170,213,85,117,87,89,85,170,170,170,170,170,170,85,87,217,93,105,85,170,170,170,170,
+170,170,90,93,105,119,169,85,170,170,170,170,170,170,106,117,170,221,170,85,170,170,170,170,170,170,170,213,170,118,170,86,
+170,170,170,170,170,170,170,170,87,165,93,165,170,170,170,170,170,170,170,170,93,149,119,149,170,170,170,170,170,170,170,170,
+117,85,221,85,170,170,170,170,170,170,170,170,217,85,121,87,170,170,170,170,170,170,170,170,105,87,233,93,170,170,170,170,
+170,170,170,170,169,93,169,119,170,170,170,170,170,170,170,170,170,117,170,221,170,170,170,170,170,170,170,170,170,214,170,118,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+173,170,149,170,85,170,85,169,85,170,169,170,183,170,85,170,85,169,85,165,85,149,169,170,222,170,85,169,85,165,85,149,
+85,85,169,106,122,171,86,165,85,149,85,85,85,85,169,90,234,173,90,149,86,85,85,85,89,85,169,90,170,183,106,85,
+90,85,90,85,105,85,169,90,170,222,170,85,106,85,106,85,170,85,170,90,170,122,170,86,170,85,170,85,170,86,170,90,
+167,170,157,170,85,170,85,169,85,170,149,170,157,170,119,170,85,169,85,165,85,149,85,149,118,170,221,169,85,165,85,149,
+85,85,85,85,218,169,118,167,85,149,85,85,85,85,89,85,106,167,218,157,86,85,85,85,89,85,105,85,170,157,106,119,
+90,85,90,85,105,85,169,85,170,118,170,221,106,85,106,85,170,85,170,86,170,218,170,118,170,85,170,85,170,86,170,86,
+170,170,151,170,93,170,85,169,85,170,149,170,170,170,93,170,119,169,85,165,85,149,85,149,170,170,117,169,221,165,85,149,
+85,85,85,85,170,170,214,165,117,151,85,85,85,85,89,85,170,170,90,151,214,93,85,85,89,85,105,85,170,170,106,93,
+90,119,90,85,105,85,169,85,170,170,170,117,106,221,106,85,170,85,170,86,170,170,170,214,170,117,170,85,170,86,170,86,
+170,170,170,170,87,170,93,169,85,170,149,170,170,170,170,170,93,169,119,165,85,149,85,149,170,170,170,170,117,165,221,149,
+85,85,85,85,170,170,170,170,213,149,117,87,85,85,89,85,170,170,170,170,86,87,213,93,89,85,105,85,170,170,170,170,
+90,93,90,119,105,85,169,85,170,170,170,170,106,117,106,221,170,85,170,86,170,170,170,170,170,213,170,117,170,86,170,86,
+170,170,170,170,170,170,87,169,93,170,149,170,170,170,170,170,170,170,93,165,119,149,85,149,170,170,170,170,170,170,117,149,
+221,85,85,85,170,170,170,170,170,170,213,85,117,87,89,85,170,170,170,170,170,170,85,87,217,93,105,85,170,170,170,170,
+170,170,90,93,105,119,169,85,170,170,170,170,170,170,106,117,170,221,170,86,170,170,170,170,170,170,170,213,170,118,170,86,
+170,170,170,170,170,170,170,170,103,170,157,170,170,170,170,170,170,170,170,170,93,149,119,149,170,170,170,170,170,170,170,170,
+117,85,221,85,170,170,170,170,170,170,170,170,217,85,121,87,170,170,170,170,170,170,170,170,105,87,233,93,170,170,170,170,
+170,170,170,170,169,93,169,119,170,170,170,170,170,170,170,170,170,118,170,222,170,170,170,170,170,170,170,170,170,214,170,118,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+173,170,149,170,85,170,85,170,149,170,169,170,183,170,85,170,85,169,85,165,85,169,169,170,222,170,85,169,85,165,85,149,
+85,85,169,106,122,171,86,165,85,149,85,85,85,85,169,106,234,173,90,149,86,85,85,85,89,85,169,106,170,183,106,85,
+90,85,90,85,105,85,169,106,170,222,170,85,106,85,106,85,170,85,170,106,170,122,170,86,170,85,170,85,170,86,170,106,
+167,170,157,170,85,170,85,170,149,170,165,170,157,170,119,170,85,169,85,165,85,169,85,170,118,170,221,169,85,165,85,149,
+85,85,85,85,218,169,118,167,85,149,85,85,85,85,85,85,106,167,218,157,86,85,85,85,89,85,105,85,170,157,106,119,
+90,85,90,85,105,85,169,85,170,118,170,221,106,85,106,85,170,85,170,86,170,218,170,118,170,85,170,85,170,86,170,90,
+170,170,151,170,93,170,85,170,149,170,165,170,170,170,93,170,119,169,85,165,85,169,85,170,170,170,117,169,221,165,85,149,
+85,85,85,85,170,170,214,165,117,151,85,85,85,85,85,85,170,170,90,151,214,93,85,85,89,85,105,85,170,170,106,93,
+90,119,90,85,105,85,169,85,170,170,170,117,106,221,106,85,170,85,170,86,170,170,170,214,170,117,170,85,170,86,170,90,
+170,170,170,170,87,170,93,170,149,170,165,170,170,170,170,170,93,169,119,165,85,169,85,170,170,170,170,170,117,165,221,149,
+85,85,85,85,170,170,170,170,213,149,117,87,85,85,85,85,170,170,170,170,86,87,213,93,89,85,105,85,170,170,170,170,
+90,93,90,119,105,85,169,85,170,170,170,170,106,117,106,221,170,85,170,86,170,170,170,170,170,213,170,117,170,86,170,90,
+170,170,170,170,170,170,87,170,157,170,165,170,170,170,170,170,170,170,93,165,119,169,85,170,170,170,170,170,170,170,117,149,
+221,85,85,85,170,170,170,170,170,170,213,85,117,87,85,85,170,170,170,170,170,170,85,87,217,93,105,85,170,170,170,170,
+170,170,90,93,105,119,169,85,170,170,170,170,170,170,106,117,170,221,170,86,170,170,170,170,170,170,170,213,170,118,170,90,
+170,170,170,170,170,170,170,170,167,170,173,170,170,170,170,170,170,170,170,170,157,169,119,170,170,170,170,170,170,170,170,170,
+117,85,221,85,170,170,170,170,170,170,170,170,217,85,117,87,170,170,170,170,170,170,170,170,105,87,233,93,170,170,170,170,
+170,170,170,170,169,93,169,119,170,170,170,170,170,170,170,170,170,118,170,222,170,170,170,170,170,170,170,170,170,218,170,122,
+170,170,170,170,170,170,170,170,170,170,171,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+173,170,149,170,85,170,85,170,149,170,169,170,183,170,85,170,85,169,85,169,85,170,169,170,222,170,85,169,85,165,85,149,
+85,101,169,106,122,171,86,165,85,149,85,85,85,85,169,106,234,173,90,149,86,85,85,85,85,85,169,106,170,183,106,85,
+90,85,90,85,105,85,169,106,170,222,170,85,106,85,106,85,170,85,170,106,170,122,170,86,170,85,170,85,170,86,170,106,
+167,170,157,170,85,170,85,170,149,170,165,170,157,170,119,170,85,169,85,169,85,170,149,170,118,170,221,169,85,165,85,149,
+85,101,85,105,218,169,118,167,85,149,85,85,85,85,85,85,106,167,218,157,86,85,85,85,85,85,89,85,170,157,106,119,
+90,85,90,85,105,85,169,85,170,118,170,221,106,85,106,85,170,85,170,86,170,218,170,118,170,85,170,85,170,86,170,90,
+170,170,151,170,93,170,85,170,149,170,165,170,170,170,93,170,119,169,85,169,85,170,149,170,170,170,117,169,221,165,85,149,
+85,101,85,105,170,170,214,165,117,151,85,85,85,85,85,85,170,170,90,151,214,93,85,85,85,85,89,85,170,170,106,93,
+90,119,90,85,105,85,169,85,170,170,170,117,106,221,106,85,170,85,170,86,170,170,170,214,170,117,170,85,170,86,170,90,
+170,170,170,170,87,170,93,170,149,170,165,170,170,170,170,170,93,169,119,169,85,170,149,170,170,170,170,170,117,165,221,149,
+85,101,85,105,170,170,170,170,213,149,117,87,85,85,85,85,170,170,170,170,86,87,213,93,85,85,89,85,170,170,170,170,
+90,93,90,119,105,85,169,85,170,170,170,170,106,117,106,221,170,85,170,86,170,170,170,170,170,213,170,117,170,86,170,90,
+170,170,170,170,170,170,87,170,157,170,165,170,170,170,170,170,170,170,93,169,119,170,149,170,170,170,170,170,170,170,117,149,
+221,101,85,105,170,170,170,170,170,170,213,85,117,87,85,85,170,170,170,170,170,170,85,87,213,93,89,85,170,170,170,170,
+170,170,90,93,105,119,169,85,170,170,170,170,170,170,106,117,170,221,170,86,170,170,170,170,170,170,170,213,170,118,170,90,
+170,170,170,170,170,170,170,170,167,170,173,170,170,170,170,170,170,170,170,170,157,170,183,170,170,170,170,170,170,170,170,170,
+117,102,221,105,170,170,170,170,170,170,170,170,213,85,117,87,170,170,170,170,170,170,170,170,101,87,217,93,170,170,170,170,
+170,170,170,170,169,93,169,119,170,170,170,170,170,170,170,170,170,118,170,222,170,170,170,170,170,170,170,170,170,218,170,122,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+173,170,149,170,85,170,85,170,149,170,169,170,183,170,85,170,85,169,85,169,85,170,169,170,222,170,85,169,85,165,85,165,
+85,105,169,106,122,171,86,165,85,149,85,85,85,85,169,106,234,173,90,149,86,85,85,85,85,85,169,106,170,183,106,85,
+90,85,86,85,89,85,169,106,170,222,170,85,106,85,106,85,170,85,170,106,170,122,170,86,170,85,170,85,170,86,170,106,
+167,170,157,170,85,170,85,170,149,170,165,170,157,170,119,170,85,169,85,169,85,170,149,170,118,170,221,169,85,165,85,165,
+85,105,85,106,218,169,118,167,85,149,85,85,85,85,85,101,106,167,218,157,86,85,85,85,85,85,85,85,170,157,106,119,
+90,85,86,85,89,85,105,85,170,118,170,221,106,85,106,85,170,85,170,86,170,218,170,118,170,85,170,85,170,86,170,90,
+170,170,151,170,93,170,85,170,149,170,165,170,170,170,93,170,119,169,85,169,85,170,149,170,170,170,117,169,221,165,85,165,
+85,105,85,106,170,170,214,165,117,151,85,85,85,85,85,101,170,170,90,151,214,93,85,85,85,85,85,85,170,170,106,93,
+90,119,86,85,89,85,105,85,170,170,170,117,106,221,106,85,170,85,170,86,170,170,170,214,170,117,170,85,170,86,170,90,
+170,170,170,170,87,170,93,170,149,170,165,170,170,170,170,170,93,169,119,169,85,170,149,170,170,170,170,170,117,165,221,165,
+85,105,85,106,170,170,170,170,213,149,117,87,85,85,85,101,170,170,170,170,86,87,213,93,85,85,85,85,170,170,170,170,
+90,93,86,119,89,85,105,85,170,170,170,170,106,117,106,221,170,85,170,86,170,170,170,170,170,213,170,117,170,86,170,90,
+170,170,170,170,170,170,87,170,157,170,165,170,170,170,170,170,170,170,93,169,119,170,149,170,170,170,170,170,170,170,117,165,
+221,105,85,106,170,170,170,170,170,170,213,85,117,87,85,101,170,170,170,170,170,170,85,87,213,93,85,85,170,170,170,170,
+170,170,86,93,89,119,105,85,170,170,170,170,170,170,106,117,170,221,170,86,170,170,170,170,170,170,170,213,170,118,170,90,
+170,170,170,170,170,170,170,170,167,170,173,170,170,170,170,170,170,170,170,170,157,170,183,170,170,170,170,170,170,170,170,170,
+117,106,221,106,170,170,170,170,170,170,170,170,213,89,117,103,170,170,170,170,170,170,170,170,85,87,213,93,170,170,170,170,
+170,170,170,170,153,93,105,119,170,170,170,170,170,170,170,170,170,118,170,222,170,170,170,170,170,170,170,170,170,218,170,122,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,186,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+173,170,149,170,85,170,85,170,149,170,169,170,183,170,85,170,85,169,85,169,85,170,169,170,222,170,85,169,85,165,85,165,
+85,105,169,106,122,171,86,165,85,149,85,85,85,101,169,106,234,173,90,149,86,85,85,85,85,85,169,106,170,183,106,85,
+90,85,86,85,85,85,169,106,170,222,170,85,106,85,90,85,106,85,170,106,170,122,170,86,170,85,170,85,170,86,170,106,
+167,170,157,170,85,170,85,170,149,170,165,170,157,170,119,170,85,169,85,169,85,170,149,170,118,170,221,169,85,165,85,165,
+85,105,85,106,218,169,118,167,85,149,85,85,85,101,85,105,106,167,218,157,86,85,85,85,85,85,85,85,170,157,106,119,
+90,85,86,85,85,85,85,85,170,118,170,221,106,85,90,85,106,85,170,85,170,218,170,118,170,85,170,85,170,86,170,90,
+170,170,151,170,93,170,85,170,149,170,165,170,170,170,93,170,119,169,85,169,85,170,149,170,170,170,117,169,221,165,85,165,
+85,105,85,106,170,170,214,165,117,151,85,85,85,101,85,105,170,170,90,151,214,93,85,85,85,85,85,85,170,170,106,93,
+90,119,86,85,85,85,85,85,170,170,170,117,106,221,90,85,106,85,170,85,170,170,170,214,170,117,170,85,170,86,170,90,
+170,170,170,170,87,170,93,170,149,170,165,170,170,170,170,170,93,169,119,169,85,170,149,170,170,170,170,170,117,165,221,165,
+85,105,85,106,170,170,170,170,213,149,117,87,85,101,85,105,170,170,170,170,86,87,213,93,85,85,85,85,170,170,170,170,
+90,93,86,119,85,85,85,85,170,170,170,170,106,117,90,221,106,85,170,85,170,170,170,170,170,213,170,117,170,86,170,90,
+170,170,170,170,170,170,87,170,157,170,165,170,170,170,170,170,170,170,93,169,119,170,149,170,170,170,170,170,170,170,117,165,
+221,105,85,106,170,170,170,170,170,170,213,85,117,103,85,105,170,170,170,170,170,170,85,87,213,93,85,85,170,170,170,170,
+170,170,86,93,85,119,85,85,170,170,170,170,170,170,90,117,106,221,170,85,170,170,170,170,170,170,170,213,170,118,170,90,
+170,170,170,170,170,170,170,170,167,170,173,170,170,170,170,170,170,170,170,170,157,170,183,170,170,170,170,170,170,170,170,170,
+117,106,221,106,170,170,170,170,170,170,170,170,213,105,117,107,170,170,170,170,170,170,170,170,85,103,213,93,170,170,170,170,
+170,170,170,170,85,93,85,119,170,170,170,170,170,170,170,170,106,118,170,221,170,170,170,170,170,170,170,170,170,218,170,122,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,234,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,170,
+173,170,149,170,85,170,85,170,149,170,165,170,183,170,85,170,85,169,85,169,85,170,165,170,222,170,85,169,85,165,85,165,
+85,105,165,106,122,171,86,165,85,149,85,85,85,101,165,106,234,173,90,149,86,85,85,85,85,85,165,106,170,183,106,85,
+90,85,86,85,85,85,169,106,170,222,170,85,106,85,90,85,86,85,170,106,170,122,170,86,170,85,106,85,170,85,170,106,
+167,170,157,170,85,170,85,170,149,170,149,170,157,170,119,170,85,169,85,169,85,170,149,170,118,170,221,169,85,165,85,165,
+85,105,85,106,218,169,118,167,85,149,85,85,85,101,85,105,106,167,218,157,86,85,85,85,85,85,85,101,170,157,106,119,
+90,85,86,85,85,85,85,85,170,118,170,221,106,85,90,85,86,85,86,85,170,218,170,118,170,85,106,85,170,85,170,86,
+170,170,151,170,93,170,85,170,149,170,149,170,170,170,93,170,119,169,85,169,85,170,149,170,170,170,117,169,221,165,85,165,
+85,105,85,106,170,170,214,165,117,151,85,85,85,101,85,105,170,170,90,151,214,93,85,85,85,85,85,101,170,170,106,93,
+90,119,86,85,85,85,85,85,170,170,170,117,106,221,90,85,86,85,86,85,170,170,170,214,170,117,106,85,170,85,170,86,
+170,170,170,170,87,170,93,170,149,170,149,170,170,170,170,170,93,169,119,169,85,170,149,170,170,170,170,170,117,165,221,165,
+85,105,85,106,170,170,170,170,213,149,117,87,85,101,85,105,170,170,170,170,86,87,213,93,85,85,85,101,170,170,170,170,
+90,93,86,119,85,85,85,85,170,170,170,170,106,117,90,221,86,85,86,85,170,170,170,170,170,213,106,117,170,85,170,86,
+170,170,170,170,170,170,87,170,157,170,149,170,170,170,170,170,170,170,93,169,119,170,149,170,170,170,170,170,170,170,117,165,
+221,105,85,106,170,170,170,170,170,170,213,85,117,103,85,105,170,170,170,170,170,170,85,87,213,93,85,101,170,170,170,170,
+170,170,86,93,85,119,85,85,170,170,170,170,170,170,90,117,86,221,86,85,170,170,170,170,170,170,106,213,170,117,170,86,
+170,170,170,170,170,170,170,170,151,170,157,170,170,170,170,170,170,170,170,170,157,170,183,170,170,170,170,170,170,170,170,170,
+117,106,221,106,170,170,170,170,170,170,170,170,213,105,117,107,170,170,170,170,170,170,170,170,85,103,213,109,170,170,170,170,
+170,170,170,170,85,93,85,119,170,170,170,170,170,170,170,170,86,117,86,221,170,170,170,170,170,170,170,170,170,217,170,118,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,170,171,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+173,170,149,170,85,170,85,170,149,170,149,170,183,170,85,170,85,169,85,169,85,170,149,170,222,170,85,169,85,165,85,165,
+85,105,149,106,122,171,86,165,85,149,85,85,85,101,149,106,234,173,90,149,86,85,85,85,85,85,149,106,170,183,106,85,
+90,85,86,85,85,85,149,106,170,222,170,85,106,85,90,85,86,85,170,106,170,122,170,86,170,85,106,85,90,85,170,106,
+167,170,157,170,85,170,85,170,149,170,149,170,157,170,119,170,85,169,85,169,85,170,85,170,118,170,221,169,85,165,85,165,
+85,105,85,106,218,169,118,167,85,149,85,85,85,101,85,105,106,167,218,157,86,85,85,85,85,85,85,101,170,157,106,119,
+90,85,86,85,85,85,85,85,170,118,170,221,106,85,90,85,86,85,86,85,170,218,170,118,170,85,106,85,90,85,90,85,
+170,170,151,170,93,170,85,170,149,170,149,170,170,170,93,170,119,169,85,169,85,170,85,170,170,170,117,169,221,165,85,165,
+85,105,85,106,170,170,214,165,117,151,85,85,85,101,85,105,170,170,90,151,214,93,85,85,85,85,85,101,170,170,106,93,
+90,119,86,85,85,85,85,85,170,170,170,117,106,221,90,85,86,85,86,85,170,170,170,214,170,117,106,85,90,85,90,85,
+170,170,170,170,87,170,93,170,149,170,149,170,170,170,170,170,93,169,119,169,85,170,85,170,170,170,170,170,117,165,221,165,
+85,105,85,106,170,170,170,170,213,149,117,87,85,101,85,105,170,170,170,170,86,87,213,93,85,85,85,101,170,170,170,170,
+90,93,86,119,85,85,85,85,170,170,170,170,106,117,90,221,86,85,86,85,170,170,170,170,170,213,106,117,90,85,90,85,
+170,170,170,170,170,170,87,170,157,170,149,170,170,170,170,170,170,170,93,169,119,170,85,170,170,170,170,170,170,170,117,165,
+221,105,85,106,170,170,170,170,170,170,213,85,117,103,85,105,170,170,170,170,170,170,85,87,213,93,85,101,170,170,170,170,
+170,170,86,93,85,119,85,85,170,170,170,170,170,170,90,117,86,221,86,85,170,170,170,170,170,170,106,213,90,117,90,85,
+170,170,170,170,170,170,170,170,151,170,157,170,170,170,170,170,170,170,170,170,93,170,119,170,170,170,170,170,170,170,170,170,
+117,106,221,106,170,170,170,170,170,170,170,170,213,105,117,107,170,170,170,170,170,170,170,170,85,103,213,109,170,170,170,170,
+170,170,170,170,85,93,85,119,170,170,170,170,170,170,170,170,86,117,86,221,170,170,170,170,170,170,170,170,90,213,90,117,
+170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,
+170,170,186,170,170,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,
+170,170,170,170,170,170,170,174,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,89,169,89,165,89,149,89,85,
+89,85,89,85,89,165,89,149,89,85,89,85,89,85,89,85,106,149,106,85,106,85,106,85,106,85,106,85,106,85,106,85,
+106,85,106,85,106,85,106,85,170,85,170,85,170,85,170,85,170,85,170,85,170,86,170,85,170,85,170,85,170,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,121,169,85,165,85,149,85,85,
+85,85,85,85,217,165,89,149,89,85,85,85,85,85,85,85,106,151,106,85,106,85,90,85,85,85,85,85,106,93,106,85,
+106,85,106,85,90,85,86,85,170,117,170,85,170,85,170,85,106,85,90,85,170,214,170,85,170,85,170,85,170,85,106,85,
+170,170,87,170,85,169,85,165,85,149,85,149,89,170,93,169,85,165,85,149,85,85,85,85,89,169,117,165,85,149,85,85,
+85,85,85,85,89,165,217,149,85,85,85,85,85,85,85,85,106,149,106,87,90,85,86,85,85,85,85,85,106,85,106,93,
+106,85,90,85,86,85,86,85,170,85,170,117,170,85,106,85,90,85,90,85,170,86,170,213,170,85,170,85,106,85,106,85,
+170,170,85,170,87,169,85,165,85,149,85,149,170,170,85,169,93,165,85,149,85,85,85,85,170,170,85,165,117,149,85,85,
+85,85,85,85,170,170,90,149,213,85,85,85,85,85,85,85,170,170,106,85,90,87,86,85,85,85,85,85,170,170,106,85,
+106,93,90,85,86,85,86,85,170,170,170,85,170,117,106,85,90,85,90,85,170,170,170,85,170,213,170,85,106,85,106,85,
+170,170,170,170,85,169,87,165,85,149,85,149,170,170,170,170,85,165,93,149,85,85,85,85,170,170,170,170,85,149,117,85,
+85,85,85,85,170,170,170,170,86,85,213,85,85,85,85,85,170,170,170,170,90,85,86,87,85,85,85,85,170,170,170,170,
+106,85,90,93,86,85,86,85,170,170,170,170,170,85,106,117,90,85,90,85,170,170,170,170,170,85,170,213,106,85,106,85,
+170,170,170,170,170,170,85,165,87,149,85,149,170,170,170,170,170,170,85,149,93,85,85,85,170,170,170,170,170,170,85,85,
+117,85,85,85,170,170,170,170,170,170,85,85,213,85,85,85,170,170,170,170,170,170,86,85,85,87,85,85,170,170,170,170,
+170,170,90,85,86,93,86,85,170,170,170,170,170,170,106,85,90,117,90,85,170,170,170,170,170,170,170,85,106,213,106,85,
+170,170,170,170,170,170,170,170,85,149,87,149,170,170,170,170,170,170,170,170,85,85,93,85,170,170,170,170,170,170,170,170,
+85,85,117,85,170,170,170,170,170,170,170,170,85,85,213,85,170,170,170,170,170,170,170,170,85,85,85,87,170,170,170,170,
+170,170,170,170,86,85,86,93,170,170,170,170,170,170,170,170,90,85,90,117,170,170,170,170,170,170,170,170,106,85,106,213,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,
+170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,169,170,170,170,170,170,170,170,170,170,170,106,165,170,170,170,170,
+170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,106,165,106,149,106,85,106,85,106,85,106,85,106,149,106,85,106,85,106,85,106,85,106,85,170,85,170,85,
+170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,86,170,86,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,234,165,90,149,90,85,85,85,85,85,85,85,106,151,106,85,106,85,90,85,85,85,85,85,170,93,170,85,
+170,85,106,85,90,85,86,85,170,117,170,85,170,85,170,85,106,85,90,85,170,214,170,86,170,86,170,86,170,85,106,85,
+170,170,167,170,85,169,85,165,85,149,85,149,170,170,93,169,85,165,85,149,85,85,85,85,106,169,118,165,85,149,85,85,
+85,85,85,85,106,165,218,149,86,85,85,85,85,85,85,85,106,149,106,87,90,85,86,85,85,85,85,85,170,85,170,93,
+106,85,90,85,86,85,86,85,170,85,170,117,170,85,106,85,90,85,90,85,170,86,170,214,170,86,170,85,106,85,106,85,
+170,170,165,170,87,169,85,165,85,149,85,149,170,170,85,169,93,165,85,149,85,85,85,85,170,170,86,165,117,149,85,85,
+85,85,85,85,170,170,90,149,214,85,85,85,85,85,85,85,170,170,106,85,90,87,86,85,85,85,85,85,170,170,170,85,
+106,93,90,85,86,85,86,85,170,170,170,85,170,117,106,85,90,85,90,85,170,170,170,86,170,214,170,85,106,85,106,85,
+170,170,170,170,149,170,87,165,85,149,85,149,170,170,170,170,85,165,93,149,85,85,85,85,170,170,170,170,85,149,117,85,
+85,85,85,85,170,170,170,170,86,85,213,85,85,85,85,85,170,170,170,170,90,85,86,87,85,85,85,85,170,170,170,170,
+106,85,90,93,86,85,86,85,170,170,170,170,170,85,106,117,90,85,90,85,170,170,170,170,170,86,170,213,106,85,106,85,
+170,170,170,170,170,170,85,165,87,149,85,149,170,170,170,170,170,170,85,149,93,85,85,85,170,170,170,170,170,170,85,85,
+117,85,85,85,170,170,170,170,170,170,85,85,213,85,85,85,170,170,170,170,170,170,86,85,85,87,85,85,170,170,170,170,
+170,170,90,85,86,93,86,85,170,170,170,170,170,170,106,85,90,117,90,85,170,170,170,170,170,170,170,85,106,213,106,85,
+170,170,170,170,170,170,170,170,85,149,87,149,170,170,170,170,170,170,170,170,85,85,93,85,170,170,170,170,170,170,170,170,
+85,85,117,85,170,170,170,170,170,170,170,170,85,85,213,85,170,170,170,170,170,170,170,170,85,85,85,87,170,170,170,170,
+170,170,170,170,86,85,86,93,170,170,170,170,170,170,170,170,90,85,90,117,170,170,170,170,170,170,170,170,106,85,106,213,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,
+170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,169,170,170,170,170,170,170,170,170,170,170,106,165,170,170,170,170,
+170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,
+169,170,165,170,169,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,149,170,85,170,85,170,85,170,85,170,85,170,85,170,85,
+170,85,170,85,170,85,170,85,170,86,170,86,170,86,170,86,170,86,170,86,170,86,170,86,170,86,170,86,170,86,170,86,
+171,170,165,170,165,170,149,170,85,170,85,169,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,151,106,85,106,85,90,85,85,85,85,85,170,93,170,85,
+170,85,106,85,90,85,86,85,170,118,170,86,170,86,170,85,106,85,90,85,170,214,170,86,170,86,170,86,170,85,106,85,
+169,170,167,170,149,170,85,170,85,169,85,169,169,170,157,170,85,165,85,149,85,85,85,85,170,170,117,165,85,149,85,85,
+85,85,85,85,170,165,218,149,85,85,85,85,85,85,85,85,170,149,106,87,90,85,86,85,85,85,85,85,170,85,170,93,
+106,85,90,85,86,85,86,85,170,86,170,118,170,85,106,85,90,85,90,85,170,86,170,214,170,86,170,85,106,85,106,85,
+170,170,165,170,151,170,85,170,85,169,85,169,170,170,149,170,93,165,85,149,85,85,85,85,170,170,85,165,117,149,85,85,
+85,85,85,85,170,170,90,149,213,85,85,85,85,85,85,85,170,170,106,85,90,87,86,85,85,85,85,85,170,170,170,85,
+106,93,90,85,86,85,86,85,170,170,170,86,170,117,106,85,90,85,90,85,170,170,170,86,170,214,170,85,106,85,106,85,
+170,170,170,170,149,170,87,170,85,169,85,169,170,170,170,170,85,170,93,149,85,85,85,85,170,170,170,170,85,149,117,85,
+85,85,85,85,170,170,170,170,86,85,213,85,85,85,85,85,170,170,170,170,90,85,86,87,85,85,85,85,170,170,170,170,
+106,85,90,93,86,85,86,85,170,170,170,170,170,85,106,117,90,85,90,85,170,170,170,170,170,86,170,213,106,85,106,85,
+170,170,170,170,170,170,85,170,87,169,85,169,170,170,170,170,170,170,85,149,93,85,85,85,170,170,170,170,170,170,85,85,
+117,85,85,85,170,170,170,170,170,170,85,85,213,85,85,85,170,170,170,170,170,170,86,85,85,87,85,85,170,170,170,170,
+170,170,90,85,86,93,86,85,170,170,170,170,170,170,106,85,90,117,90,85,170,170,170,170,170,170,170,85,106,213,106,85,
+170,170,170,170,170,170,170,170,85,169,87,169,170,170,170,170,170,170,170,170,85,85,93,85,170,170,170,170,170,170,170,170,
+85,85,117,85,170,170,170,170,170,170,170,170,85,85,213,85,170,170,170,170,170,170,170,170,85,85,85,87,170,170,170,170,
+170,170,170,170,86,85,86,93,170,170,170,170,170,170,170,170,90,85,90,117,170,170,170,170,170,170,170,170,106,85,106,213,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,
+170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,169,170,170,170,170,170,170,170,170,170,170,106,165,170,170,170,170,
+170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,
+165,170,165,170,165,170,165,170,165,170,165,170,165,170,165,170,165,170,165,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,86,170,86,
+170,86,170,86,170,86,170,86,170,86,170,86,170,86,170,86,170,86,170,86,170,90,170,90,170,90,170,90,170,90,170,90,
+167,170,165,170,165,170,149,170,85,170,85,169,173,170,149,170,149,170,85,170,85,169,85,165,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,94,170,85,
+170,85,106,85,90,85,86,85,170,118,170,86,170,86,170,85,106,85,90,85,170,218,170,90,170,90,170,86,170,85,106,85,
+165,170,167,170,149,170,85,170,85,169,85,169,165,170,157,170,85,170,85,169,85,165,85,165,165,170,117,170,85,149,85,85,
+85,85,85,85,170,170,213,149,85,85,85,85,85,85,85,85,170,150,106,87,85,85,85,85,85,85,85,85,170,86,170,93,
+106,85,90,85,86,85,86,85,170,86,170,118,170,85,106,85,90,85,90,85,170,90,170,218,170,86,170,85,106,85,106,85,
+170,170,165,170,151,170,85,170,85,169,85,169,170,170,149,170,93,170,85,169,85,165,85,165,170,170,85,170,117,149,85,85,
+85,85,85,85,170,170,85,149,213,85,85,85,85,85,85,85,170,170,106,85,85,87,85,85,85,85,85,85,170,170,170,85,
+106,93,90,85,86,85,86,85,170,170,170,86,170,117,106,85,90,85,90,85,170,170,170,90,170,214,170,85,106,85,106,85,
+170,170,170,170,149,170,87,170,85,169,85,169,170,170,170,170,85,170,93,169,85,165,85,165,170,170,170,170,85,169,117,85,
+85,85,85,85,170,170,170,170,85,85,213,85,85,85,85,85,170,170,170,170,90,85,85,87,85,85,85,85,170,170,170,170,
+106,85,90,93,86,85,86,85,170,170,170,170,170,85,106,117,90,85,90,85,170,170,170,170,170,86,170,213,106,85,106,85,
+170,170,170,170,170,170,85,170,87,169,85,169,170,170,170,170,170,170,85,169,93,165,85,165,170,170,170,170,170,170,85,85,
+117,85,85,85,170,170,170,170,170,170,85,85,213,85,85,85,170,170,170,170,170,170,85,85,85,87,85,85,170,170,170,170,
+170,170,90,85,86,93,86,85,170,170,170,170,170,170,106,85,90,117,90,85,170,170,170,170,170,170,170,85,106,213,106,85,
+170,170,170,170,170,170,170,170,85,169,87,169,170,170,170,170,170,170,170,170,85,165,93,165,170,170,170,170,170,170,170,170,
+85,85,117,85,170,170,170,170,170,170,170,170,85,85,213,85,170,170,170,170,170,170,170,170,85,85,85,87,170,170,170,170,
+170,170,170,170,86,85,86,93,170,170,170,170,170,170,170,170,90,85,90,117,170,170,170,170,170,170,170,170,106,85,106,213,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,
+170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,169,170,170,170,170,170,170,170,170,170,170,106,165,170,170,170,170,
+170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,
+165,170,165,170,165,170,165,170,165,170,165,170,149,170,149,170,149,170,149,170,149,170,149,170,149,170,149,170,149,170,149,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,90,170,90,170,90,170,90,170,90,170,90,170,90,170,90,170,90,170,90,170,90,170,90,
+167,170,165,170,165,170,149,170,85,170,85,169,157,170,149,170,149,170,85,170,85,169,85,165,181,170,85,170,85,170,85,169,
+85,165,85,149,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,122,170,86,170,86,170,85,106,85,90,85,170,218,170,90,170,90,170,86,170,85,106,85,
+165,170,167,170,149,170,85,170,85,169,85,169,149,170,157,170,85,170,85,169,85,165,85,165,149,170,117,170,85,169,85,165,
+85,149,85,149,150,170,213,169,85,85,85,85,85,85,85,85,170,170,86,87,85,85,85,85,85,85,85,85,170,90,170,93,
+86,85,85,85,85,85,85,85,170,90,170,118,170,85,106,85,90,85,90,85,170,90,170,218,170,86,170,85,106,85,106,85,
+170,170,165,170,151,170,85,170,85,169,85,169,170,170,149,170,93,170,85,169,85,165,85,165,170,170,85,170,117,169,85,165,
+85,149,85,149,170,170,85,169,213,85,85,85,85,85,85,85,170,170,86,85,85,87,85,85,85,85,85,85,170,170,170,85,
+86,93,85,85,85,85,85,85,170,170,170,86,170,117,106,85,90,85,90,85,170,170,170,90,170,214,170,85,106,85,106,85,
+170,170,170,170,149,170,87,170,85,169,85,169,170,170,170,170,85,170,93,169,85,165,85,165,170,170,170,170,85,169,117,165,
+85,149,85,149,170,170,170,170,85,165,213,85,85,85,85,85,170,170,170,170,85,85,85,87,85,85,85,85,170,170,170,170,
+106,85,85,93,85,85,85,85,170,170,170,170,170,85,106,117,90,85,90,85,170,170,170,170,170,86,170,213,106,85,106,85,
+170,170,170,170,170,170,85,170,87,169,85,169,170,170,170,170,170,170,85,169,93,165,85,165,170,170,170,170,170,170,85,165,
+117,149,85,149,170,170,170,170,170,170,85,85,213,85,85,85,170,170,170,170,170,170,85,85,85,87,85,85,170,170,170,170,
+170,170,85,85,85,93,85,85,170,170,170,170,170,170,106,85,90,117,90,85,170,170,170,170,170,170,170,85,106,213,106,85,
+170,170,170,170,170,170,170,170,85,169,87,169,170,170,170,170,170,170,170,170,85,165,93,165,170,170,170,170,170,170,170,170,
+85,149,117,149,170,170,170,170,170,170,170,170,85,85,213,85,170,170,170,170,170,170,170,170,85,85,85,87,170,170,170,170,
+170,170,170,170,85,85,85,93,170,170,170,170,170,170,170,170,90,85,90,117,170,170,170,170,170,170,170,170,106,85,106,213,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,
+170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,169,170,170,170,170,170,170,170,170,170,170,106,165,170,170,170,170,
+170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,
+149,170,149,170,149,170,149,170,149,170,149,170,149,170,149,170,149,170,149,170,149,170,149,170,85,170,85,170,85,170,85,170,
+85,170,85,170,86,170,85,170,85,170,85,170,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,106,170,90,170,106,170,106,170,106,170,106,
+151,170,149,170,149,170,149,170,85,170,85,169,157,170,149,170,149,170,85,170,85,169,85,165,117,170,85,170,85,170,85,169,
+85,165,85,149,214,170,85,169,85,169,85,165,85,85,85,85,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,234,170,90,170,90,170,86,170,85,106,85,
+149,170,151,170,149,170,85,170,85,169,85,169,149,170,157,170,85,170,85,169,85,165,85,165,85,170,117,170,85,169,85,165,
+85,149,85,149,86,170,213,169,85,165,85,149,85,85,85,85,90,170,86,167,85,85,85,85,85,85,85,85,170,170,90,93,
+86,85,85,85,85,85,85,85,170,106,170,118,90,85,86,85,85,85,85,85,170,106,170,218,170,86,170,85,106,85,106,85,
+170,170,149,170,151,170,85,170,85,169,85,169,170,170,149,170,93,170,85,169,85,165,85,165,170,170,85,170,117,169,85,165,
+85,149,85,149,170,170,85,169,213,165,85,149,85,85,85,85,170,170,86,165,85,87,85,85,85,85,85,85,170,170,90,85,
+86,93,85,85,85,85,85,85,170,170,170,86,90,117,86,85,85,85,85,85,170,170,170,90,170,214,170,85,106,85,106,85,
+170,170,170,170,149,170,87,170,85,169,85,169,170,170,170,170,85,170,93,169,85,165,85,165,170,170,170,170,85,169,117,165,
+85,149,85,149,170,170,170,170,85,165,213,149,85,85,85,85,170,170,170,170,85,149,85,87,85,85,85,85,170,170,170,170,
+86,85,85,93,85,85,85,85,170,170,170,170,170,85,86,117,85,85,85,85,170,170,170,170,170,86,170,213,106,85,106,85,
+170,170,170,170,170,170,85,170,87,169,85,169,170,170,170,170,170,170,85,169,93,165,85,165,170,170,170,170,170,170,85,165,
+117,149,85,149,170,170,170,170,170,170,85,149,213,85,85,85,170,170,170,170,170,170,85,85,85,87,85,85,170,170,170,170,
+170,170,85,85,85,93,85,85,170,170,170,170,170,170,86,85,85,117,85,85,170,170,170,170,170,170,170,85,106,213,106,85,
+170,170,170,170,170,170,170,170,85,169,87,169,170,170,170,170,170,170,170,170,85,165,93,165,170,170,170,170,170,170,170,170,
+85,149,117,149,170,170,170,170,170,170,170,170,85,85,213,85,170,170,170,170,170,170,170,170,85,85,85,87,170,170,170,170,
+170,170,170,170,85,85,85,93,170,170,170,170,170,170,170,170,85,85,85,117,170,170,170,170,170,170,170,170,106,85,106,213,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,
+170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,169,170,170,170,170,170,170,170,170,170,170,106,165,170,170,170,170,
+170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,
+149,170,149,170,149,170,149,170,149,170,149,170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,
+85,170,85,170,86,169,85,169,85,169,85,169,85,169,85,169,90,169,86,169,85,169,85,169,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+151,170,149,170,149,170,149,170,85,170,85,169,93,170,85,170,85,170,85,170,85,169,85,165,117,170,85,170,85,170,85,169,
+85,165,85,149,214,169,85,169,85,169,85,165,85,85,85,85,90,171,86,165,85,165,85,85,85,85,85,85,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+149,170,151,170,149,170,85,170,85,169,85,169,85,170,93,170,85,170,85,169,85,165,85,165,85,170,117,170,85,169,85,165,
+85,149,85,149,86,169,213,169,85,165,85,149,85,85,85,85,90,169,86,167,85,149,85,85,85,85,85,85,106,169,90,157,
+86,85,85,85,85,85,85,85,170,170,106,117,90,85,86,85,85,85,85,85,170,170,170,218,106,85,90,85,86,85,86,85,
+170,170,149,170,151,170,85,170,85,169,85,169,170,170,85,170,93,170,85,169,85,165,85,165,170,170,85,170,117,169,85,165,
+85,149,85,149,170,170,85,169,213,165,85,149,85,85,85,85,170,170,86,165,85,151,85,85,85,85,85,85,170,170,90,149,
+86,93,85,85,85,85,85,85,170,170,106,85,90,117,86,85,85,85,85,85,170,170,170,90,106,213,90,85,86,85,86,85,
+170,170,170,170,149,170,87,170,85,169,85,169,170,170,170,170,85,170,93,169,85,165,85,165,170,170,170,170,85,169,117,165,
+85,149,85,149,170,170,170,170,85,165,213,149,85,85,85,85,170,170,170,170,85,149,85,87,85,85,85,85,170,170,170,170,
+86,85,85,93,85,85,85,85,170,170,170,170,90,85,86,117,85,85,85,85,170,170,170,170,170,86,90,213,86,85,86,85,
+170,170,170,170,170,170,85,170,87,169,85,169,170,170,170,170,170,170,85,169,93,165,85,165,170,170,170,170,170,170,85,165,
+117,149,85,149,170,170,170,170,170,170,85,149,213,85,85,85,170,170,170,170,170,170,85,85,85,87,85,85,170,170,170,170,
+170,170,85,85,85,93,85,85,170,170,170,170,170,170,86,85,85,117,85,85,170,170,170,170,170,170,90,85,86,213,86,85,
+170,170,170,170,170,170,170,170,85,169,87,169,170,170,170,170,170,170,170,170,85,165,93,165,170,170,170,170,170,170,170,170,
+85,149,117,149,170,170,170,170,170,170,170,170,85,85,213,85,170,170,170,170,170,170,170,170,85,85,85,87,170,170,170,170,
+170,170,170,170,85,85,85,93,170,170,170,170,170,170,170,170,85,85,85,117,170,170,170,170,170,170,170,170,86,85,86,213,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,
+170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,169,170,170,170,170,170,170,170,170,170,170,106,165,170,170,170,170,
+170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,
+149,170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,85,170,85,169,85,169,85,169,85,169,
+85,169,85,169,86,169,85,169,85,169,85,169,85,169,85,169,90,101,86,101,85,101,85,101,85,101,85,101,106,101,90,101,
+86,101,85,101,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+151,170,85,170,85,170,85,170,85,170,85,169,93,170,85,170,85,170,85,170,85,169,85,165,117,169,85,169,85,169,85,169,
+85,165,85,149,214,169,85,169,85,169,85,165,85,85,85,85,90,103,86,101,85,101,85,85,85,85,85,85,106,109,90,85,
+86,85,85,85,85,85,85,85,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+149,170,87,170,85,170,85,170,85,169,85,169,85,170,93,170,85,170,85,169,85,165,85,165,85,169,117,169,85,169,85,165,
+85,149,85,149,86,169,213,169,85,165,85,149,85,85,85,85,90,101,86,103,85,85,85,85,85,85,85,85,106,101,90,93,
+86,85,85,85,85,85,85,85,170,101,106,117,90,85,86,85,85,85,85,85,170,170,170,213,106,85,90,85,86,85,86,85,
+170,170,85,170,87,170,85,170,85,169,85,169,170,170,85,170,93,170,85,169,85,165,85,165,170,170,85,169,117,169,85,165,
+85,149,85,149,170,170,85,169,213,165,85,149,85,85,85,85,170,170,86,165,85,87,85,85,85,85,85,85,170,170,90,85,
+86,93,85,85,85,85,85,85,170,170,106,85,90,117,86,85,85,85,85,85,170,170,170,85,106,213,90,85,86,85,86,85,
+170,170,170,170,85,170,87,170,85,169,85,169,170,170,170,170,85,170,93,169,85,165,85,165,170,170,170,170,85,169,117,165,
+85,149,85,149,170,170,170,170,85,165,213,149,85,85,85,85,170,170,170,170,85,149,85,87,85,85,85,85,170,170,170,170,
+86,85,85,93,85,85,85,85,170,170,170,170,90,85,86,117,85,85,85,85,170,170,170,170,106,85,90,213,86,85,86,85,
+170,170,170,170,170,170,85,170,87,169,85,169,170,170,170,170,170,170,85,169,93,165,85,165,170,170,170,170,170,170,85,165,
+117,149,85,149,170,170,170,170,170,170,85,149,213,85,85,85,170,170,170,170,170,170,85,85,85,87,85,85,170,170,170,170,
+170,170,85,85,85,93,85,85,170,170,170,170,170,170,86,85,85,117,85,85,170,170,170,170,170,170,90,85,86,213,86,85,
+170,170,170,170,170,170,170,170,85,169,87,169,170,170,170,170,170,170,170,170,85,165,93,165,170,170,170,170,170,170,170,170,
+85,149,117,149,170,170,170,170,170,170,170,170,85,85,213,85,170,170,170,170,170,170,170,170,85,85,85,87,170,170,170,170,
+170,170,170,170,85,85,85,93,170,170,170,170,170,170,170,170,85,85,85,117,170,170,170,170,170,170,170,170,86,85,86,213,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,
+170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,169,170,170,170,170,170,170,170,170,170,170,106,165,170,170,170,170,
+170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,91,169,89,165,89,149,89,85,
+89,85,89,85,91,165,89,149,89,85,89,85,89,85,89,85,107,149,106,85,106,85,106,85,106,85,106,85,107,85,106,85,
+106,85,106,85,106,85,106,85,171,85,170,85,170,85,170,85,170,85,170,85,171,86,170,85,170,85,170,85,170,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,123,169,89,165,89,149,89,85,
+89,85,89,85,219,165,89,149,89,85,89,85,89,85,89,85,107,151,106,85,106,85,106,85,106,85,106,85,107,93,106,85,
+106,85,106,85,106,85,106,85,171,117,170,85,170,85,170,85,170,85,170,85,171,214,170,85,170,85,170,85,170,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,91,169,121,165,85,149,85,85,
+85,85,85,85,91,165,217,149,89,85,89,85,85,85,85,85,107,149,106,87,106,85,106,85,90,85,86,85,107,85,106,93,
+106,85,106,85,106,85,90,85,171,85,170,117,170,85,170,85,170,85,106,85,171,86,170,213,170,85,170,85,170,85,170,85,
+171,170,170,170,87,169,85,165,85,149,85,149,171,170,90,169,93,165,85,149,85,85,85,85,171,170,90,165,117,149,85,85,
+85,85,85,85,171,170,90,149,217,85,85,85,85,85,85,85,171,170,106,85,106,87,90,85,86,85,86,85,171,170,106,85,
+106,93,106,85,90,85,90,85,171,170,170,85,170,117,170,85,106,85,106,85,171,170,170,85,170,213,170,85,170,85,170,85,
+171,170,170,170,85,169,87,165,85,149,85,149,171,170,170,170,85,165,93,149,85,85,85,85,171,170,170,170,86,149,117,85,
+85,85,85,85,171,170,170,170,90,85,213,85,85,85,85,85,171,170,170,170,106,85,90,87,86,85,86,85,171,170,170,170,
+106,85,106,93,90,85,90,85,171,170,170,170,170,85,170,117,106,85,106,85,171,170,170,170,170,85,170,213,170,85,170,85,
+171,170,170,170,170,170,85,165,87,149,85,149,171,170,170,170,170,170,85,149,93,85,85,85,171,170,170,170,170,170,85,85,
+117,85,85,85,171,170,170,170,170,170,86,85,213,85,85,85,171,170,170,170,170,170,90,85,86,87,86,85,171,170,170,170,
+170,170,106,85,90,93,90,85,171,170,170,170,170,170,170,85,106,117,106,85,171,170,170,170,170,170,170,85,170,213,170,85,
+171,170,170,170,170,170,170,170,85,149,87,149,171,170,170,170,170,170,170,170,85,85,93,85,171,170,170,170,170,170,170,170,
+85,85,117,85,171,170,170,170,170,170,170,170,85,85,213,85,171,170,170,170,170,170,170,170,86,85,86,87,171,170,170,170,
+170,170,170,170,90,85,90,93,171,170,170,170,170,170,170,170,106,85,106,117,171,170,170,170,170,170,170,170,170,85,170,213,
+171,170,170,170,170,170,170,170,170,170,165,170,171,170,170,170,170,170,170,170,170,170,149,170,171,170,170,170,170,170,170,170,
+170,170,86,170,171,170,170,170,170,170,170,170,170,170,90,169,171,170,170,170,170,170,170,170,170,170,106,165,171,170,170,170,
+170,170,170,170,170,170,170,149,171,170,170,170,170,170,170,170,170,170,170,86,171,170,170,170,170,170,170,170,170,170,170,90,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,110,165,106,149,106,85,106,85,106,85,106,85,110,149,106,85,106,85,106,85,106,85,106,85,174,85,170,85,
+170,85,170,85,170,85,170,85,174,85,170,85,170,85,170,85,170,85,170,85,174,86,170,86,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,238,165,106,149,106,85,106,85,106,85,106,85,110,151,106,85,106,85,106,85,106,85,106,85,174,93,170,85,
+170,85,170,85,170,85,170,85,174,117,170,85,170,85,170,85,170,85,170,85,174,214,170,86,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,110,165,234,149,90,85,90,85,85,85,85,85,110,149,106,87,106,85,106,85,90,85,86,85,174,85,170,93,
+170,85,170,85,106,85,90,85,174,85,170,117,170,85,170,85,170,85,106,85,174,86,170,214,170,86,170,86,170,86,170,85,
+174,170,170,170,167,170,85,165,85,149,85,149,174,170,170,170,93,165,85,149,85,85,85,85,174,170,106,165,118,149,85,85,
+85,85,85,85,174,170,106,149,218,85,86,85,85,85,85,85,174,170,106,85,106,87,90,85,86,85,86,85,174,170,170,85,
+170,93,106,85,90,85,90,85,174,170,170,85,170,117,170,85,106,85,106,85,174,170,170,86,170,214,170,86,170,85,170,85,
+174,170,170,170,165,170,87,165,85,149,85,149,174,170,170,170,85,165,93,149,85,85,85,85,174,170,170,170,86,149,117,85,
+85,85,85,85,174,170,170,170,90,85,214,85,85,85,85,85,174,170,170,170,106,85,90,87,86,85,86,85,174,170,170,170,
+170,85,106,93,90,85,90,85,174,170,170,170,170,85,170,117,106,85,106,85,174,170,170,170,170,86,170,214,170,85,170,85,
+174,170,170,170,170,170,149,170,87,149,85,149,174,170,170,170,170,170,85,149,93,85,85,85,174,170,170,170,170,170,85,85,
+117,85,85,85,174,170,170,170,170,170,86,85,213,85,85,85,174,170,170,170,170,170,90,85,86,87,86,85,174,170,170,170,
+170,170,106,85,90,93,90,85,174,170,170,170,170,170,170,85,106,117,106,85,174,170,170,170,170,170,170,86,170,213,170,85,
+174,170,170,170,170,170,170,170,85,149,87,149,174,170,170,170,170,170,170,170,85,85,93,85,174,170,170,170,170,170,170,170,
+85,85,117,85,174,170,170,170,170,170,170,170,85,85,213,85,174,170,170,170,170,170,170,170,86,85,86,87,174,170,170,170,
+170,170,170,170,90,85,90,93,174,170,170,170,170,170,170,170,106,85,106,117,174,170,170,170,170,170,170,170,170,85,170,213,
+174,170,170,170,170,170,170,170,170,170,165,170,174,170,170,170,170,170,170,170,170,170,149,170,174,170,170,170,170,170,170,170,
+170,170,86,170,174,170,170,170,170,170,170,170,170,170,90,169,174,170,170,170,170,170,170,170,170,170,106,165,174,170,170,170,
+170,170,170,170,170,170,170,149,174,170,170,170,170,170,170,170,170,170,170,86,174,170,170,170,170,170,170,170,170,170,170,90,
+185,170,165,170,169,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,186,149,170,85,170,85,170,85,170,85,170,85,186,85,170,85,
+170,85,170,85,170,85,170,85,186,86,170,86,170,86,170,86,170,86,170,86,186,86,170,86,170,86,170,86,170,86,170,86,
+187,170,169,170,169,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,186,151,170,85,170,85,170,85,170,85,170,85,186,93,170,85,
+170,85,170,85,170,85,170,85,186,118,170,86,170,86,170,86,170,86,170,86,186,214,170,86,170,86,170,86,170,86,170,86,
+185,170,171,170,165,170,165,170,149,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,186,149,170,87,106,85,106,85,90,85,86,85,186,85,170,93,
+170,85,170,85,106,85,90,85,186,86,170,118,170,86,170,86,170,85,106,85,186,86,170,214,170,86,170,86,170,86,170,85,
+186,170,169,170,167,170,149,170,85,170,85,170,186,170,169,170,157,170,85,149,85,85,85,85,186,170,170,170,117,149,85,85,
+85,85,85,85,186,170,170,149,218,85,85,85,85,85,85,85,186,170,170,85,106,87,90,85,86,85,86,85,186,170,170,85,
+170,93,106,85,90,85,90,85,186,170,170,86,170,118,170,85,106,85,106,85,186,170,170,86,170,214,170,86,170,85,170,85,
+186,170,170,170,165,170,151,170,85,170,85,170,186,170,170,170,149,170,93,149,85,85,85,85,186,170,170,170,85,149,117,85,
+85,85,85,85,186,170,170,170,90,85,213,85,85,85,85,85,186,170,170,170,106,85,90,87,86,85,86,85,186,170,170,170,
+170,85,106,93,90,85,90,85,186,170,170,170,170,86,170,117,106,85,106,85,186,170,170,170,170,86,170,214,170,85,170,85,
+186,170,170,170,170,170,149,170,87,170,85,170,186,170,170,170,170,170,85,170,93,85,85,85,186,170,170,170,170,170,85,85,
+117,85,85,85,186,170,170,170,170,170,86,85,213,85,85,85,186,170,170,170,170,170,90,85,86,87,86,85,186,170,170,170,
+170,170,106,85,90,93,90,85,186,170,170,170,170,170,170,85,106,117,106,85,186,170,170,170,170,170,170,86,170,213,170,85,
+186,170,170,170,170,170,170,170,85,170,87,170,186,170,170,170,170,170,170,170,85,85,93,85,186,170,170,170,170,170,170,170,
+85,85,117,85,186,170,170,170,170,170,170,170,85,85,213,85,186,170,170,170,170,170,170,170,86,85,86,87,186,170,170,170,
+170,170,170,170,90,85,90,93,186,170,170,170,170,170,170,170,106,85,106,117,186,170,170,170,170,170,170,170,170,85,170,213,
+186,170,170,170,170,170,170,170,170,170,165,170,186,170,170,170,170,170,170,170,170,170,149,170,186,170,170,170,170,170,170,170,
+170,170,86,170,186,170,170,170,170,170,170,170,170,170,90,169,186,170,170,170,170,170,170,170,170,170,106,165,186,170,170,170,
+170,170,170,170,170,170,170,149,186,170,170,170,170,170,170,170,170,170,170,86,186,170,170,170,170,170,170,170,170,170,170,90,
+229,170,165,170,165,170,165,170,165,170,165,170,229,170,165,170,165,170,165,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,234,86,170,86,
+170,86,170,86,170,86,170,86,234,86,170,86,170,86,170,86,170,86,170,86,234,90,170,90,170,90,170,90,170,90,170,90,
+231,170,165,170,165,170,165,170,165,170,165,170,237,170,165,170,165,170,165,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,234,94,170,86,
+170,86,170,86,170,86,170,86,234,118,170,86,170,86,170,86,170,86,170,86,234,218,170,90,170,90,170,90,170,90,170,90,
+229,170,167,170,165,170,165,170,149,170,85,170,229,170,173,170,149,170,149,170,85,170,85,169,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,234,86,170,94,
+170,85,170,85,106,85,90,85,234,86,170,118,170,86,170,86,170,85,106,85,234,90,170,218,170,90,170,90,170,86,170,85,
+234,170,165,170,167,170,149,170,85,170,85,170,234,170,165,170,157,170,85,170,85,169,85,169,234,170,165,170,117,170,85,85,
+85,85,85,85,234,170,170,170,213,85,85,85,85,85,85,85,234,170,170,86,106,87,85,85,85,85,85,85,234,170,170,86,
+170,93,106,85,90,85,90,85,234,170,170,86,170,118,170,85,106,85,106,85,234,170,170,90,170,218,170,86,170,85,170,85,
+234,170,170,170,165,170,151,170,85,170,85,170,234,170,170,170,149,170,93,170,85,169,85,169,234,170,170,170,85,170,117,85,
+85,85,85,85,234,170,170,170,85,85,213,85,85,85,85,85,234,170,170,170,106,85,85,87,85,85,85,85,234,170,170,170,
+170,85,106,93,90,85,90,85,234,170,170,170,170,86,170,117,106,85,106,85,234,170,170,170,170,90,170,214,170,85,170,85,
+234,170,170,170,170,170,149,170,87,170,85,170,234,170,170,170,170,170,85,170,93,169,85,169,234,170,170,170,170,170,85,169,
+117,85,85,85,234,170,170,170,170,170,85,85,213,85,85,85,234,170,170,170,170,170,90,85,85,87,85,85,234,170,170,170,
+170,170,106,85,90,93,90,85,234,170,170,170,170,170,170,85,106,117,106,85,234,170,170,170,170,170,170,86,170,213,170,85,
+234,170,170,170,170,170,170,170,85,170,87,170,234,170,170,170,170,170,170,170,85,169,93,169,234,170,170,170,170,170,170,170,
+85,85,117,85,234,170,170,170,170,170,170,170,85,85,213,85,234,170,170,170,170,170,170,170,85,85,85,87,234,170,170,170,
+170,170,170,170,90,85,90,93,234,170,170,170,170,170,170,170,106,85,106,117,234,170,170,170,170,170,170,170,170,85,170,213,
+234,170,170,170,170,170,170,170,170,170,165,170,234,170,170,170,170,170,170,170,170,170,149,170,234,170,170,170,170,170,170,170,
+170,170,86,170,234,170,170,170,170,170,170,170,170,170,90,169,234,170,170,170,170,170,170,170,170,170,106,165,234,170,170,170,
+170,170,170,170,170,170,170,149,234,170,170,170,170,170,170,170,170,170,170,86,234,170,170,170,170,170,170,170,170,170,170,90,
+165,171,165,170,165,170,165,170,165,170,165,170,149,171,149,170,149,170,149,170,149,170,149,170,149,171,149,170,149,170,149,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,91,170,90,170,90,170,90,170,90,170,90,170,91,170,90,170,90,170,90,170,90,170,90,
+167,171,165,170,165,170,165,170,165,170,165,170,157,171,149,170,149,170,149,170,149,170,149,170,181,171,149,170,149,170,149,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,123,170,90,170,90,170,90,170,90,170,90,170,219,170,90,170,90,170,90,170,90,170,90,
+165,171,167,170,165,170,165,170,149,170,85,170,149,171,157,170,149,170,149,170,85,170,85,169,149,171,181,170,85,170,85,170,
+85,169,85,165,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,91,170,122,170,86,170,86,170,85,106,85,170,91,170,218,170,90,170,90,170,86,170,85,
+170,171,165,170,167,170,149,170,85,170,85,170,170,171,149,170,157,170,85,170,85,169,85,169,170,171,149,170,117,170,85,169,
+85,165,85,165,170,171,149,170,213,169,85,85,85,85,85,85,170,171,170,170,85,87,85,85,85,85,85,85,170,171,170,90,
+170,93,85,85,85,85,85,85,170,171,170,90,170,118,170,85,106,85,106,85,170,171,170,90,170,218,170,86,170,85,170,85,
+170,171,170,170,165,170,151,170,85,170,85,170,170,171,170,170,149,170,93,170,85,169,85,169,170,171,170,170,85,170,117,169,
+85,165,85,165,170,171,170,170,85,169,213,85,85,85,85,85,170,171,170,170,85,85,85,87,85,85,85,85,170,171,170,170,
+170,85,85,93,85,85,85,85,170,171,170,170,170,86,170,117,106,85,106,85,170,171,170,170,170,90,170,214,170,85,170,85,
+170,171,170,170,170,170,149,170,87,170,85,170,170,171,170,170,170,170,85,170,93,169,85,169,170,171,170,170,170,170,85,169,
+117,165,85,165,170,171,170,170,170,170,85,165,213,85,85,85,170,171,170,170,170,170,85,85,85,87,85,85,170,171,170,170,
+170,170,106,85,85,93,85,85,170,171,170,170,170,170,170,85,106,117,106,85,170,171,170,170,170,170,170,86,170,213,170,85,
+170,171,170,170,170,170,170,170,85,170,87,170,170,171,170,170,170,170,170,170,85,169,93,169,170,171,170,170,170,170,170,170,
+85,165,117,165,170,171,170,170,170,170,170,170,85,85,213,85,170,171,170,170,170,170,170,170,85,85,85,87,170,171,170,170,
+170,170,170,170,85,85,85,93,170,171,170,170,170,170,170,170,106,85,106,117,170,171,170,170,170,170,170,170,170,85,170,213,
+170,171,170,170,170,170,170,170,170,170,165,170,170,171,170,170,170,170,170,170,170,170,149,170,170,171,170,170,170,170,170,170,
+170,170,86,170,170,171,170,170,170,170,170,170,170,170,90,169,170,171,170,170,170,170,170,170,170,170,106,165,170,171,170,170,
+170,170,170,170,170,170,170,149,170,171,170,170,170,170,170,170,170,170,170,86,170,171,170,170,170,170,170,170,170,170,170,90,
+149,174,149,170,149,170,149,170,149,170,149,170,149,174,149,170,149,170,149,170,149,170,149,170,85,174,85,170,85,170,85,170,
+85,170,85,170,86,174,85,170,85,170,85,170,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,110,170,90,170,106,170,106,170,106,170,106,
+151,174,149,170,149,170,149,170,149,170,149,170,157,174,149,170,149,170,149,170,149,170,149,170,117,174,85,170,85,170,85,170,
+85,170,85,170,214,174,85,170,85,170,85,170,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,238,170,106,170,106,170,106,170,106,170,106,
+149,174,151,170,149,170,149,170,149,170,85,170,149,174,157,170,149,170,149,170,85,170,85,169,85,174,117,170,85,170,85,170,
+85,169,85,165,86,174,213,170,85,169,85,169,85,165,85,149,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,110,170,234,170,90,170,90,170,86,170,85,
+170,174,149,170,151,170,149,170,85,170,85,170,170,174,149,170,157,170,85,170,85,169,85,169,170,174,85,170,117,170,85,169,
+85,165,85,165,170,174,85,170,213,169,85,165,85,149,85,149,170,174,86,170,85,167,85,85,85,85,85,85,170,174,170,170,
+86,93,85,85,85,85,85,85,170,174,170,106,170,118,86,85,85,85,85,85,170,174,170,106,170,218,170,86,170,85,170,85,
+170,174,170,170,149,170,151,170,85,170,85,170,170,174,170,170,149,170,93,170,85,169,85,169,170,174,170,170,85,170,117,169,
+85,165,85,165,170,174,170,170,85,169,213,165,85,149,85,149,170,174,170,170,85,165,85,87,85,85,85,85,170,174,170,170,
+86,85,85,93,85,85,85,85,170,174,170,170,170,86,86,117,85,85,85,85,170,174,170,170,170,90,170,214,170,85,170,85,
+170,174,170,170,170,170,149,170,87,170,85,170,170,174,170,170,170,170,85,170,93,169,85,169,170,174,170,170,170,170,85,169,
+117,165,85,165,170,174,170,170,170,170,85,165,213,149,85,149,170,174,170,170,170,170,85,149,85,87,85,85,170,174,170,170,
+170,170,85,85,85,93,85,85,170,174,170,170,170,170,170,85,85,117,85,85,170,174,170,170,170,170,170,86,170,213,170,85,
+170,174,170,170,170,170,170,170,85,170,87,170,170,174,170,170,170,170,170,170,85,169,93,169,170,174,170,170,170,170,170,170,
+85,165,117,165,170,174,170,170,170,170,170,170,85,149,213,149,170,174,170,170,170,170,170,170,85,85,85,87,170,174,170,170,
+170,170,170,170,85,85,85,93,170,174,170,170,170,170,170,170,85,85,85,117,170,174,170,170,170,170,170,170,170,85,170,213,
+170,174,170,170,170,170,170,170,170,170,165,170,170,174,170,170,170,170,170,170,170,170,149,170,170,174,170,170,170,170,170,170,
+170,170,86,170,170,174,170,170,170,170,170,170,170,170,90,169,170,174,170,170,170,170,170,170,170,170,106,165,170,174,170,170,
+170,170,170,170,170,170,170,149,170,174,170,170,170,170,170,170,170,170,170,86,170,174,170,170,170,170,170,170,170,170,170,90,
+149,186,149,170,149,170,149,170,149,170,149,170,85,186,85,170,85,170,85,170,85,170,85,170,85,186,85,170,85,170,85,170,
+85,170,85,170,86,185,85,169,85,169,85,169,85,169,85,169,90,185,86,169,85,169,85,169,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+151,186,149,170,149,170,149,170,149,170,149,170,93,186,85,170,85,170,85,170,85,170,85,170,117,186,85,170,85,170,85,170,
+85,170,85,170,214,185,85,169,85,169,85,169,85,169,85,169,90,187,86,169,85,169,85,169,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+149,186,151,170,149,170,149,170,149,170,85,170,85,186,93,170,85,170,85,170,85,170,85,169,85,186,117,170,85,170,85,170,
+85,169,85,165,86,185,213,169,85,169,85,169,85,165,85,149,90,185,86,171,85,165,85,165,85,85,85,85,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,186,149,170,151,170,149,170,85,170,85,170,170,186,85,170,93,170,85,170,85,169,85,169,170,186,85,170,117,170,85,169,
+85,165,85,165,170,186,85,169,213,169,85,165,85,149,85,149,170,186,86,169,85,167,85,149,85,85,85,85,170,186,90,169,
+86,157,85,85,85,85,85,85,170,186,170,170,90,117,86,85,85,85,85,85,170,186,170,170,170,218,90,85,86,85,86,85,
+170,186,170,170,149,170,151,170,85,170,85,170,170,186,170,170,85,170,93,170,85,169,85,169,170,186,170,170,85,170,117,169,
+85,165,85,165,170,186,170,170,85,169,213,165,85,149,85,149,170,186,170,170,85,165,85,151,85,85,85,85,170,186,170,170,
+86,149,85,93,85,85,85,85,170,186,170,170,90,85,86,117,85,85,85,85,170,186,170,170,170,90,90,213,86,85,86,85,
+170,186,170,170,170,170,149,170,87,170,85,170,170,186,170,170,170,170,85,170,93,169,85,169,170,186,170,170,170,170,85,169,
+117,165,85,165,170,186,170,170,170,170,85,165,213,149,85,149,170,186,170,170,170,170,85,149,85,87,85,85,170,186,170,170,
+170,170,85,85,85,93,85,85,170,186,170,170,170,170,86,85,85,117,85,85,170,186,170,170,170,170,170,86,86,213,86,85,
+170,186,170,170,170,170,170,170,85,170,87,170,170,186,170,170,170,170,170,170,85,169,93,169,170,186,170,170,170,170,170,170,
+85,165,117,165,170,186,170,170,170,170,170,170,85,149,213,149,170,186,170,170,170,170,170,170,85,85,85,87,170,186,170,170,
+170,170,170,170,85,85,85,93,170,186,170,170,170,170,170,170,85,85,85,117,170,186,170,170,170,170,170,170,86,85,86,213,
+170,186,170,170,170,170,170,170,170,170,165,170,170,186,170,170,170,170,170,170,170,170,149,170,170,186,170,170,170,170,170,170,
+170,170,86,170,170,186,170,170,170,170,170,170,170,170,90,169,170,186,170,170,170,170,170,170,170,170,106,165,170,186,170,170,
+170,170,170,170,170,170,170,149,170,186,170,170,170,170,170,170,170,170,170,86,170,186,170,170,170,170,170,170,170,170,170,90,
+149,234,85,170,85,170,85,170,85,170,85,170,85,234,85,170,85,170,85,170,85,170,85,170,85,233,85,169,85,169,85,169,
+85,169,85,169,86,233,85,169,85,169,85,169,85,169,85,169,90,229,86,101,85,101,85,101,85,101,85,101,106,229,90,101,
+86,101,85,101,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+151,234,85,170,85,170,85,170,85,170,85,170,93,234,85,170,85,170,85,170,85,170,85,170,117,233,85,169,85,169,85,169,
+85,169,85,169,214,233,85,169,85,169,85,169,85,169,85,169,90,231,86,101,85,101,85,101,85,101,85,101,106,237,90,101,
+86,101,85,101,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+149,234,87,170,85,170,85,170,85,170,85,170,85,234,93,170,85,170,85,170,85,170,85,169,85,233,117,169,85,169,85,169,
+85,169,85,165,86,233,213,169,85,169,85,169,85,165,85,149,90,229,86,103,85,101,85,101,85,85,85,85,106,229,90,109,
+86,85,85,85,85,85,85,85,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,234,85,170,87,170,85,170,85,170,85,170,170,234,85,170,93,170,85,170,85,169,85,169,170,234,85,169,117,169,85,169,
+85,165,85,165,170,234,85,169,213,169,85,165,85,149,85,149,170,234,86,165,85,103,85,85,85,85,85,85,170,234,90,165,
+86,93,85,85,85,85,85,85,170,234,106,165,90,117,86,85,85,85,85,85,170,234,170,170,106,213,90,85,86,85,86,85,
+170,234,170,170,85,170,87,170,85,170,85,170,170,234,170,170,85,170,93,170,85,169,85,169,170,234,170,170,85,169,117,169,
+85,165,85,165,170,234,170,170,85,169,213,165,85,149,85,149,170,234,170,170,85,165,85,87,85,85,85,85,170,234,170,170,
+86,149,85,93,85,85,85,85,170,234,170,170,90,85,86,117,85,85,85,85,170,234,170,170,106,85,90,213,86,85,86,85,
+170,234,170,170,170,170,85,170,87,170,85,170,170,234,170,170,170,170,85,170,93,169,85,169,170,234,170,170,170,170,85,169,
+117,165,85,165,170,234,170,170,170,170,85,165,213,149,85,149,170,234,170,170,170,170,85,149,85,87,85,85,170,234,170,170,
+170,170,85,85,85,93,85,85,170,234,170,170,170,170,86,85,85,117,85,85,170,234,170,170,170,170,90,85,86,213,86,85,
+170,234,170,170,170,170,170,170,85,170,87,170,170,234,170,170,170,170,170,170,85,169,93,169,170,234,170,170,170,170,170,170,
+85,165,117,165,170,234,170,170,170,170,170,170,85,149,213,149,170,234,170,170,170,170,170,170,85,85,85,87,170,234,170,170,
+170,170,170,170,85,85,85,93,170,234,170,170,170,170,170,170,85,85,85,117,170,234,170,170,170,170,170,170,86,85,86,213,
+170,234,170,170,170,170,170,170,170,170,165,170,170,234,170,170,170,170,170,170,170,170,149,170,170,234,170,170,170,170,170,170,
+170,170,86,170,170,234,170,170,170,170,170,170,170,170,90,169,170,234,170,170,170,170,170,170,170,170,106,165,170,234,170,170,
+170,170,170,170,170,170,170,149,170,234,170,170,170,170,170,170,170,170,170,86,170,234,170,170,170,170,170,170,170,170,170,90,
+149,170,171,170,169,170,169,170,169,170,169,170,89,170,87,169,89,165,89,149,105,85,169,85,86,169,91,165,89,149,89,85,
+105,85,169,85,90,165,91,149,89,85,89,85,105,85,169,85,106,149,107,85,106,85,106,85,106,85,170,85,106,85,107,85,
+106,85,106,85,106,85,170,85,170,85,171,85,170,85,170,85,170,85,170,85,170,86,171,85,170,85,170,85,170,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,118,169,91,165,89,149,89,85,
+89,85,89,85,218,165,91,149,89,85,89,85,89,85,89,85,106,151,107,85,106,85,106,85,106,85,106,85,106,93,107,85,
+106,85,106,85,106,85,106,85,170,117,171,85,170,85,170,85,170,85,170,85,170,214,171,85,170,85,170,85,170,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,90,169,123,165,89,149,89,85,
+89,85,89,85,90,165,219,149,89,85,89,85,89,85,89,85,106,149,107,87,106,85,106,85,106,85,106,85,106,85,107,93,
+106,85,106,85,106,85,106,85,170,85,171,117,170,85,170,85,170,85,170,85,170,86,171,213,170,85,170,85,170,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,91,165,121,149,85,85,
+85,85,85,85,170,170,91,149,217,85,89,85,89,85,85,85,170,170,107,85,106,87,106,85,106,85,90,85,170,170,107,85,
+106,93,106,85,106,85,106,85,170,170,171,85,170,117,170,85,170,85,170,85,170,170,171,85,170,213,170,85,170,85,170,85,
+170,170,171,170,170,170,87,165,85,149,85,149,170,170,171,170,90,165,93,149,85,85,85,85,170,170,171,170,90,149,117,85,
+85,85,85,85,170,170,171,170,90,85,217,85,85,85,85,85,170,170,171,170,106,85,106,87,90,85,90,85,170,170,171,170,
+106,85,106,93,106,85,106,85,170,170,171,170,170,85,170,117,170,85,170,85,170,170,171,170,170,85,170,213,170,85,170,85,
+170,170,171,170,170,170,85,165,87,149,85,149,170,170,171,170,170,170,85,149,93,85,85,85,170,170,171,170,170,170,86,85,
+117,85,85,85,170,170,171,170,170,170,90,85,213,85,85,85,170,170,171,170,170,170,106,85,90,87,90,85,170,170,171,170,
+170,170,106,85,106,93,106,85,170,170,171,170,170,170,170,85,170,117,170,85,170,170,171,170,170,170,170,85,170,213,170,85,
+170,170,171,170,170,170,170,170,85,149,167,170,170,170,171,170,170,170,170,170,85,85,157,85,170,170,171,170,170,170,170,170,
+85,85,118,85,170,170,171,170,170,170,170,170,86,85,218,85,170,170,171,170,170,170,170,170,90,85,106,87,170,170,171,170,
+170,170,170,170,106,85,170,93,170,170,171,170,170,170,170,170,170,85,170,117,170,170,171,170,170,170,170,170,170,85,170,213,
+170,170,171,170,170,170,170,170,170,170,165,170,170,170,171,170,170,170,170,170,170,170,149,170,170,170,171,170,170,170,170,170,
+170,170,86,170,170,170,171,170,170,170,170,170,170,170,90,169,170,170,171,170,170,170,170,170,170,170,106,165,170,170,171,170,
+170,170,170,170,170,170,170,149,170,170,171,170,170,170,170,170,170,170,170,86,170,170,171,170,170,170,170,170,170,170,170,90,
+153,170,157,170,169,170,169,170,169,170,169,170,149,170,173,170,169,170,169,170,169,106,169,106,106,169,93,165,105,149,105,85,
+169,85,169,86,90,165,110,149,105,85,105,85,169,85,169,86,106,149,110,85,106,85,106,85,170,85,170,86,170,85,174,85,
+170,85,170,85,170,85,170,86,170,85,174,85,170,85,170,85,170,85,170,86,170,86,174,86,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,218,165,110,149,105,85,105,85,105,85,105,85,106,151,110,85,106,85,106,85,106,85,106,85,170,93,174,85,
+170,85,170,85,170,85,170,85,170,117,174,85,170,85,170,85,170,85,170,85,170,214,174,86,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,106,165,238,149,106,85,106,85,106,85,106,85,106,149,110,87,106,85,106,85,106,85,106,85,170,85,174,93,
+170,85,170,85,170,85,170,85,170,85,174,117,170,85,170,85,170,85,170,85,170,86,174,214,170,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,110,149,234,85,90,85,90,85,86,85,170,170,110,85,106,87,106,85,106,85,90,85,170,170,174,85,
+170,93,170,85,170,85,106,85,170,170,174,85,170,117,170,85,170,85,170,85,170,170,174,86,170,214,170,86,170,86,170,86,
+170,170,174,170,170,170,167,170,85,149,85,149,170,170,174,170,170,170,93,149,85,85,85,85,170,170,174,170,106,149,118,85,
+85,85,85,85,170,170,174,170,106,85,218,85,86,85,86,85,170,170,174,170,106,85,106,87,90,85,90,85,170,170,174,170,
+170,85,170,93,106,85,106,85,170,170,174,170,170,85,170,117,170,85,170,85,170,170,174,170,170,86,170,214,170,86,170,86,
+170,170,174,170,170,170,165,170,87,149,85,149,170,170,174,170,170,170,85,149,93,85,85,85,170,170,174,170,170,170,86,85,
+117,85,85,85,170,170,174,170,170,170,90,85,214,85,86,85,170,170,174,170,170,170,106,85,90,87,90,85,170,170,174,170,
+170,170,170,85,106,93,106,85,170,170,174,170,170,170,170,85,170,117,170,85,170,170,174,170,170,170,170,86,170,214,170,86,
+170,170,174,170,170,170,170,170,149,170,167,170,170,170,174,170,170,170,170,170,85,85,157,170,170,170,174,170,170,170,170,170,
+85,85,118,86,170,170,174,170,170,170,170,170,86,85,218,85,170,170,174,170,170,170,170,170,90,85,106,87,170,170,174,170,
+170,170,170,170,106,85,170,93,170,170,174,170,170,170,170,170,170,85,170,118,170,170,174,170,170,170,170,170,170,86,170,214,
+170,170,174,170,170,170,170,170,170,170,165,170,170,170,174,170,170,170,170,170,170,170,149,170,170,170,174,170,170,170,170,170,
+170,170,86,170,170,170,174,170,170,170,170,170,170,170,90,169,170,170,174,170,170,170,170,170,170,170,106,165,170,170,174,170,
+170,170,170,170,170,170,170,149,170,170,174,170,170,170,170,170,170,170,170,86,170,170,174,170,170,170,170,170,170,170,170,90,
+165,170,185,170,169,170,169,170,169,170,169,170,169,170,117,170,169,170,169,170,169,106,169,106,86,170,185,170,169,170,169,106,
+169,106,169,106,170,165,118,149,169,85,169,85,169,86,169,90,106,149,186,85,170,85,170,85,170,86,170,90,170,85,186,85,
+170,85,170,85,170,86,170,90,170,86,186,86,170,86,170,86,170,86,170,90,170,86,186,86,170,86,170,86,170,86,170,90,
+167,170,181,170,169,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,106,151,186,85,170,85,170,85,170,85,170,85,170,93,186,85,
+170,85,170,85,170,85,170,85,170,118,186,86,170,86,170,86,170,86,170,86,170,214,186,86,170,86,170,86,170,86,170,86,
+169,170,187,170,169,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,149,186,87,170,85,170,85,170,85,170,85,170,85,186,93,
+170,85,170,85,170,85,170,85,170,86,186,118,170,86,170,86,170,86,170,86,170,86,186,214,170,86,170,86,170,86,170,86,
+170,170,185,170,171,170,165,170,165,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,186,85,170,87,106,85,106,85,90,85,170,170,186,85,
+170,93,170,85,170,85,106,85,170,170,186,86,170,118,170,86,170,86,170,85,170,170,186,86,170,214,170,86,170,86,170,86,
+170,170,186,170,169,170,167,170,149,170,149,170,170,170,186,170,169,170,157,170,85,85,85,85,170,170,186,170,170,170,117,85,
+85,85,85,85,170,170,186,170,170,85,218,85,85,85,85,85,170,170,186,170,170,85,106,87,90,85,90,85,170,170,186,170,
+170,85,170,93,106,85,106,85,170,170,186,170,170,86,170,118,170,85,170,85,170,170,186,170,170,86,170,214,170,86,170,86,
+170,170,186,170,170,170,165,170,151,170,149,170,170,170,186,170,170,170,149,170,93,85,85,85,170,170,186,170,170,170,85,85,
+117,85,85,85,170,170,186,170,170,170,90,85,213,85,85,85,170,170,186,170,170,170,106,85,90,87,90,85,170,170,186,170,
+170,170,170,85,106,93,106,85,170,170,186,170,170,170,170,86,170,117,170,85,170,170,186,170,170,170,170,86,170,214,170,86,
+170,170,186,170,170,170,170,170,149,170,167,170,170,170,186,170,170,170,170,170,85,170,157,170,170,170,186,170,170,170,170,170,
+85,85,118,170,170,170,186,170,170,170,170,170,86,85,218,89,170,170,186,170,170,170,170,170,90,85,106,87,170,170,186,170,
+170,170,170,170,106,85,170,93,170,170,186,170,170,170,170,170,170,85,170,118,170,170,186,170,170,170,170,170,170,86,170,218,
+170,170,186,170,170,170,170,170,170,170,165,170,170,170,186,170,170,170,170,170,170,170,149,170,170,170,186,170,170,170,170,170,
+170,170,86,170,170,170,186,170,170,170,170,170,170,170,90,169,170,170,186,170,170,170,170,170,170,170,106,165,170,170,186,170,
+170,170,170,170,170,170,170,149,170,170,186,170,170,170,170,170,170,170,170,86,170,170,186,170,170,170,170,170,170,170,170,90,
+165,170,229,170,165,170,165,170,169,170,169,170,149,170,229,170,165,170,165,170,169,170,169,170,165,170,213,169,165,170,165,106,
+169,106,169,106,90,169,233,170,169,106,169,106,169,106,169,106,170,150,218,85,169,86,169,86,169,90,169,106,170,85,234,86,
+170,86,170,86,170,90,170,106,170,86,234,86,170,86,170,86,170,90,170,106,170,90,234,90,170,90,170,90,170,90,170,106,
+167,170,229,170,165,170,165,170,165,170,165,170,157,170,229,170,165,170,165,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,93,234,86,
+170,86,170,86,170,86,170,86,170,118,234,86,170,86,170,86,170,86,170,86,170,218,234,90,170,90,170,90,170,90,170,90,
+165,170,231,170,165,170,165,170,165,170,165,170,165,170,237,170,165,170,165,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,86,234,94,
+170,86,170,86,170,86,170,86,170,86,234,118,170,86,170,86,170,86,170,86,170,90,234,218,170,90,170,90,170,90,170,90,
+170,170,229,170,167,170,165,170,165,170,149,170,170,170,229,170,173,170,149,170,149,170,85,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,234,86,
+170,94,170,85,170,85,106,85,170,170,234,86,170,118,170,86,170,86,170,85,170,170,234,90,170,218,170,90,170,90,170,86,
+170,170,234,170,165,170,167,170,149,170,149,170,170,170,234,170,165,170,157,170,85,170,85,170,170,170,234,170,165,170,117,170,
+85,85,85,85,170,170,234,170,170,170,213,85,85,85,85,85,170,170,234,170,170,86,106,87,85,85,85,85,170,170,234,170,
+170,86,170,93,106,85,106,85,170,170,234,170,170,86,170,118,170,85,170,85,170,170,234,170,170,90,170,218,170,86,170,86,
+170,170,234,170,170,170,165,170,151,170,149,170,170,170,234,170,170,170,149,170,93,170,85,170,170,170,234,170,170,170,85,170,
+117,85,85,85,170,170,234,170,170,170,85,85,213,85,85,85,170,170,234,170,170,170,106,85,85,87,85,85,170,170,234,170,
+170,170,170,85,106,93,106,85,170,170,234,170,170,170,170,86,170,117,170,85,170,170,234,170,170,170,170,90,170,214,170,86,
+170,170,234,170,170,170,170,170,149,170,167,170,170,170,234,170,170,170,170,170,85,170,157,170,170,170,234,170,170,170,170,170,
+85,169,118,170,170,170,234,170,170,170,170,170,85,85,218,169,170,170,234,170,170,170,170,170,90,85,106,103,170,170,234,170,
+170,170,170,170,106,85,170,93,170,170,234,170,170,170,170,170,170,85,170,118,170,170,234,170,170,170,170,170,170,86,170,218,
+170,170,234,170,170,170,170,170,170,170,165,170,170,170,234,170,170,170,170,170,170,170,149,170,170,170,234,170,170,170,170,170,
+170,170,86,170,170,170,234,170,170,170,170,170,170,170,90,169,170,170,234,170,170,170,170,170,170,170,106,165,170,170,234,170,
+170,170,170,170,170,170,170,149,170,170,234,170,170,170,170,170,170,170,170,86,170,170,234,170,170,170,170,170,170,170,170,90,
+165,170,165,171,165,170,165,170,165,170,169,170,149,170,149,171,149,170,149,170,165,170,169,170,85,170,149,171,149,170,149,170,
+165,170,169,170,150,170,85,167,149,106,149,106,165,106,169,106,106,165,170,107,169,106,169,106,169,106,169,106,170,90,106,87,
+170,90,169,90,169,106,169,106,170,86,170,91,170,90,170,90,170,106,170,106,170,90,170,91,170,90,170,90,170,106,170,106,
+167,170,165,171,165,170,165,170,165,170,165,170,157,170,149,171,149,170,149,170,149,170,149,170,117,170,149,171,149,170,149,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,118,170,91,170,90,170,90,170,90,170,90,170,218,170,91,170,90,170,90,170,90,170,90,
+165,170,167,171,165,170,165,170,165,170,165,170,149,170,157,171,149,170,149,170,149,170,149,170,149,170,181,171,149,170,149,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,90,170,123,170,90,170,90,170,90,170,90,170,90,170,219,170,90,170,90,170,90,170,90,
+170,170,165,171,167,170,165,170,165,170,149,170,170,170,149,171,157,170,149,170,149,170,85,170,170,170,149,171,181,170,85,170,
+85,170,85,169,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,91,170,122,170,86,170,86,170,85,170,170,170,91,170,218,170,90,170,90,170,86,
+170,170,170,171,165,170,167,170,149,170,149,170,170,170,170,171,149,170,157,170,85,170,85,170,170,170,170,171,149,170,117,170,
+85,169,85,169,170,170,170,171,149,170,213,169,85,85,85,85,170,170,170,171,170,170,85,87,85,85,85,85,170,170,170,171,
+170,90,170,93,85,85,85,85,170,170,170,171,170,90,170,118,170,85,170,85,170,170,170,171,170,90,170,218,170,86,170,86,
+170,170,170,171,170,170,165,170,151,170,149,170,170,170,170,171,170,170,149,170,93,170,85,170,170,170,170,171,170,170,85,170,
+117,169,85,169,170,170,170,171,170,170,85,169,213,85,85,85,170,170,170,171,170,170,85,85,85,87,85,85,170,170,170,171,
+170,170,170,85,85,93,85,85,170,170,170,171,170,170,170,86,170,117,170,85,170,170,170,171,170,170,170,90,170,214,170,86,
+170,170,170,171,170,170,170,170,149,170,167,170,170,170,170,171,170,170,170,170,85,170,157,170,170,170,170,171,170,170,170,170,
+85,169,117,170,170,170,170,171,170,170,170,170,85,165,217,169,170,170,170,171,170,170,170,170,85,85,106,167,170,170,170,171,
+170,170,170,170,106,85,170,157,170,170,170,171,170,170,170,170,170,85,170,118,170,170,170,171,170,170,170,170,170,86,170,218,
+170,170,170,171,170,170,170,170,170,170,165,170,170,170,170,171,170,170,170,170,170,170,149,170,170,170,170,171,170,170,170,170,
+170,170,86,170,170,170,170,171,170,170,170,170,170,170,90,169,170,170,170,171,170,170,170,170,170,170,106,165,170,170,170,171,
+170,170,170,170,170,170,170,149,170,170,170,171,170,170,170,170,170,170,170,86,170,170,170,171,170,170,170,170,170,170,170,90,
+149,170,149,174,149,170,149,170,149,170,165,170,149,170,149,174,149,170,149,170,149,170,165,170,85,170,85,174,85,170,85,170,
+149,170,165,170,86,169,85,174,85,170,85,170,149,170,165,170,90,170,86,157,85,106,85,106,149,106,165,106,170,149,170,110,
+170,106,169,106,169,106,169,106,170,106,170,93,170,106,170,106,169,106,169,106,170,90,170,110,170,106,170,106,170,106,170,106,
+151,170,149,174,149,170,149,170,149,170,149,170,157,170,149,174,149,170,149,170,149,170,149,170,117,170,85,174,85,170,85,170,
+85,170,85,170,214,169,85,174,85,170,85,170,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,218,170,94,170,106,170,106,170,106,170,106,
+149,170,151,174,149,170,149,170,149,170,149,170,149,170,157,174,149,170,149,170,149,170,149,170,85,170,117,174,85,170,85,170,
+85,170,85,170,86,170,213,174,85,170,85,170,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,106,170,238,170,106,170,106,170,106,170,106,
+170,170,149,174,151,170,149,170,149,170,149,170,170,170,149,174,157,170,149,170,149,170,85,170,170,170,85,174,117,170,85,170,
+85,170,85,169,170,170,85,174,213,170,85,169,85,169,85,165,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,110,170,234,170,90,170,90,170,86,
+170,170,170,174,149,170,151,170,149,170,149,170,170,170,170,174,149,170,157,170,85,170,85,170,170,170,170,174,85,170,117,170,
+85,169,85,169,170,170,170,174,85,170,213,169,85,165,85,165,170,170,170,174,85,170,85,167,85,85,85,85,170,170,170,174,
+170,170,85,93,85,85,85,85,170,170,170,174,170,106,170,118,85,85,85,85,170,170,170,174,170,106,170,218,170,86,170,86,
+170,170,170,174,170,170,149,170,151,170,149,170,170,170,170,174,170,170,149,170,93,170,85,170,170,170,170,174,170,170,85,170,
+117,169,85,169,170,170,170,174,170,170,85,169,213,165,85,165,170,170,170,174,170,170,85,165,85,87,85,85,170,170,170,174,
+170,170,85,85,85,93,85,85,170,170,170,174,170,170,170,86,85,117,85,85,170,170,170,174,170,170,170,90,170,214,170,86,
+170,170,170,174,170,170,170,170,149,170,167,170,170,170,170,174,170,170,170,170,85,170,157,170,170,170,170,174,170,170,170,170,
+85,169,117,170,170,170,170,174,170,170,170,170,85,165,213,169,170,170,170,174,170,170,170,170,85,149,101,167,170,170,170,174,
+170,170,170,170,85,85,170,157,170,170,170,174,170,170,170,170,170,85,170,118,170,170,170,174,170,170,170,170,170,86,170,218,
+170,170,170,174,170,170,170,170,170,170,165,170,170,170,170,174,170,170,170,170,170,170,149,170,170,170,170,174,170,170,170,170,
+170,170,86,170,170,170,170,174,170,170,170,170,170,170,90,169,170,170,170,174,170,170,170,170,170,170,106,165,170,170,170,174,
+170,170,170,170,170,170,170,149,170,170,170,174,170,170,170,170,170,170,170,86,170,170,170,174,170,170,170,170,170,170,170,90,
+149,170,149,186,149,170,149,170,149,170,149,170,85,170,85,186,85,170,85,170,85,170,149,170,85,170,85,186,85,170,85,170,
+85,170,149,170,86,169,85,185,85,169,85,169,85,170,149,170,90,165,86,185,85,105,85,105,85,106,149,106,106,169,90,117,
+86,105,85,105,85,106,149,106,170,86,170,122,170,106,170,106,169,106,169,106,170,102,170,118,170,106,170,106,170,106,170,106,
+151,170,149,186,149,170,149,170,149,170,149,170,93,170,85,186,85,170,85,170,85,170,85,170,117,170,85,186,85,170,85,170,
+85,170,85,170,214,169,85,185,85,169,85,169,85,169,85,169,90,167,86,185,85,105,85,105,85,105,85,105,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+149,170,151,186,149,170,149,170,149,170,149,170,85,170,93,186,85,170,85,170,85,170,85,170,85,170,117,186,85,170,85,170,
+85,170,85,170,86,169,213,185,85,169,85,169,85,169,85,169,90,169,86,187,85,169,85,169,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,149,186,151,170,149,170,149,170,149,170,170,170,85,186,93,170,85,170,85,170,85,170,170,170,85,186,117,170,85,170,
+85,170,85,169,170,170,85,185,213,169,85,169,85,169,85,165,170,170,86,185,85,171,85,165,85,165,85,149,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,186,149,170,151,170,149,170,149,170,170,170,170,186,85,170,93,170,85,170,85,170,170,170,170,186,85,170,117,170,
+85,169,85,169,170,170,170,186,85,169,213,169,85,165,85,165,170,170,170,186,85,169,85,167,85,149,85,149,170,170,170,186,
+86,169,85,157,85,85,85,85,170,170,170,186,170,170,86,117,85,85,85,85,170,170,170,186,170,170,170,218,86,85,86,85,
+170,170,170,186,170,170,149,170,151,170,149,170,170,170,170,186,170,170,85,170,93,170,85,170,170,170,170,186,170,170,85,170,
+117,169,85,169,170,170,170,186,170,170,85,169,213,165,85,165,170,170,170,186,170,170,85,165,85,151,85,149,170,170,170,186,
+170,170,85,149,85,93,85,85,170,170,170,186,170,170,86,85,85,117,85,85,170,170,170,186,170,170,170,90,86,213,86,85,
+170,170,170,186,170,170,170,170,149,170,151,170,170,170,170,186,170,170,170,170,85,170,157,170,170,170,170,186,170,170,170,170,
+85,169,117,170,170,170,170,186,170,170,170,170,85,165,213,169,170,170,170,186,170,170,170,170,85,149,85,167,170,170,170,186,
+170,170,170,170,85,85,149,157,170,170,170,186,170,170,170,170,85,85,170,118,170,170,170,186,170,170,170,170,170,86,170,218,
+170,170,170,186,170,170,170,170,170,170,165,170,170,170,170,186,170,170,170,170,170,170,149,170,170,170,170,186,170,170,170,170,
+170,170,86,170,170,170,170,186,170,170,170,170,170,170,90,169,170,170,170,186,170,170,170,170,170,170,106,165,170,170,170,186,
+170,170,170,170,170,170,170,149,170,170,170,186,170,170,170,170,170,170,170,86,170,170,170,186,170,170,170,170,170,170,170,90,
+149,170,85,234,85,170,85,170,85,170,85,170,85,170,85,234,85,170,85,170,85,170,85,170,85,169,85,233,85,169,85,169,
+85,169,85,170,86,169,85,233,85,169,85,169,85,169,85,170,90,165,86,229,85,101,85,101,85,105,85,106,106,149,90,229,
+86,101,85,101,85,105,85,106,170,101,106,213,90,101,86,101,85,105,85,106,170,86,170,234,170,106,170,106,170,106,170,106,
+151,170,85,234,85,170,85,170,85,170,85,170,93,170,85,234,85,170,85,170,85,170,85,170,117,169,85,233,85,169,85,169,
+85,169,85,169,214,169,85,233,85,169,85,169,85,169,85,169,90,167,86,229,85,101,85,101,85,101,85,101,106,157,90,229,
+86,101,85,101,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+149,170,87,234,85,170,85,170,85,170,85,170,85,170,93,234,85,170,85,170,85,170,85,170,85,169,117,233,85,169,85,169,
+85,169,85,169,86,169,213,233,85,169,85,169,85,169,85,169,90,165,86,231,85,101,85,101,85,101,85,101,106,165,90,237,
+86,101,85,101,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,85,234,87,170,85,170,85,170,85,170,170,170,85,234,93,170,85,170,85,170,85,170,170,170,85,233,117,169,85,169,
+85,169,85,169,170,170,85,233,213,169,85,169,85,169,85,165,170,170,86,229,85,103,85,101,85,101,85,85,170,170,90,229,
+86,109,85,85,85,85,85,85,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,234,85,170,87,170,85,170,85,170,170,170,170,234,85,170,93,170,85,170,85,170,170,170,170,234,85,169,117,169,
+85,169,85,169,170,170,170,234,85,169,213,169,85,165,85,165,170,170,170,234,85,165,85,103,85,85,85,85,170,170,170,234,
+86,165,85,93,85,85,85,85,170,170,170,234,90,165,86,117,85,85,85,85,170,170,170,234,170,170,90,213,86,85,86,85,
+170,170,170,234,170,170,85,170,87,170,85,170,170,170,170,234,170,170,85,170,93,170,85,170,170,170,170,234,170,170,85,169,
+117,169,85,169,170,170,170,234,170,170,85,169,213,165,85,165,170,170,170,234,170,170,85,165,85,87,85,85,170,170,170,234,
+170,170,85,149,85,93,85,85,170,170,170,234,170,170,86,85,85,117,85,85,170,170,170,234,170,170,90,85,86,213,86,85,
+170,170,170,234,170,170,170,170,85,170,87,170,170,170,170,234,170,170,170,170,85,170,93,170,170,170,170,234,170,170,170,170,
+85,169,117,170,170,170,170,234,170,170,170,170,85,165,213,169,170,170,170,234,170,170,170,170,85,149,85,167,170,170,170,234,
+170,170,170,170,85,85,85,157,170,170,170,234,170,170,170,170,85,85,85,118,170,170,170,234,170,170,170,170,86,85,170,218,
+170,170,170,234,170,170,170,170,170,170,165,170,170,170,170,234,170,170,170,170,170,170,149,170,170,170,170,234,170,170,170,170,
+170,170,86,170,170,170,170,234,170,170,170,170,170,170,90,169,170,170,170,234,170,170,170,170,170,170,106,165,170,170,170,234,
+170,170,170,170,170,170,170,149,170,170,170,234,170,170,170,170,170,170,170,86,170,170,170,234,170,170,170,170,170,170,170,90,
+149,170,165,170,87,169,85,169,169,170,169,170,85,170,85,169,87,165,85,149,105,85,169,85,85,169,85,165,87,149,89,85,
+105,85,169,85,86,165,89,149,91,85,89,85,105,85,169,85,90,149,106,85,107,85,105,85,105,85,169,85,106,85,106,85,
+107,85,106,85,106,85,170,85,170,85,170,85,171,85,170,85,170,85,170,85,170,86,170,85,171,85,170,85,170,85,170,85,
+151,170,165,170,87,169,169,170,169,170,169,170,93,170,85,169,87,165,85,149,89,85,105,85,117,169,85,165,87,149,89,85,
+89,85,105,85,214,165,89,149,91,85,89,85,89,85,105,85,90,151,106,85,107,85,105,85,105,85,105,85,106,93,106,85,
+107,85,106,85,106,85,106,85,170,117,170,85,171,85,170,85,170,85,170,85,170,214,170,85,171,85,170,85,170,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,85,169,117,165,87,149,89,85,
+89,85,89,85,86,165,217,149,91,85,89,85,89,85,89,85,90,149,106,87,107,85,105,85,105,85,105,85,106,85,106,93,
+107,85,106,85,106,85,106,85,170,85,170,117,171,85,170,85,170,85,170,85,170,86,170,213,171,85,170,85,170,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,89,165,123,149,89,85,
+89,85,89,85,170,170,89,149,219,85,89,85,89,85,89,85,170,170,106,85,107,87,106,85,106,85,106,85,170,170,106,85,
+107,93,106,85,106,85,106,85,170,170,170,85,171,117,170,85,170,85,170,85,170,170,170,85,171,213,170,85,170,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,91,149,121,85,
+85,85,85,85,170,170,170,170,91,85,217,85,89,85,89,85,170,170,170,170,107,85,106,87,106,85,106,85,170,170,170,170,
+107,85,106,93,106,85,106,85,170,170,170,170,171,85,170,117,170,85,170,85,170,170,170,170,171,85,170,213,170,85,170,85,
+170,170,170,170,171,170,170,170,87,149,165,170,170,170,170,170,171,170,90,149,93,85,85,85,170,170,170,170,171,170,90,85,
+117,85,85,85,170,170,170,170,171,170,90,85,217,85,89,85,170,170,170,170,171,170,106,85,106,87,106,85,170,170,170,170,
+171,170,106,85,106,93,106,85,170,170,170,170,171,170,170,85,170,117,170,85,170,170,170,170,171,170,170,85,170,213,170,85,
+170,170,170,170,171,170,170,170,85,149,167,170,170,170,170,170,171,170,170,170,85,85,157,85,170,170,170,170,171,170,170,170,
+86,85,118,85,170,170,170,170,171,170,170,170,90,85,218,85,170,170,170,170,171,170,170,170,106,85,106,87,170,170,170,170,
+171,170,170,170,106,85,170,93,170,170,170,170,171,170,170,170,170,85,170,117,170,170,170,170,171,170,170,170,170,85,170,213,
+170,170,170,170,171,170,170,170,170,170,165,170,170,170,170,170,171,170,170,170,170,170,149,170,170,170,170,170,171,170,170,170,
+170,170,86,170,170,170,170,170,171,170,170,170,170,170,90,169,170,170,170,170,171,170,170,170,170,170,106,165,170,170,170,170,
+171,170,170,170,170,170,170,149,170,170,170,170,171,170,170,170,170,170,170,86,170,170,170,170,171,170,170,170,170,170,170,90,
+149,170,165,170,157,170,85,165,169,170,169,170,85,170,149,170,93,165,85,165,169,106,169,106,85,169,85,165,93,149,85,85,
+169,85,169,86,86,165,89,149,93,85,105,85,169,85,169,86,90,149,106,85,109,85,105,85,169,85,169,86,106,85,170,85,
+174,85,170,85,170,85,170,86,170,85,170,85,174,85,170,85,170,85,170,86,170,86,170,86,174,86,170,86,170,86,170,86,
+151,170,165,170,157,170,85,165,169,170,169,170,93,170,149,170,93,165,169,170,169,106,169,106,117,169,85,165,93,149,85,85,
+105,85,169,85,214,165,89,149,93,85,105,85,105,85,169,85,90,151,106,85,109,85,105,85,105,85,169,85,106,93,170,85,
+174,85,170,85,170,85,170,85,170,117,170,85,174,85,170,85,170,85,170,85,170,214,170,86,174,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,86,165,217,149,93,85,105,85,105,85,105,85,90,149,106,87,109,85,105,85,105,85,105,85,106,85,170,93,
+174,85,170,85,170,85,170,85,170,85,170,117,174,85,170,85,170,85,170,85,170,86,170,214,174,86,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,106,149,238,85,106,85,106,85,106,85,170,170,106,85,110,87,106,85,106,85,106,85,170,170,170,85,
+174,93,170,85,170,85,170,85,170,170,170,85,174,117,170,85,170,85,170,85,170,170,170,86,174,214,170,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,110,85,234,85,90,85,90,85,170,170,170,170,110,85,106,87,106,85,106,85,170,170,170,170,
+174,85,170,93,170,85,170,85,170,170,170,170,174,85,170,117,170,85,170,85,170,170,170,170,174,86,170,214,170,86,170,86,
+170,170,170,170,174,170,170,170,167,170,165,170,170,170,170,170,174,170,170,170,93,85,149,170,170,170,170,170,174,170,106,85,
+118,85,86,85,170,170,170,170,174,170,106,85,218,85,90,85,170,170,170,170,174,170,106,85,106,87,106,85,170,170,170,170,
+174,170,170,85,170,93,170,85,170,170,170,170,174,170,170,85,170,117,170,85,170,170,170,170,174,170,170,86,170,214,170,86,
+170,170,170,170,174,170,170,170,165,170,167,170,170,170,170,170,174,170,170,170,85,85,157,170,170,170,170,170,174,170,170,170,
+86,85,118,86,170,170,170,170,174,170,170,170,90,85,218,85,170,170,170,170,174,170,170,170,106,85,106,87,170,170,170,170,
+174,170,170,170,170,85,170,93,170,170,170,170,174,170,170,170,170,85,170,118,170,170,170,170,174,170,170,170,170,86,170,214,
+170,170,170,170,174,170,170,170,170,170,165,170,170,170,170,170,174,170,170,170,170,170,149,170,170,170,170,170,174,170,170,170,
+170,170,86,170,170,170,170,170,174,170,170,170,170,170,90,169,170,170,170,170,174,170,170,170,170,170,106,165,170,170,170,170,
+174,170,170,170,170,170,170,149,170,170,170,170,174,170,170,170,170,170,170,86,170,170,170,170,174,170,170,170,170,170,170,90,
+149,170,165,170,181,170,169,170,169,170,169,170,85,170,149,170,117,170,85,149,169,106,169,106,85,169,85,170,117,149,85,85,
+169,106,169,106,86,165,89,149,117,85,85,85,169,86,169,90,90,149,106,85,121,85,169,85,169,86,169,90,106,85,170,85,
+186,85,170,85,170,86,170,90,170,85,170,86,186,86,170,86,170,86,170,90,170,86,170,86,186,86,170,86,170,86,170,90,
+151,170,165,170,181,170,169,170,169,170,169,170,93,170,149,170,117,170,85,149,169,106,169,106,117,169,85,170,117,149,169,106,
+169,106,169,106,214,165,89,149,117,85,85,85,169,85,169,86,90,151,106,85,121,85,169,85,169,85,169,86,106,93,170,85,
+186,85,170,85,170,85,170,86,170,117,170,86,186,86,170,86,170,86,170,86,170,214,170,86,186,86,170,86,170,86,170,86,
+149,170,167,170,181,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,90,149,106,87,121,85,169,85,169,85,169,85,106,85,170,93,
+186,85,170,85,170,85,170,85,170,85,170,118,186,86,170,86,170,86,170,86,170,86,170,214,186,86,170,86,170,86,170,86,
+170,170,169,170,187,170,169,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,85,186,87,170,85,170,85,170,85,170,170,170,85,
+186,93,170,85,170,85,170,85,170,170,170,86,186,118,170,86,170,86,170,86,170,170,170,86,186,214,170,86,170,86,170,86,
+170,170,170,170,185,170,171,170,165,170,165,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,186,85,170,87,106,85,106,85,170,170,170,170,
+186,85,170,93,170,85,170,85,170,170,170,170,186,86,170,118,170,86,170,86,170,170,170,170,186,86,170,214,170,86,170,86,
+170,170,170,170,186,170,169,170,167,170,165,170,170,170,170,170,186,170,169,170,157,170,149,170,170,170,170,170,186,170,170,170,
+117,85,86,170,170,170,170,170,186,170,170,85,218,85,90,85,170,170,170,170,186,170,170,85,106,87,106,85,170,170,170,170,
+186,170,170,85,170,93,170,85,170,170,170,170,186,170,170,86,170,118,170,86,170,170,170,170,186,170,170,86,170,214,170,86,
+170,170,170,170,186,170,170,170,165,170,167,170,170,170,170,170,186,170,170,170,149,170,157,170,170,170,170,170,186,170,170,170,
+85,85,118,170,170,170,170,170,186,170,170,170,90,85,218,89,170,170,170,170,186,170,170,170,106,85,106,87,170,170,170,170,
+186,170,170,170,170,85,170,93,170,170,170,170,186,170,170,170,170,86,170,118,170,170,170,170,186,170,170,170,170,86,170,218,
+170,170,170,170,186,170,170,170,170,170,165,170,170,170,170,170,186,170,170,170,170,170,149,170,170,170,170,170,186,170,170,170,
+170,170,86,170,170,170,170,170,186,170,170,170,170,170,90,169,170,170,170,170,186,170,170,170,170,170,106,165,170,170,170,170,
+186,170,170,170,170,170,170,149,170,170,170,170,186,170,170,170,170,170,170,86,170,170,170,170,186,170,170,170,170,170,170,90,
+149,170,165,170,229,170,165,170,169,170,169,170,85,170,149,170,213,170,165,170,169,170,169,170,85,169,85,170,213,169,85,85,
+169,106,169,106,86,165,89,169,213,85,85,85,169,106,169,106,90,149,106,85,217,85,85,85,169,90,169,106,106,85,170,85,
+234,85,170,86,170,90,170,106,170,85,170,86,234,86,170,86,170,90,170,106,170,86,170,90,234,90,170,90,170,90,170,106,
+151,170,165,170,229,170,165,170,165,170,169,170,93,170,149,170,213,170,165,170,165,170,169,170,117,169,85,170,213,169,85,85,
+165,106,169,106,214,165,89,169,213,85,169,106,169,106,169,106,90,151,106,85,217,85,85,85,169,86,169,90,106,93,170,85,
+234,85,170,86,170,86,170,90,170,117,170,86,234,86,170,86,170,86,170,90,170,214,170,90,234,90,170,90,170,90,170,90,
+149,170,167,170,229,170,165,170,165,170,165,170,85,170,157,170,213,170,165,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,106,85,170,93,
+234,85,170,86,170,86,170,86,170,85,170,118,234,86,170,86,170,86,170,86,170,86,170,218,234,90,170,90,170,90,170,90,
+170,170,165,170,231,170,165,170,165,170,165,170,170,170,165,170,237,170,165,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,86,
+234,94,170,86,170,86,170,86,170,170,170,86,234,118,170,86,170,86,170,86,170,170,170,90,234,218,170,90,170,90,170,90,
+170,170,170,170,229,170,167,170,165,170,165,170,170,170,170,170,229,170,173,170,149,170,149,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+234,86,170,94,170,85,170,85,170,170,170,170,234,86,170,118,170,86,170,86,170,170,170,170,234,90,170,218,170,90,170,90,
+170,170,170,170,234,170,165,170,167,170,165,170,170,170,170,170,234,170,165,170,157,170,149,170,170,170,170,170,234,170,165,170,
+117,170,85,170,170,170,170,170,234,170,170,170,213,85,90,169,170,170,170,170,234,170,170,86,106,87,106,85,170,170,170,170,
+234,170,170,86,170,93,170,85,170,170,170,170,234,170,170,86,170,118,170,86,170,170,170,170,234,170,170,90,170,218,170,90,
+170,170,170,170,234,170,170,170,165,170,167,170,170,170,170,170,234,170,170,170,149,170,157,170,170,170,170,170,234,170,170,170,
+85,170,118,170,170,170,170,170,234,170,170,170,85,85,218,169,170,170,170,170,234,170,170,170,106,85,106,103,170,170,170,170,
+234,170,170,170,170,85,170,93,170,170,170,170,234,170,170,170,170,86,170,118,170,170,170,170,234,170,170,170,170,90,170,218,
+170,170,170,170,234,170,170,170,170,170,165,170,170,170,170,170,234,170,170,170,170,170,149,170,170,170,170,170,234,170,170,170,
+170,170,86,170,170,170,170,170,234,170,170,170,170,170,90,169,170,170,170,170,234,170,170,170,170,170,106,165,170,170,170,170,
+234,170,170,170,170,170,170,149,170,170,170,170,234,170,170,170,170,170,170,86,170,170,170,170,234,170,170,170,170,170,170,90,
+149,170,165,170,165,171,165,170,165,170,169,170,85,170,149,170,149,171,149,170,165,170,169,170,85,169,85,170,85,171,149,170,
+165,170,169,170,86,165,85,169,85,103,85,85,165,106,169,106,90,149,106,101,85,87,85,85,169,106,169,106,106,85,170,85,
+106,87,85,85,169,106,169,106,170,85,170,86,170,87,170,90,170,106,170,106,170,86,170,90,170,91,170,90,170,106,170,106,
+151,170,165,170,165,171,165,170,165,170,165,170,93,170,149,170,149,171,149,170,149,170,165,170,117,169,85,170,85,171,149,170,
+149,170,165,170,214,165,85,169,85,103,85,85,149,106,165,106,90,151,106,101,85,87,169,106,169,106,169,106,106,93,170,85,
+106,87,85,85,169,90,169,106,170,117,170,86,170,87,170,90,170,90,170,106,170,214,170,90,170,91,170,90,170,90,170,106,
+149,170,167,170,165,171,165,170,165,170,165,170,85,170,157,170,149,171,149,170,149,170,149,170,85,169,117,170,85,171,149,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,85,170,118,170,87,170,90,170,90,170,90,170,86,170,218,170,91,170,90,170,90,170,90,
+170,170,165,170,167,171,165,170,165,170,165,170,170,170,149,170,157,171,149,170,149,170,149,170,170,170,149,170,181,171,149,170,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,90,170,123,170,90,170,90,170,90,170,170,170,90,170,219,170,90,170,90,170,90,
+170,170,170,170,165,171,167,170,165,170,165,170,170,170,170,170,149,171,157,170,149,170,149,170,170,170,170,170,149,171,181,170,
+85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,91,170,122,170,86,170,86,170,170,170,170,170,91,170,218,170,90,170,90,
+170,170,170,170,170,171,165,170,167,170,165,170,170,170,170,170,170,171,149,170,157,170,149,170,170,170,170,170,170,171,149,170,
+117,170,85,170,170,170,170,170,170,171,149,170,213,169,85,169,170,170,170,170,170,171,170,170,85,87,106,165,170,170,170,170,
+170,171,170,90,170,93,170,85,170,170,170,170,170,171,170,90,170,118,170,86,170,170,170,170,170,171,170,90,170,218,170,90,
+170,170,170,170,170,171,170,170,165,170,167,170,170,170,170,170,170,171,170,170,149,170,157,170,170,170,170,170,170,171,170,170,
+85,170,117,170,170,170,170,170,170,171,170,170,85,169,217,169,170,170,170,170,170,171,170,170,85,85,106,167,170,170,170,170,
+170,171,170,170,170,85,170,157,170,170,170,170,170,171,170,170,170,86,170,118,170,170,170,170,170,171,170,170,170,90,170,218,
+170,170,170,170,170,171,170,170,170,170,165,170,170,170,170,170,170,171,170,170,170,170,149,170,170,170,170,170,170,171,170,170,
+170,170,86,170,170,170,170,170,170,171,170,170,170,170,90,169,170,170,170,170,170,171,170,170,170,170,106,165,170,170,170,170,
+170,171,170,170,170,170,170,149,170,170,170,170,170,171,170,170,170,170,170,86,170,170,170,170,170,171,170,170,170,170,170,90,
+149,170,149,170,149,174,149,170,149,170,165,170,85,170,149,170,149,174,149,170,149,170,165,170,85,169,85,170,85,174,85,170,
+149,170,165,170,86,165,85,169,85,109,85,106,149,106,165,106,90,149,86,101,85,93,85,85,149,106,165,106,106,85,170,85,
+86,93,85,85,169,106,169,106,170,85,170,86,170,93,86,85,169,106,169,106,170,86,170,90,170,94,170,106,170,106,170,106,
+151,170,149,170,149,174,149,170,149,170,149,170,93,170,149,170,149,174,149,170,149,170,149,170,117,169,85,170,85,174,85,170,
+85,170,149,170,214,165,85,169,85,109,85,106,85,106,149,106,90,151,86,101,85,93,85,85,85,106,149,106,106,93,170,85,
+86,93,169,106,169,106,169,106,170,117,170,86,170,93,86,85,169,106,169,106,170,214,170,90,170,94,170,106,170,106,170,106,
+149,170,151,170,149,174,149,170,149,170,149,170,85,170,157,170,149,174,149,170,149,170,149,170,85,169,117,170,85,174,85,170,
+85,170,85,170,86,165,213,169,85,109,85,106,85,106,85,106,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,86,170,218,170,94,170,106,170,106,170,106,
+170,170,149,170,151,174,149,170,149,170,149,170,170,170,149,170,157,174,149,170,149,170,149,170,170,170,85,170,117,174,85,170,
+85,170,85,170,170,170,85,170,213,174,85,170,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,106,170,238,170,106,170,106,170,106,
+170,170,170,170,149,174,151,170,149,170,149,170,170,170,170,170,149,174,157,170,149,170,149,170,170,170,170,170,85,174,117,170,
+85,170,85,170,170,170,170,170,85,174,213,170,85,169,85,169,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,110,170,234,170,90,170,90,
+170,170,170,170,170,174,149,170,151,170,149,170,170,170,170,170,170,174,149,170,157,170,149,170,170,170,170,170,170,174,85,170,
+117,170,85,170,170,170,170,170,170,174,85,170,213,169,85,169,170,170,170,170,170,174,85,170,85,167,85,165,170,170,170,170,
+170,174,170,170,85,93,170,149,170,170,170,170,170,174,170,106,170,118,170,86,170,170,170,170,170,174,170,106,170,218,170,90,
+170,170,170,170,170,174,170,170,149,170,167,170,170,170,170,170,170,174,170,170,149,170,157,170,170,170,170,170,170,174,170,170,
+85,170,117,170,170,170,170,170,170,174,170,170,85,169,213,169,170,170,170,170,170,174,170,170,85,165,101,167,170,170,170,170,
+170,174,170,170,85,85,170,157,170,170,170,170,170,174,170,170,170,86,170,118,170,170,170,170,170,174,170,170,170,90,170,218,
+170,170,170,170,170,174,170,170,170,170,165,170,170,170,170,170,170,174,170,170,170,170,149,170,170,170,170,170,170,174,170,170,
+170,170,86,170,170,170,170,170,170,174,170,170,170,170,90,169,170,170,170,170,170,174,170,170,170,170,106,165,170,170,170,170,
+170,174,170,170,170,170,170,149,170,170,170,170,170,174,170,170,170,170,170,86,170,170,170,170,170,174,170,170,170,170,170,90,
+149,170,149,170,149,186,149,170,149,170,149,170,85,170,85,170,85,186,85,170,85,170,149,170,85,169,85,170,85,186,85,170,
+85,170,149,170,86,165,85,169,85,121,85,105,85,106,149,106,90,149,86,101,85,117,85,105,85,106,149,106,106,85,90,85,
+86,117,85,85,85,106,149,106,170,85,170,86,90,117,90,85,169,106,169,106,170,86,170,90,170,118,90,85,170,106,170,106,
+151,170,149,170,149,186,149,170,149,170,149,170,93,170,85,170,85,186,85,170,85,170,85,170,117,169,85,170,85,186,85,170,
+85,170,85,170,214,165,85,169,85,121,85,105,85,105,85,106,90,151,86,101,85,117,85,105,85,105,85,106,106,93,90,85,
+86,117,85,85,85,105,85,106,170,117,170,86,90,117,170,106,169,106,169,106,170,214,170,90,170,118,90,85,170,106,170,106,
+149,170,151,170,149,186,149,170,149,170,149,170,85,170,93,170,85,186,85,170,85,170,85,170,85,169,117,170,85,186,85,170,
+85,170,85,170,86,165,213,169,85,121,85,105,85,105,85,105,90,149,86,103,85,117,85,105,85,105,85,105,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,149,170,151,186,149,170,149,170,149,170,170,170,85,170,93,186,85,170,85,170,85,170,170,170,85,170,117,186,85,170,
+85,170,85,170,170,170,85,169,213,185,85,169,85,169,85,169,170,170,86,169,85,187,85,169,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,149,186,151,170,149,170,149,170,170,170,170,170,85,186,93,170,85,170,85,170,170,170,170,170,85,186,117,170,
+85,170,85,170,170,170,170,170,85,185,213,169,85,169,85,169,170,170,170,170,85,185,85,171,85,165,85,165,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,186,149,170,151,170,149,170,170,170,170,170,170,186,85,170,93,170,85,170,170,170,170,170,170,186,85,170,
+117,170,85,170,170,170,170,170,170,186,85,169,213,169,85,169,170,170,170,170,170,186,85,169,85,167,85,165,170,170,170,170,
+170,186,85,169,85,157,85,149,170,170,170,170,170,186,170,170,85,117,170,86,170,170,170,170,170,186,170,170,170,218,170,90,
+170,170,170,170,170,186,170,170,149,170,151,170,170,170,170,170,170,186,170,170,85,170,157,170,170,170,170,170,170,186,170,170,
+85,170,117,170,170,170,170,170,170,186,170,170,85,169,213,169,170,170,170,170,170,186,170,170,85,165,85,167,170,170,170,170,
+170,186,170,170,85,149,149,157,170,170,170,170,170,186,170,170,85,85,170,118,170,170,170,170,170,186,170,170,170,90,170,218,
+170,170,170,170,170,186,170,170,170,170,165,170,170,170,170,170,170,186,170,170,170,170,149,170,170,170,170,170,170,186,170,170,
+170,170,86,170,170,170,170,170,170,186,170,170,170,170,90,169,170,170,170,170,170,186,170,170,170,170,106,165,170,170,170,170,
+170,186,170,170,170,170,170,149,170,170,170,170,170,186,170,170,170,170,170,86,170,170,170,170,170,186,170,170,170,170,170,90,
+149,170,85,170,85,234,85,170,85,170,85,170,85,170,85,170,85,234,85,170,85,170,85,170,85,169,85,169,85,233,85,169,
+85,169,85,170,86,165,85,169,85,233,85,105,85,105,85,106,90,149,86,101,85,229,85,101,85,105,85,106,106,85,90,85,
+86,213,85,101,85,105,85,106,170,85,106,85,90,213,86,85,85,105,85,106,170,86,170,90,106,213,106,85,170,106,170,106,
+151,170,85,170,85,234,85,170,85,170,85,170,93,170,85,170,85,234,85,170,85,170,85,170,117,169,85,169,85,233,85,169,
+85,169,85,169,214,165,85,169,85,233,85,105,85,105,85,105,90,151,86,101,85,229,85,101,85,101,85,105,106,93,90,85,
+86,213,85,101,85,101,85,105,170,117,106,85,90,213,86,85,85,101,85,105,170,214,170,90,106,213,170,106,170,106,170,106,
+149,170,87,170,85,234,85,170,85,170,85,170,85,170,93,170,85,234,85,170,85,170,85,170,85,169,117,169,85,233,85,169,
+85,169,85,169,86,165,213,169,85,233,85,105,85,105,85,105,90,149,86,103,85,229,85,101,85,101,85,101,106,85,90,93,
+86,213,85,101,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,85,170,87,234,85,170,85,170,85,170,170,170,85,170,93,234,85,170,85,170,85,170,170,170,85,169,117,233,85,169,
+85,169,85,169,170,170,85,169,213,233,85,169,85,169,85,169,170,170,86,101,85,231,85,101,85,101,85,101,170,170,90,101,
+86,237,85,101,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,85,234,87,170,85,170,85,170,170,170,170,170,85,234,93,170,85,170,85,170,170,170,170,170,85,233,117,169,
+85,169,85,169,170,170,170,170,85,233,213,169,85,169,85,169,170,170,170,170,85,229,85,103,85,101,85,101,170,170,170,170,
+86,229,85,109,85,85,85,85,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,234,85,170,87,170,85,170,170,170,170,170,170,234,85,170,93,170,85,170,170,170,170,170,170,234,85,169,
+117,169,85,169,170,170,170,170,170,234,85,169,213,169,85,169,170,170,170,170,170,234,85,165,85,103,85,101,170,170,170,170,
+170,234,85,165,85,93,85,85,170,170,170,170,170,234,86,165,85,117,85,85,170,170,170,170,170,234,170,170,86,213,170,90,
+170,170,170,170,170,234,170,170,85,170,87,170,170,170,170,170,170,234,170,170,85,170,93,170,170,170,170,170,170,234,170,170,
+85,169,117,170,170,170,170,170,170,234,170,170,85,169,213,169,170,170,170,170,170,234,170,170,85,165,85,167,170,170,170,170,
+170,234,170,170,85,149,85,157,170,170,170,170,170,234,170,170,85,85,85,118,170,170,170,170,170,234,170,170,86,85,170,218,
+170,170,170,170,170,234,170,170,170,170,165,170,170,170,170,170,170,234,170,170,170,170,149,170,170,170,170,170,170,234,170,170,
+170,170,86,170,170,170,170,170,170,234,170,170,170,170,90,169,170,170,170,170,170,234,170,170,170,170,106,165,170,170,170,170,
+170,234,170,170,170,170,170,149,170,170,170,170,170,234,170,170,170,170,170,86,170,170,170,170,170,234,170,170,170,170,170,90,
+149,170,149,170,85,169,87,165,169,170,169,170,85,170,85,169,85,165,87,149,105,85,169,85,85,169,85,165,85,149,87,85,
+105,85,169,85,86,165,85,149,85,85,91,85,105,85,169,85,90,149,90,85,89,85,107,85,105,85,169,85,106,85,106,85,
+106,85,107,85,105,85,169,85,170,85,170,85,170,85,171,85,170,85,170,85,170,86,170,85,170,85,171,85,170,85,170,85,
+151,170,85,170,85,169,87,165,85,165,169,170,93,170,85,169,85,165,87,149,85,85,105,85,117,169,85,165,85,149,87,85,
+89,85,105,85,214,165,85,149,85,85,91,85,89,85,105,85,90,151,90,85,89,85,107,85,105,85,105,85,106,93,106,85,
+106,85,107,85,105,85,105,85,170,117,170,85,170,85,171,85,170,85,170,85,170,214,170,85,170,85,171,85,170,85,170,85,
+149,170,87,170,85,169,87,165,169,170,169,170,85,170,93,169,85,165,87,149,85,85,89,85,85,169,117,165,85,149,87,85,
+89,85,89,85,86,165,213,149,85,85,91,85,89,85,89,85,90,149,90,87,89,85,107,85,105,85,105,85,106,85,106,93,
+106,85,107,85,105,85,105,85,170,85,170,117,170,85,171,85,170,85,170,85,170,86,170,213,170,85,171,85,170,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,85,165,117,149,87,85,
+89,85,89,85,170,170,85,149,217,85,91,85,89,85,89,85,170,170,90,85,105,87,107,85,105,85,105,85,170,170,106,85,
+106,93,107,85,105,85,105,85,170,170,170,85,170,117,171,85,170,85,170,85,170,170,170,85,170,213,171,85,170,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,89,149,123,85,
+89,85,89,85,170,170,170,170,89,85,219,85,89,85,89,85,170,170,170,170,106,85,107,87,106,85,106,85,170,170,170,170,
+106,85,107,93,106,85,106,85,170,170,170,170,170,85,171,117,170,85,170,85,170,170,170,170,170,85,171,213,170,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,91,85,
+121,85,85,85,170,170,170,170,170,170,91,85,217,85,89,85,170,170,170,170,170,170,107,85,106,87,106,85,170,170,170,170,
+170,170,107,85,106,93,106,85,170,170,170,170,170,170,171,85,170,117,170,85,170,170,170,170,170,170,171,85,170,213,170,85,
+170,170,170,170,170,170,171,170,170,170,167,170,170,170,170,170,170,170,171,170,90,85,157,85,170,170,170,170,170,170,171,170,
+90,85,118,85,170,170,170,170,170,170,171,170,90,85,218,85,170,170,170,170,170,170,171,170,106,85,106,87,170,170,170,170,
+170,170,171,170,106,85,170,93,170,170,170,170,170,170,171,170,170,85,170,117,170,170,170,170,170,170,171,170,170,85,170,213,
+170,170,170,170,170,170,171,170,170,170,165,170,170,170,170,170,170,170,171,170,170,170,149,170,170,170,170,170,170,170,171,170,
+170,170,86,170,170,170,170,170,170,170,171,170,170,170,90,169,170,170,170,170,170,170,171,170,170,170,106,165,170,170,170,170,
+170,170,171,170,170,170,170,149,170,170,170,170,170,170,171,170,170,170,170,86,170,170,170,170,170,170,171,170,170,170,170,90,
+149,170,149,170,85,170,93,165,169,170,169,170,85,170,85,170,85,165,93,149,169,106,169,106,85,169,85,165,85,149,93,85,
+169,85,169,86,86,165,85,149,85,85,93,85,169,85,169,86,90,149,90,85,89,85,109,85,169,85,169,86,106,85,106,85,
+106,85,173,85,169,85,169,86,170,85,170,85,170,85,174,85,170,85,170,86,170,86,170,86,170,86,174,86,170,86,170,86,
+151,170,85,170,85,169,93,165,85,149,169,170,93,170,85,169,85,165,93,149,85,85,169,106,117,169,85,165,85,149,93,85,
+85,85,169,85,214,165,85,149,85,85,93,85,105,85,169,85,90,151,90,85,89,85,109,85,105,85,169,85,106,93,106,85,
+106,85,173,85,169,85,169,85,170,117,170,85,170,85,174,85,170,85,170,85,170,214,170,86,170,86,174,86,170,86,170,86,
+149,170,87,170,85,169,93,165,85,149,169,170,85,170,93,169,85,165,93,149,169,106,169,106,85,169,117,165,85,149,93,85,
+85,85,105,85,86,165,213,149,85,85,93,85,105,85,105,85,90,149,90,87,89,85,109,85,105,85,105,85,106,85,106,93,
+106,85,173,85,169,85,169,85,170,85,170,117,170,85,174,85,170,85,170,85,170,86,170,214,170,86,174,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,85,149,217,85,93,85,105,85,105,85,170,170,90,85,105,87,109,85,105,85,105,85,170,170,106,85,
+170,93,173,85,169,85,169,85,170,170,170,85,170,117,174,85,170,85,170,85,170,170,170,86,170,214,174,86,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,106,85,238,85,106,85,106,85,170,170,170,170,106,85,110,87,106,85,106,85,170,170,170,170,
+170,85,174,93,170,85,170,85,170,170,170,170,170,85,174,117,170,85,170,85,170,170,170,170,170,86,174,214,170,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,110,85,234,85,90,85,170,170,170,170,170,170,110,85,106,87,106,85,170,170,170,170,
+170,170,174,85,170,93,170,85,170,170,170,170,170,170,174,85,170,117,170,85,170,170,170,170,170,170,174,86,170,214,170,86,
+170,170,170,170,170,170,174,170,170,170,167,170,170,170,170,170,170,170,174,170,170,170,157,170,170,170,170,170,170,170,174,170,
+106,85,118,86,170,170,170,170,170,170,174,170,106,85,218,85,170,170,170,170,170,170,174,170,106,85,106,87,170,170,170,170,
+170,170,174,170,170,85,170,93,170,170,170,170,170,170,174,170,170,85,170,118,170,170,170,170,170,170,174,170,170,86,170,214,
+170,170,170,170,170,170,174,170,170,170,165,170,170,170,170,170,170,170,174,170,170,170,149,170,170,170,170,170,170,170,174,170,
+170,170,86,170,170,170,170,170,170,170,174,170,170,170,90,169,170,170,170,170,170,170,174,170,170,170,106,165,170,170,170,170,
+170,170,174,170,170,170,170,149,170,170,170,170,170,170,174,170,170,170,170,86,170,170,170,170,170,170,174,170,170,170,170,90,
+149,170,149,170,85,170,181,170,169,170,169,170,85,170,85,170,85,169,117,149,169,106,169,106,85,169,85,169,85,149,117,85,
+169,106,169,106,86,165,85,149,85,85,117,85,169,86,169,90,90,149,90,85,85,85,121,85,169,86,169,90,106,85,106,85,
+106,85,185,85,169,86,169,90,170,85,170,85,170,85,186,86,170,86,170,90,170,86,170,86,170,86,186,86,170,86,170,90,
+151,170,149,170,85,170,181,170,169,170,169,170,93,170,85,169,85,165,117,149,85,85,169,106,117,169,85,165,85,149,117,85,
+85,85,169,106,214,165,85,149,85,85,117,85,85,85,169,86,90,151,90,85,85,85,121,85,169,85,169,86,106,93,106,85,
+106,85,185,85,169,85,169,86,170,117,170,85,170,85,186,86,170,86,170,86,170,214,170,86,170,86,186,86,170,86,170,86,
+149,170,151,170,85,170,181,170,169,170,169,170,85,170,93,169,85,165,117,149,85,85,169,106,85,169,117,165,85,149,117,85,
+169,106,169,106,86,165,213,149,85,85,117,85,85,85,169,85,90,149,90,87,85,85,121,85,169,85,169,85,106,85,106,93,
+106,85,185,85,169,85,169,85,170,85,170,117,170,85,186,86,170,86,170,86,170,86,170,214,170,86,186,86,170,86,170,86,
+170,170,149,170,103,170,181,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,90,85,101,87,121,85,169,85,169,85,170,170,106,85,
+170,93,185,85,169,85,169,85,170,170,170,85,170,118,186,86,170,86,170,86,170,170,170,86,170,214,186,86,170,86,170,86,
+170,170,170,170,169,170,187,170,169,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,85,186,87,170,85,170,85,170,170,170,170,
+170,85,186,93,170,85,170,85,170,170,170,170,170,86,186,118,170,86,170,86,170,170,170,170,170,86,186,214,170,86,170,86,
+170,170,170,170,170,170,185,170,171,170,165,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,186,85,170,87,106,85,170,170,170,170,
+170,170,186,85,170,93,170,85,170,170,170,170,170,170,186,86,170,118,170,86,170,170,170,170,170,170,186,86,170,214,170,86,
+170,170,170,170,170,170,186,170,169,170,167,170,170,170,170,170,170,170,186,170,169,170,157,170,170,170,170,170,170,170,186,170,
+170,170,118,170,170,170,170,170,170,170,186,170,170,85,218,89,170,170,170,170,170,170,186,170,170,85,106,87,170,170,170,170,
+170,170,186,170,170,85,170,93,170,170,170,170,170,170,186,170,170,86,170,118,170,170,170,170,170,170,186,170,170,86,170,218,
+170,170,170,170,170,170,186,170,170,170,165,170,170,170,170,170,170,170,186,170,170,170,149,170,170,170,170,170,170,170,186,170,
+170,170,86,170,170,170,170,170,170,170,186,170,170,170,90,169,170,170,170,170,170,170,186,170,170,170,106,165,170,170,170,170,
+170,170,186,170,170,170,170,149,170,170,170,170,170,170,186,170,170,170,170,86,170,170,170,170,170,170,186,170,170,170,170,90,
+149,170,149,170,149,170,229,170,169,170,169,170,85,170,85,170,85,169,213,170,169,170,169,170,85,169,85,169,85,165,213,85,
+169,106,169,106,86,165,85,165,85,85,213,85,169,106,169,106,90,149,90,85,85,85,213,85,169,90,169,106,106,85,106,85,
+90,85,233,85,169,90,169,106,170,85,170,85,170,85,234,86,170,90,170,106,170,86,170,86,170,86,234,90,170,90,170,106,
+151,170,149,170,149,170,229,170,165,170,169,170,93,170,85,170,85,169,213,170,165,170,169,170,117,169,85,165,85,149,213,85,
+85,85,169,106,214,165,85,149,85,85,213,85,85,85,169,106,90,151,86,85,85,85,213,85,85,85,169,90,106,93,106,85,
+90,85,233,85,169,86,169,90,170,117,170,85,170,85,234,86,170,86,170,90,170,214,170,86,170,86,234,90,170,90,170,90,
+149,170,151,170,149,170,229,170,165,170,165,170,85,170,93,170,85,169,213,170,165,170,165,170,85,169,117,165,85,149,213,85,
+85,85,165,106,86,165,213,149,85,85,213,85,169,106,169,106,90,149,86,87,85,85,213,85,85,85,169,86,106,85,106,93,
+90,85,233,85,169,86,169,86,170,85,170,117,170,85,234,86,170,86,170,86,170,86,170,214,170,86,234,90,170,90,170,90,
+170,170,149,170,167,170,229,170,165,170,165,170,170,170,85,170,157,169,213,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,106,85,
+154,93,233,85,169,86,169,86,170,170,170,85,170,118,234,86,170,86,170,86,170,170,170,86,170,218,234,90,170,90,170,90,
+170,170,170,170,165,170,231,170,165,170,165,170,170,170,170,170,165,170,237,170,165,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,86,234,94,170,86,170,86,170,170,170,170,170,86,234,118,170,86,170,86,170,170,170,170,170,90,234,218,170,90,170,90,
+170,170,170,170,170,170,229,170,167,170,165,170,170,170,170,170,170,170,229,170,173,170,149,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,234,86,170,94,170,85,170,170,170,170,170,170,234,86,170,118,170,86,170,170,170,170,170,170,234,90,170,218,170,90,
+170,170,170,170,170,170,234,170,165,170,167,170,170,170,170,170,170,170,234,170,165,170,157,170,170,170,170,170,170,170,234,170,
+165,170,118,170,170,170,170,170,170,170,234,170,170,170,218,169,170,170,170,170,170,170,234,170,170,86,106,103,170,170,170,170,
+170,170,234,170,170,86,170,93,170,170,170,170,170,170,234,170,170,86,170,118,170,170,170,170,170,170,234,170,170,90,170,218,
+170,170,170,170,170,170,234,170,170,170,165,170,170,170,170,170,170,170,234,170,170,170,149,170,170,170,170,170,170,170,234,170,
+170,170,86,170,170,170,170,170,170,170,234,170,170,170,90,169,170,170,170,170,170,170,234,170,170,170,106,165,170,170,170,170,
+170,170,234,170,170,170,170,149,170,170,170,170,170,170,234,170,170,170,170,86,170,170,170,170,170,170,234,170,170,170,170,90,
+149,170,149,170,149,170,165,171,165,170,169,170,85,170,85,170,85,170,149,171,165,170,169,170,85,169,85,169,85,165,85,107,
+165,106,169,106,86,165,85,165,85,85,85,87,165,106,169,106,90,149,90,85,85,85,85,87,169,106,169,106,106,85,106,85,
+90,85,85,87,169,106,169,106,170,85,170,85,106,85,170,87,170,106,170,106,170,86,170,86,170,86,170,91,170,106,170,106,
+151,170,149,170,149,170,165,171,165,170,165,170,93,170,85,170,85,170,149,171,149,170,165,170,117,169,85,169,85,165,85,107,
+149,106,165,106,214,165,85,149,85,85,85,87,85,85,165,106,90,151,86,85,85,85,85,87,85,85,169,106,106,93,90,85,
+86,85,85,87,85,85,169,106,170,117,170,85,106,85,170,87,170,90,170,106,170,214,170,86,170,86,170,91,170,90,170,106,
+149,170,151,170,149,170,165,171,165,170,165,170,85,170,93,170,85,170,149,171,149,170,149,170,85,169,117,169,85,165,85,107,
+149,106,149,106,86,165,213,149,85,85,85,87,85,85,149,106,90,149,86,87,85,85,85,87,169,106,169,106,106,85,90,93,
+86,85,85,87,85,85,169,90,170,85,170,117,106,85,170,87,170,90,170,90,170,86,170,214,170,86,170,91,170,90,170,90,
+170,170,149,170,167,170,165,171,165,170,165,170,170,170,85,170,157,170,149,171,149,170,149,170,170,170,85,169,117,166,85,107,
+149,106,149,106,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,85,106,118,170,87,170,90,170,90,170,170,170,86,170,218,170,91,170,90,170,90,
+170,170,170,170,165,170,167,171,165,170,165,170,170,170,170,170,149,170,157,171,149,170,149,170,170,170,170,170,149,170,181,171,
+149,170,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,90,170,123,170,90,170,90,170,170,170,170,170,90,170,219,170,90,170,90,
+170,170,170,170,170,170,165,171,167,170,165,170,170,170,170,170,170,170,149,171,157,170,149,170,170,170,170,170,170,170,149,171,
+181,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,91,170,122,170,86,170,170,170,170,170,170,170,91,170,218,170,90,
+170,170,170,170,170,170,170,171,165,170,167,170,170,170,170,170,170,170,170,171,149,170,157,170,170,170,170,170,170,170,170,171,
+149,170,117,170,170,170,170,170,170,170,170,171,149,170,217,169,170,170,170,170,170,170,170,171,170,170,106,167,170,170,170,170,
+170,170,170,171,170,90,170,157,170,170,170,170,170,170,170,171,170,90,170,118,170,170,170,170,170,170,170,171,170,90,170,218,
+170,170,170,170,170,170,170,171,170,170,165,170,170,170,170,170,170,170,170,171,170,170,149,170,170,170,170,170,170,170,170,171,
+170,170,86,170,170,170,170,170,170,170,170,171,170,170,90,169,170,170,170,170,170,170,170,171,170,170,106,165,170,170,170,170,
+170,170,170,171,170,170,170,149,170,170,170,170,170,170,170,171,170,170,170,86,170,170,170,170,170,170,170,171,170,170,170,90,
+149,170,149,170,149,170,149,174,149,170,165,170,85,170,85,170,85,170,149,174,149,170,165,170,85,169,85,169,85,169,85,110,
+149,106,165,106,86,165,85,165,85,85,85,109,149,106,165,106,90,149,86,85,85,85,85,93,149,106,165,106,106,85,106,85,
+86,85,85,93,169,106,169,106,170,85,170,85,106,85,86,93,169,106,169,106,170,86,170,86,170,85,170,94,170,106,170,106,
+151,170,149,170,149,170,149,174,149,170,149,170,93,170,85,170,85,170,149,174,149,170,149,170,117,169,85,169,85,169,85,110,
+85,106,149,106,214,165,85,165,85,85,85,109,85,106,149,106,90,151,86,85,85,85,85,93,85,85,149,106,106,93,90,85,
+86,85,85,93,85,85,169,106,170,117,106,85,90,85,86,93,85,85,169,106,170,214,170,86,170,85,170,94,170,106,170,106,
+149,170,151,170,149,170,149,174,149,170,149,170,85,170,93,170,85,170,149,174,149,170,149,170,85,169,117,169,85,169,85,110,
+85,106,85,106,86,165,213,165,85,85,85,109,85,106,85,106,90,149,86,87,85,85,85,93,85,85,85,106,106,85,90,93,
+86,85,85,93,169,106,169,106,170,85,106,117,90,85,86,93,85,85,169,106,170,86,170,214,170,85,170,94,170,106,170,106,
+170,170,149,170,151,170,149,174,149,170,149,170,170,170,85,170,157,170,149,174,149,170,149,170,170,170,85,169,117,170,85,110,
+85,106,85,106,170,170,85,165,213,89,85,109,85,106,85,106,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,86,170,217,170,94,170,106,170,106,
+170,170,170,170,149,170,151,174,149,170,149,170,170,170,170,170,149,170,157,174,149,170,149,170,170,170,170,170,85,170,117,174,
+85,170,85,170,170,170,170,170,85,170,213,174,85,170,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,106,170,238,170,106,170,106,
+170,170,170,170,170,170,149,174,151,170,149,170,170,170,170,170,170,170,149,174,157,170,149,170,170,170,170,170,170,170,85,174,
+117,170,85,170,170,170,170,170,170,170,85,174,213,170,85,169,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,110,170,234,170,90,
+170,170,170,170,170,170,170,174,149,170,167,170,170,170,170,170,170,170,170,174,149,170,157,170,170,170,170,170,170,170,170,174,
+85,170,117,170,170,170,170,170,170,170,170,174,85,170,213,169,170,170,170,170,170,170,170,174,85,170,101,167,170,170,170,170,
+170,170,170,174,170,170,170,157,170,170,170,170,170,170,170,174,170,106,170,118,170,170,170,170,170,170,170,174,170,106,170,218,
+170,170,170,170,170,170,170,174,170,170,165,170,170,170,170,170,170,170,170,174,170,170,149,170,170,170,170,170,170,170,170,174,
+170,170,86,170,170,170,170,170,170,170,170,174,170,170,90,169,170,170,170,170,170,170,170,174,170,170,106,165,170,170,170,170,
+170,170,170,174,170,170,170,149,170,170,170,170,170,170,170,174,170,170,170,86,170,170,170,170,170,170,170,174,170,170,170,90,
+149,170,149,170,149,170,149,186,149,170,149,170,85,170,85,170,85,170,85,186,85,170,149,170,85,169,85,169,85,169,85,122,
+85,106,149,106,86,165,85,165,85,101,85,121,85,106,149,106,90,149,86,85,85,85,85,117,85,106,149,106,106,85,90,85,
+86,85,85,117,85,106,149,106,170,85,170,85,90,85,86,117,169,106,169,106,170,86,170,86,170,85,90,117,170,106,170,106,
+151,170,149,170,149,170,149,186,149,170,149,170,93,170,85,170,85,170,85,186,85,170,85,170,117,169,85,169,85,169,85,122,
+85,106,85,106,214,165,85,165,85,101,85,121,85,105,85,106,90,151,86,85,85,85,85,117,85,105,85,106,106,93,90,85,
+86,85,85,117,85,85,85,106,170,117,106,85,90,85,86,117,85,85,169,106,170,214,170,85,106,85,90,117,86,85,170,106,
+149,170,151,170,149,170,149,186,149,170,149,170,85,170,93,170,85,170,85,186,85,170,85,170,85,169,117,169,85,169,85,122,
+85,106,85,106,86,165,213,165,85,101,85,121,85,105,85,105,90,149,86,87,85,85,85,117,85,105,85,105,106,85,90,93,
+86,85,85,117,85,85,85,105,170,85,106,117,90,85,86,117,169,106,169,106,170,86,170,213,106,85,90,117,86,85,170,106,
+170,170,149,170,151,170,149,186,149,170,149,170,170,170,85,170,93,170,85,186,85,170,85,170,170,170,85,169,117,170,85,122,
+85,106,85,106,170,170,85,165,213,105,85,121,85,105,85,105,170,170,86,85,85,103,85,117,85,105,85,105,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,149,170,151,186,149,170,149,170,170,170,170,170,85,170,93,186,85,170,85,170,170,170,170,170,85,170,117,186,
+85,170,85,170,170,170,170,170,85,169,213,185,85,169,85,169,170,170,170,170,85,169,85,187,85,169,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,149,186,151,170,149,170,170,170,170,170,170,170,85,186,93,170,85,170,170,170,170,170,170,170,85,186,
+117,170,85,170,170,170,170,170,170,170,85,185,213,169,85,169,170,170,170,170,170,170,85,185,85,171,85,165,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,186,149,170,151,170,170,170,170,170,170,170,170,186,85,170,157,170,170,170,170,170,170,170,170,186,
+85,170,117,170,170,170,170,170,170,170,170,186,85,169,213,169,170,170,170,170,170,170,170,186,85,169,85,167,170,170,170,170,
+170,170,170,186,85,169,149,157,170,170,170,170,170,170,170,186,170,170,170,118,170,170,170,170,170,170,170,186,170,170,170,218,
+170,170,170,170,170,170,170,186,170,170,165,170,170,170,170,170,170,170,170,186,170,170,149,170,170,170,170,170,170,170,170,186,
+170,170,86,170,170,170,170,170,170,170,170,186,170,170,90,169,170,170,170,170,170,170,170,186,170,170,106,165,170,170,170,170,
+170,170,170,186,170,170,170,149,170,170,170,170,170,170,170,186,170,170,170,86,170,170,170,170,170,170,170,186,170,170,170,90,
+149,170,85,170,85,170,85,234,85,170,85,170,85,170,85,170,85,170,85,234,85,170,85,170,85,169,85,169,85,169,85,233,
+85,105,85,106,86,165,85,165,85,101,85,233,85,105,85,106,90,149,86,85,85,85,85,229,85,105,85,106,106,85,90,85,
+86,85,85,213,85,105,85,106,170,85,106,85,90,85,86,213,85,105,85,106,170,86,170,86,106,85,90,213,170,106,170,106,
+151,170,85,170,85,170,85,234,85,170,85,170,93,170,85,170,85,170,85,234,85,170,85,170,117,169,85,169,85,169,85,233,
+85,105,85,105,214,165,85,165,85,101,85,233,85,105,85,105,90,151,86,85,85,85,85,229,85,101,85,105,106,93,90,85,
+86,85,85,213,85,101,85,105,170,117,106,85,90,85,86,213,85,85,85,105,170,214,170,85,106,85,90,213,90,85,170,106,
+149,170,87,170,85,170,85,234,85,170,85,170,85,170,93,170,85,170,85,234,85,170,85,170,85,169,117,169,85,169,85,233,
+85,105,85,105,86,165,213,165,85,101,85,233,85,105,85,105,90,149,86,87,85,85,85,229,85,101,85,101,106,85,90,93,
+86,85,85,213,85,101,85,101,170,85,106,117,90,85,86,213,85,85,85,101,170,86,170,213,106,85,90,213,170,106,170,106,
+170,170,85,170,87,170,85,234,85,170,85,170,170,170,85,170,93,170,85,234,85,170,85,170,170,170,85,169,117,169,85,233,
+85,105,85,105,170,170,85,165,213,105,85,233,85,105,85,105,170,170,86,85,85,103,85,229,85,101,85,101,170,170,90,85,
+86,93,85,213,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,85,170,87,234,85,170,85,170,170,170,170,170,85,170,93,234,85,170,85,170,170,170,170,170,85,169,117,233,
+85,169,85,169,170,170,170,170,85,169,213,233,85,169,85,169,170,170,170,170,85,101,85,231,85,101,85,101,170,170,170,170,
+86,101,85,237,85,101,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,85,234,87,170,85,170,170,170,170,170,170,170,85,234,93,170,85,170,170,170,170,170,170,170,85,233,
+117,169,85,169,170,170,170,170,170,170,85,233,213,169,85,169,170,170,170,170,170,170,85,229,85,103,85,101,170,170,170,170,
+170,170,85,229,85,109,85,85,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,234,85,170,87,170,170,170,170,170,170,170,170,234,85,170,93,170,170,170,170,170,170,170,170,234,
+85,169,117,170,170,170,170,170,170,170,170,234,85,169,213,169,170,170,170,170,170,170,170,234,85,165,85,167,170,170,170,170,
+170,170,170,234,85,165,85,157,170,170,170,170,170,170,170,234,85,165,85,118,170,170,170,170,170,170,170,234,170,170,170,218,
+170,170,170,170,170,170,170,234,170,170,165,170,170,170,170,170,170,170,170,234,170,170,149,170,170,170,170,170,170,170,170,234,
+170,170,86,170,170,170,170,170,170,170,170,234,170,170,90,169,170,170,170,170,170,170,170,234,170,170,106,165,170,170,170,170,
+170,170,170,234,170,170,170,149,170,170,170,170,170,170,170,234,170,170,170,86,170,170,170,170,170,170,170,234,170,170,170,90,
+149,170,85,170,85,169,85,165,87,149,169,170,85,170,85,169,85,165,85,149,87,85,169,85,85,169,85,165,85,149,85,85,
+87,85,169,85,86,165,85,149,85,85,85,85,91,85,169,85,90,149,86,85,85,85,89,85,107,85,169,85,106,85,90,85,
+90,85,105,85,107,85,169,85,170,85,106,85,106,85,170,85,171,85,169,85,170,86,170,85,170,85,170,85,171,85,170,85,
+151,170,85,170,85,169,85,165,87,149,169,170,93,170,85,169,85,165,85,149,87,85,105,85,117,169,85,165,85,149,85,85,
+87,85,105,85,214,165,85,149,85,85,85,85,91,85,105,85,90,151,86,85,85,85,89,85,107,85,105,85,106,93,90,85,
+90,85,105,85,107,85,105,85,170,117,106,85,106,85,170,85,171,85,169,85,170,214,170,85,170,85,170,85,171,85,170,85,
+149,170,87,170,85,169,85,165,87,149,85,165,85,170,93,169,85,165,85,149,87,85,85,85,85,169,117,165,85,149,85,85,
+87,85,89,85,86,165,213,149,85,85,85,85,91,85,89,85,90,149,86,87,85,85,89,85,107,85,105,85,106,85,90,93,
+90,85,105,85,107,85,105,85,170,85,106,117,106,85,170,85,171,85,169,85,170,86,170,213,170,85,170,85,171,85,170,85,
+170,170,85,170,87,169,85,165,87,149,169,170,170,170,85,169,93,165,85,149,87,85,85,85,170,170,85,165,117,149,85,85,
+87,85,89,85,170,170,85,149,213,85,85,85,91,85,89,85,170,170,86,85,85,87,89,85,107,85,105,85,170,170,90,85,
+90,93,105,85,107,85,105,85,170,170,106,85,106,117,170,85,171,85,169,85,170,170,170,85,170,213,170,85,171,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,85,149,117,85,
+87,85,89,85,170,170,170,170,85,85,217,85,91,85,89,85,170,170,170,170,89,85,105,87,107,85,105,85,170,170,170,170,
+106,85,105,93,107,85,105,85,170,170,170,170,170,85,170,117,171,85,169,85,170,170,170,170,170,85,170,213,171,85,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,89,85,
+123,85,89,85,170,170,170,170,170,170,89,85,219,85,89,85,170,170,170,170,170,170,106,85,107,87,106,85,170,170,170,170,
+170,170,106,85,107,93,106,85,170,170,170,170,170,170,170,85,171,117,170,85,170,170,170,170,170,170,170,85,171,213,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,
+91,85,121,85,170,170,170,170,170,170,170,170,91,85,217,85,170,170,170,170,170,170,170,170,107,85,106,87,170,170,170,170,
+170,170,170,170,107,85,170,93,170,170,170,170,170,170,170,170,171,85,170,117,170,170,170,170,170,170,170,170,171,85,170,213,
+170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,171,170,154,170,170,170,170,170,170,170,170,170,
+171,170,90,170,170,170,170,170,170,170,170,170,171,170,90,169,170,170,170,170,170,170,170,170,171,170,106,165,170,170,170,170,
+170,170,170,170,171,170,170,149,170,170,170,170,170,170,170,170,171,170,170,86,170,170,170,170,170,170,170,170,171,170,170,90,
+149,170,85,170,85,169,85,165,93,149,169,170,85,170,85,169,85,165,85,149,93,85,169,106,85,169,85,165,85,149,85,85,
+93,85,169,86,86,165,85,149,85,85,85,85,93,85,169,86,90,149,86,85,85,85,89,85,109,85,169,86,106,85,90,85,
+90,85,105,85,173,85,169,86,170,85,106,85,106,85,170,85,173,85,169,86,170,86,170,85,170,85,170,86,174,86,170,86,
+151,170,85,170,85,169,85,165,93,149,169,170,93,170,85,169,85,165,85,149,93,85,169,106,117,169,85,165,85,149,85,85,
+93,85,169,85,214,165,85,149,85,85,85,85,93,85,169,85,90,151,86,85,85,85,89,85,109,85,169,85,106,93,90,85,
+90,85,105,85,173,85,169,85,170,117,106,85,106,85,170,85,173,85,169,85,170,214,170,85,170,85,170,86,174,86,170,86,
+149,170,87,170,85,169,85,165,93,149,85,149,85,170,93,169,85,165,85,149,93,85,85,85,85,169,117,165,85,149,85,85,
+93,85,85,85,86,165,213,149,85,85,85,85,93,85,105,85,90,149,86,87,85,85,89,85,109,85,105,85,106,85,90,93,
+90,85,105,85,173,85,169,85,170,85,106,117,106,85,170,85,173,85,169,85,170,86,170,213,170,85,170,86,174,86,170,86,
+170,170,85,170,87,169,85,165,93,149,85,149,170,170,85,169,93,165,85,149,93,85,169,106,170,170,85,165,117,149,85,85,
+93,85,85,85,170,170,85,149,213,85,85,85,93,85,105,85,170,170,86,85,85,87,89,85,109,85,105,85,170,170,90,85,
+90,93,105,85,173,85,169,85,170,170,106,85,106,117,170,85,173,85,169,85,170,170,170,85,170,213,170,86,174,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,85,85,217,85,93,85,105,85,170,170,170,170,89,85,105,87,109,85,105,85,170,170,170,170,
+106,85,169,93,173,85,169,85,170,170,170,170,170,85,170,117,173,85,169,85,170,170,170,170,170,86,170,214,174,86,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,106,85,238,85,106,85,170,170,170,170,170,170,106,85,110,87,106,85,170,170,170,170,
+170,170,170,85,174,93,170,85,170,170,170,170,170,170,170,85,174,117,170,85,170,170,170,170,170,170,170,86,174,214,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,170,170,110,85,234,85,170,170,170,170,170,170,170,170,110,85,106,87,170,170,170,170,
+170,170,170,170,174,85,170,93,170,170,170,170,170,170,170,170,174,85,170,118,170,170,170,170,170,170,170,170,174,86,170,214,
+170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,
+174,170,106,170,170,170,170,170,170,170,170,170,174,170,106,169,170,170,170,170,170,170,170,170,174,170,106,165,170,170,170,170,
+170,170,170,170,174,170,170,149,170,170,170,170,170,170,170,170,174,170,170,86,170,170,170,170,170,170,170,170,174,170,170,90,
+149,170,85,170,85,169,85,170,181,170,169,170,85,170,85,169,85,165,85,149,117,85,169,106,85,169,85,165,85,149,85,85,
+117,85,169,106,86,165,85,149,85,85,85,85,117,85,169,90,90,149,86,85,85,85,85,85,121,85,169,90,106,85,90,85,
+90,85,105,85,185,85,169,90,170,85,106,85,106,85,170,85,185,86,169,90,170,86,170,85,170,85,170,86,186,86,170,90,
+151,170,85,170,85,169,85,170,181,170,169,170,93,170,85,169,85,165,85,149,117,85,169,106,117,169,85,165,85,149,85,85,
+117,85,169,106,214,165,85,149,85,85,85,85,117,85,169,86,90,151,86,85,85,85,85,85,121,85,169,86,106,93,90,85,
+90,85,105,85,185,85,169,86,170,117,106,85,106,85,170,85,185,86,169,86,170,214,170,85,170,85,170,86,186,86,170,86,
+149,170,87,170,85,169,85,170,181,170,169,170,85,170,93,169,85,165,85,149,117,85,85,85,85,169,117,165,85,149,85,85,
+117,85,85,85,86,165,213,149,85,85,85,85,117,85,85,85,90,149,86,87,85,85,85,85,121,85,169,85,106,85,90,93,
+90,85,105,85,185,85,169,85,170,85,106,117,106,85,170,85,185,86,169,86,170,86,170,213,170,85,170,86,186,86,170,86,
+170,170,85,170,87,169,85,170,181,170,169,170,170,170,85,169,93,165,85,149,117,85,85,85,170,170,85,165,117,149,85,85,
+117,85,169,106,170,170,85,149,213,85,85,85,117,85,85,85,170,170,86,85,85,87,85,85,121,85,169,85,170,170,90,85,
+90,93,105,85,185,85,169,85,170,170,106,85,106,117,170,85,185,86,169,86,170,170,170,85,170,213,170,86,186,86,170,86,
+170,170,170,170,149,169,103,170,181,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,89,85,101,87,121,85,169,85,170,170,170,170,
+106,85,169,93,185,85,169,85,170,170,170,170,170,85,170,118,185,86,169,86,170,170,170,170,170,86,170,214,186,86,170,86,
+170,170,170,170,170,170,169,170,187,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,85,186,87,170,85,170,170,170,170,
+170,170,170,85,186,93,170,85,170,170,170,170,170,170,170,86,186,118,170,86,170,170,170,170,170,170,170,86,186,214,170,86,
+170,170,170,170,170,170,170,170,185,170,171,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,186,85,170,87,170,170,170,170,
+170,170,170,170,186,85,170,93,170,170,170,170,170,170,170,170,186,86,170,118,170,170,170,170,170,170,170,170,186,86,170,218,
+170,170,170,170,170,170,170,170,186,170,169,170,170,170,170,170,170,170,170,170,186,170,169,170,170,170,170,170,170,170,170,170,
+186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,169,170,170,170,170,170,170,170,170,186,170,170,165,170,170,170,170,
+170,170,170,170,186,170,170,149,170,170,170,170,170,170,170,170,186,170,170,86,170,170,170,170,170,170,170,170,186,170,170,90,
+149,170,85,170,85,170,149,170,229,170,169,170,85,170,85,169,85,165,85,169,213,106,169,106,85,169,85,165,85,149,85,85,
+213,85,169,106,86,165,85,149,85,85,85,85,213,85,169,106,90,149,86,85,85,85,85,85,213,85,169,106,106,85,90,85,
+86,85,89,85,233,85,169,106,170,85,106,85,106,85,170,85,233,86,169,106,170,86,170,85,170,85,170,86,234,90,170,106,
+151,170,85,170,85,170,149,170,229,170,169,170,93,170,85,169,85,165,85,169,213,106,169,106,117,169,85,165,85,149,85,85,
+213,85,169,106,214,165,85,149,85,85,85,85,213,85,169,106,90,151,86,85,85,85,85,85,213,85,169,90,106,93,90,85,
+86,85,89,85,233,85,169,90,170,117,106,85,106,85,170,85,233,86,169,90,170,214,170,85,170,85,170,86,234,90,170,90,
+149,170,87,170,85,170,149,170,229,170,165,170,85,170,93,169,85,165,85,169,213,106,165,106,85,169,117,165,85,149,85,85,
+213,85,85,85,86,165,213,149,85,85,85,85,213,85,85,85,90,149,86,87,85,85,85,85,213,85,85,85,106,85,90,93,
+86,85,89,85,233,85,169,86,170,85,106,117,106,85,170,85,233,86,169,86,170,86,170,213,170,85,170,86,234,90,170,90,
+170,170,85,170,87,170,149,170,229,170,165,170,170,170,85,169,93,165,85,169,213,106,165,106,170,170,85,165,117,149,85,85,
+213,85,85,85,170,170,85,149,213,85,85,85,213,85,169,106,170,170,86,85,85,87,85,85,213,85,85,85,170,170,90,85,
+86,93,89,85,233,85,169,86,170,170,106,85,106,117,170,85,233,86,169,86,170,170,170,85,170,213,170,86,234,90,170,90,
+170,170,170,170,149,170,167,170,229,170,165,170,170,170,170,170,85,166,157,169,213,106,165,106,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+102,85,153,93,233,85,169,86,170,170,170,170,170,85,170,118,233,86,169,86,170,170,170,170,170,86,170,218,234,90,170,90,
+170,170,170,170,170,170,165,170,231,170,165,170,170,170,170,170,170,170,165,170,237,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,86,234,94,170,86,170,170,170,170,170,170,170,86,234,118,170,86,170,170,170,170,170,170,170,90,234,218,170,90,
+170,170,170,170,170,170,170,170,229,170,167,170,170,170,170,170,170,170,170,170,229,170,173,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,170,234,86,170,94,170,170,170,170,170,170,170,170,234,86,170,118,170,170,170,170,170,170,170,170,234,90,170,218,
+170,170,170,170,170,170,170,170,234,170,165,170,170,170,170,170,170,170,170,170,234,170,165,170,170,170,170,170,170,170,170,170,
+234,170,166,170,170,170,170,170,170,170,170,170,234,170,170,170,170,170,170,170,170,170,170,170,234,170,170,166,170,170,170,170,
+170,170,170,170,234,170,170,150,170,170,170,170,170,170,170,170,234,170,170,86,170,170,170,170,170,170,170,170,234,170,170,90,
+149,170,85,170,85,170,149,170,165,171,169,170,85,170,85,169,85,169,85,170,149,107,169,106,85,169,85,165,85,149,85,101,
+85,107,169,106,86,165,85,149,85,85,85,85,85,87,169,106,90,149,86,85,85,85,85,85,85,87,169,106,106,85,90,85,
+86,85,85,85,85,87,169,106,170,85,106,85,90,85,106,85,169,87,169,106,170,86,170,85,170,85,170,86,170,91,170,106,
+151,170,85,170,85,170,149,170,165,171,165,170,93,170,85,169,85,169,85,170,149,107,165,106,117,169,85,165,85,149,85,101,
+85,107,165,106,214,165,85,149,85,85,85,85,85,87,165,106,90,151,86,85,85,85,85,85,85,87,169,106,106,93,90,85,
+86,85,85,85,85,87,169,106,170,117,106,85,90,85,106,85,169,87,169,106,170,214,170,85,170,85,170,86,170,91,170,106,
+149,170,87,170,85,170,149,170,165,171,165,170,85,170,93,169,85,169,85,170,149,107,149,106,85,169,117,165,85,149,85,101,
+85,107,149,106,86,165,213,149,85,85,85,85,85,87,85,85,90,149,86,87,85,85,85,85,85,87,85,85,106,85,90,93,
+86,85,85,85,85,87,85,85,170,85,106,117,90,85,106,85,169,87,169,90,170,86,170,213,170,85,170,86,170,91,170,90,
+170,170,85,170,87,170,149,170,165,171,165,170,170,170,85,169,93,169,85,170,149,107,149,106,170,170,85,165,117,149,85,101,
+85,107,149,106,170,170,85,149,213,85,85,85,85,87,85,85,170,170,86,85,85,87,85,85,85,87,169,106,170,170,90,85,
+86,93,85,85,85,87,85,85,170,170,106,85,90,117,106,85,169,87,169,90,170,170,170,85,170,213,170,86,170,91,170,90,
+170,170,170,170,149,170,167,170,165,171,165,170,170,170,170,170,85,170,157,170,149,107,149,106,170,170,170,170,85,153,117,102,
+85,107,149,106,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,154,85,106,118,169,87,169,90,170,170,170,170,170,86,170,218,170,91,170,90,
+170,170,170,170,170,170,165,170,167,171,165,170,170,170,170,170,170,170,149,170,157,171,149,170,170,170,170,170,170,170,149,170,
+181,171,149,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,90,170,123,170,90,170,170,170,170,170,170,170,90,170,219,170,90,
+170,170,170,170,170,170,170,170,165,171,167,170,170,170,170,170,170,170,170,170,149,171,157,170,170,170,170,170,170,170,170,170,
+149,171,181,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,91,170,122,170,170,170,170,170,170,170,170,170,91,170,218,
+170,170,170,170,170,170,170,170,170,171,165,170,170,170,170,170,170,170,170,170,170,171,149,170,170,170,170,170,170,170,170,170,
+170,171,150,170,170,170,170,170,170,170,170,170,170,171,154,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,
+170,170,170,170,170,171,170,154,170,170,170,170,170,170,170,170,170,171,170,90,170,170,170,170,170,170,170,170,170,171,170,90,
+149,170,85,170,85,170,149,170,149,174,165,170,85,170,85,169,85,169,85,170,149,110,165,106,85,169,85,165,85,165,85,105,
+85,110,165,106,86,165,85,149,85,85,85,85,85,109,165,106,90,149,86,85,85,85,85,85,85,93,165,106,106,85,90,85,
+86,85,85,85,85,93,169,106,170,85,106,85,90,85,86,85,85,93,169,106,170,86,170,85,106,85,170,85,170,94,170,106,
+151,170,85,170,85,170,149,170,149,174,149,170,93,170,85,169,85,169,85,170,149,110,149,106,117,169,85,165,85,165,85,105,
+85,110,149,106,214,165,85,149,85,85,85,85,85,109,149,106,90,151,86,85,85,85,85,85,85,93,149,106,106,93,90,85,
+86,85,85,85,85,93,169,106,170,117,106,85,90,85,86,85,85,93,169,106,170,214,170,85,106,85,170,85,170,94,170,106,
+149,170,87,170,85,170,149,170,149,174,149,170,85,170,93,169,85,169,85,170,149,110,149,106,85,169,117,165,85,165,85,105,
+85,110,85,106,86,165,213,149,85,85,85,85,85,109,85,106,90,149,86,87,85,85,85,85,85,93,85,85,106,85,90,93,
+86,85,85,85,85,93,85,85,170,85,106,117,90,85,86,85,85,93,85,85,170,86,170,213,106,85,170,85,170,94,170,106,
+170,170,85,170,87,170,149,170,149,174,149,170,170,170,85,169,93,169,85,170,149,110,149,106,170,170,85,165,117,165,85,105,
+85,110,85,106,170,170,85,149,213,85,85,85,85,109,85,106,170,170,86,85,85,87,85,85,85,93,85,85,170,170,90,85,
+86,93,85,85,85,93,169,106,170,170,106,85,90,117,86,85,85,93,85,85,170,170,170,85,106,213,170,85,170,94,170,106,
+170,170,170,170,149,170,151,170,149,174,149,170,170,170,170,170,85,170,157,170,149,110,149,106,170,170,170,170,85,169,117,106,
+85,110,85,106,170,170,170,170,85,101,213,89,85,109,85,106,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,106,86,170,217,170,94,170,106,
+170,170,170,170,170,170,149,170,151,174,149,170,170,170,170,170,170,170,149,170,157,174,149,170,170,170,170,170,170,170,85,170,
+117,174,85,170,170,170,170,170,170,170,85,170,213,174,85,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,106,170,238,170,106,
+170,170,170,170,170,170,170,170,149,174,167,170,170,170,170,170,170,170,170,170,149,174,157,170,170,170,170,170,170,170,170,170,
+85,174,117,170,170,170,170,170,170,170,170,170,85,174,213,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,110,170,234,
+170,170,170,170,170,170,170,170,170,174,165,170,170,170,170,170,170,170,170,170,170,174,149,170,170,170,170,170,170,170,170,170,
+170,174,86,170,170,170,170,170,170,170,170,170,170,174,90,170,170,170,170,170,170,170,170,170,170,174,106,170,170,170,170,170,
+170,170,170,170,170,174,170,170,170,170,170,170,170,170,170,170,170,174,170,106,170,170,170,170,170,170,170,170,170,174,170,106,
+149,170,85,170,85,170,149,170,149,186,149,170,85,170,85,169,85,169,85,170,85,122,149,106,85,169,85,165,85,165,85,105,
+85,122,149,106,86,165,85,149,85,85,85,101,85,121,149,106,90,149,86,85,85,85,85,85,85,117,149,106,106,85,90,85,
+86,85,85,85,85,117,149,106,170,85,106,85,90,85,86,85,85,117,169,106,170,86,170,85,106,85,90,85,86,117,170,106,
+151,170,85,170,85,170,149,170,149,186,149,170,93,170,85,169,85,169,85,170,85,122,85,106,117,169,85,165,85,165,85,105,
+85,122,85,106,214,165,85,149,85,85,85,101,85,121,85,106,90,151,86,85,85,85,85,85,85,117,85,106,106,93,90,85,
+86,85,85,85,85,117,85,106,170,117,106,85,90,85,86,85,85,117,169,106,170,214,170,85,106,85,90,85,86,117,170,106,
+149,170,87,170,85,170,149,170,149,186,149,170,85,170,93,169,85,169,85,170,85,122,85,106,85,169,117,165,85,165,85,105,
+85,122,85,106,86,165,213,149,85,85,85,101,85,121,85,105,90,149,86,87,85,85,85,85,85,117,85,105,106,85,90,93,
+86,85,85,85,85,117,85,85,170,85,106,117,90,85,86,85,85,117,85,85,170,86,170,213,106,85,90,85,86,117,86,85,
+170,170,85,170,87,170,149,170,149,186,149,170,170,170,85,169,93,169,85,170,85,122,85,106,170,170,85,165,117,165,85,105,
+85,122,85,106,170,170,85,149,213,85,85,101,85,121,85,105,170,170,86,85,85,87,85,85,85,117,85,105,170,170,90,85,
+86,93,85,85,85,117,85,85,170,170,106,85,90,117,86,85,85,117,169,106,170,170,170,85,106,213,90,85,86,117,86,85,
+170,170,170,170,149,170,151,170,149,186,149,170,170,170,170,170,85,170,93,170,85,122,85,106,170,170,170,170,85,169,117,106,
+85,122,85,106,170,170,170,170,85,101,213,105,85,121,85,105,170,170,170,170,85,85,85,103,85,117,85,105,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,149,170,151,186,149,170,170,170,170,170,170,170,85,170,93,186,85,170,170,170,170,170,170,170,85,170,
+117,186,85,170,170,170,170,170,170,170,85,169,213,185,85,169,170,170,170,170,170,170,85,169,85,187,85,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,149,186,151,170,170,170,170,170,170,170,170,170,85,186,157,170,170,170,170,170,170,170,170,170,
+85,186,117,170,170,170,170,170,170,170,170,170,85,185,213,169,170,170,170,170,170,170,170,170,85,185,85,171,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,186,165,170,170,170,170,170,170,170,170,170,170,186,149,170,170,170,170,170,170,170,170,170,
+170,186,86,170,170,170,170,170,170,170,170,170,170,186,90,169,170,170,170,170,170,170,170,170,170,186,106,169,170,170,170,170,
+170,170,170,170,170,186,170,169,170,170,170,170,170,170,170,170,170,186,170,170,170,170,170,170,170,170,170,170,170,186,170,170,
+149,170,85,170,85,170,85,170,85,234,85,170,85,170,85,169,85,169,85,170,85,234,85,106,85,169,85,165,85,165,85,105,
+85,233,85,106,86,165,85,149,85,85,85,101,85,233,85,106,90,149,86,85,85,85,85,85,85,229,85,106,106,85,90,85,
+86,85,85,85,85,213,85,106,170,85,106,85,90,85,86,85,85,213,85,106,170,86,170,85,106,85,90,85,86,213,170,106,
+151,170,85,170,85,170,85,170,85,234,85,170,93,170,85,169,85,169,85,170,85,234,85,106,117,169,85,165,85,165,85,105,
+85,233,85,105,214,165,85,149,85,85,85,101,85,233,85,105,90,151,86,85,85,85,85,85,85,229,85,105,106,93,90,85,
+86,85,85,85,85,213,85,105,170,117,106,85,90,85,86,85,85,213,85,105,170,214,170,85,106,85,90,85,86,213,170,106,
+149,170,87,170,85,170,85,170,85,234,85,170,85,170,93,169,85,169,85,170,85,234,85,106,85,169,117,165,85,165,85,105,
+85,233,85,105,86,165,213,149,85,85,85,101,85,233,85,105,90,149,86,87,85,85,85,85,85,229,85,101,106,85,90,93,
+86,85,85,85,85,213,85,101,170,85,106,117,90,85,86,85,85,213,85,85,170,86,170,213,106,85,90,85,86,213,90,85,
+170,170,85,170,87,170,85,170,85,234,85,170,170,170,85,169,93,169,85,170,85,234,85,106,170,170,85,165,117,165,85,105,
+85,233,85,105,170,170,85,149,213,85,85,101,85,233,85,105,170,170,86,85,85,87,85,85,85,229,85,101,170,170,90,85,
+86,93,85,85,85,213,85,101,170,170,106,85,90,117,86,85,85,213,85,85,170,170,170,85,106,213,90,85,86,213,170,106,
+170,170,170,170,85,170,87,170,85,234,85,170,170,170,170,170,85,170,93,170,85,234,85,106,170,170,170,170,85,169,117,105,
+85,233,85,105,170,170,170,170,85,101,213,105,85,233,85,105,170,170,170,170,85,85,85,103,85,229,85,101,170,170,170,170,
+86,85,85,93,85,213,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,85,170,87,234,85,170,170,170,170,170,170,170,85,170,93,234,85,170,170,170,170,170,170,170,85,169,
+117,233,85,169,170,170,170,170,170,170,85,169,213,233,85,169,170,170,170,170,170,170,85,101,85,231,85,101,170,170,170,170,
+170,170,85,101,85,237,85,101,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,85,234,87,170,170,170,170,170,170,170,170,170,85,234,93,170,170,170,170,170,170,170,170,170,
+85,233,117,170,170,170,170,170,170,170,170,170,85,233,213,169,170,170,170,170,170,170,170,170,85,229,85,103,170,170,170,170,
+170,170,170,170,85,229,85,109,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,234,165,170,170,170,170,170,170,170,170,170,170,234,149,170,170,170,170,170,170,170,170,170,
+170,234,86,170,170,170,170,170,170,170,170,170,170,234,90,169,170,170,170,170,170,170,170,170,170,234,106,165,170,170,170,170,
+170,170,170,170,170,234,170,165,170,170,170,170,170,170,170,170,170,234,170,166,170,170,170,170,170,170,170,170,170,234,170,170,
+149,170,85,170,85,169,85,165,85,149,171,170,85,170,85,169,85,165,85,149,85,85,171,85,85,169,85,165,85,149,85,85,
+85,85,171,85,86,165,85,149,85,85,85,85,85,85,171,85,90,149,86,85,85,85,85,85,89,85,171,85,106,85,90,85,
+86,85,89,85,105,85,171,85,170,85,106,85,90,85,106,85,169,85,171,85,170,86,170,85,106,85,170,85,170,85,171,85,
+151,170,85,170,85,169,85,165,85,149,87,149,93,170,85,169,85,165,85,149,85,85,87,85,117,169,85,165,85,149,85,85,
+85,85,87,85,214,165,85,149,85,85,85,85,85,85,91,85,90,151,86,85,85,85,85,85,89,85,107,85,106,93,90,85,
+86,85,89,85,105,85,107,85,170,117,106,85,90,85,106,85,169,85,171,85,170,214,170,85,106,85,170,85,170,85,171,85,
+149,170,87,170,85,169,85,165,85,149,87,149,85,170,93,169,85,165,85,149,85,85,87,85,85,169,117,165,85,149,85,85,
+85,85,87,85,86,165,213,149,85,85,85,85,85,85,91,85,90,149,86,87,85,85,85,85,89,85,107,85,106,85,90,93,
+86,85,89,85,105,85,107,85,170,85,106,117,90,85,106,85,169,85,171,85,170,86,170,213,106,85,170,85,170,85,171,85,
+170,170,85,170,87,169,85,165,85,149,87,149,170,170,85,169,93,165,85,149,85,85,87,85,170,170,85,165,117,149,85,85,
+85,85,87,85,170,170,85,149,213,85,85,85,85,85,91,85,170,170,86,85,85,87,85,85,89,85,107,85,170,170,90,85,
+86,93,89,85,105,85,107,85,170,170,106,85,90,117,106,85,169,85,171,85,170,170,170,85,106,213,170,85,170,85,171,85,
+170,170,170,170,85,169,87,165,85,149,87,149,170,170,170,170,85,165,93,149,85,85,87,85,170,170,170,170,85,149,117,85,
+85,85,87,85,170,170,170,170,85,85,213,85,85,85,91,85,170,170,170,170,85,85,85,87,89,85,107,85,170,170,170,170,
+86,85,89,93,105,85,107,85,170,170,170,170,90,85,106,117,169,85,171,85,170,170,170,170,106,85,170,213,170,85,171,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,85,85,
+117,85,87,85,170,170,170,170,170,170,85,85,217,85,91,85,170,170,170,170,170,170,89,85,105,87,107,85,170,170,170,170,
+170,170,105,85,105,93,107,85,170,170,170,170,170,170,170,85,169,117,171,85,170,170,170,170,170,170,170,85,170,213,171,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,
+89,85,123,85,170,170,170,170,170,170,170,170,89,85,219,85,170,170,170,170,170,170,170,170,106,85,107,87,170,170,170,170,
+170,170,170,170,106,85,171,93,170,170,170,170,170,170,170,170,170,85,171,117,170,170,170,170,170,170,170,170,170,85,171,213,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,
+170,170,91,170,170,170,170,170,170,170,170,170,170,170,91,169,170,170,170,170,170,170,170,170,170,170,107,165,170,170,170,170,
+170,170,170,170,170,170,171,149,170,170,170,170,170,170,170,170,170,170,171,86,170,170,170,170,170,170,170,170,170,170,171,90,
+149,170,85,170,85,169,85,165,85,149,173,170,85,170,85,169,85,165,85,149,85,85,173,106,85,169,85,165,85,149,85,85,
+85,85,173,86,86,165,85,149,85,85,85,85,85,85,173,86,90,149,86,85,85,85,85,85,89,85,173,86,106,85,90,85,
+86,85,89,85,105,85,173,86,170,85,106,85,90,85,106,85,169,85,173,86,170,86,170,85,106,85,170,85,170,86,174,86,
+151,170,85,170,85,169,85,165,85,149,93,149,93,170,85,169,85,165,85,149,85,85,93,85,117,169,85,165,85,149,85,85,
+85,85,93,85,214,165,85,149,85,85,85,85,85,85,93,85,90,151,86,85,85,85,85,85,89,85,109,85,106,93,90,85,
+86,85,89,85,105,85,173,85,170,117,106,85,90,85,106,85,169,85,173,85,170,214,170,85,106,85,170,85,170,86,174,86,
+149,170,87,170,85,169,85,165,85,149,93,149,85,170,93,169,85,165,85,149,85,85,93,85,85,169,117,165,85,149,85,85,
+85,85,93,85,86,165,213,149,85,85,85,85,85,85,93,85,90,149,86,87,85,85,85,85,89,85,109,85,106,85,90,93,
+86,85,89,85,105,85,173,85,170,85,106,117,90,85,106,85,169,85,173,85,170,86,170,213,106,85,170,85,170,86,174,86,
+170,170,85,170,87,169,85,165,85,149,93,149,170,170,85,169,93,165,85,149,85,85,93,85,170,170,85,165,117,149,85,85,
+85,85,93,85,170,170,85,149,213,85,85,85,85,85,93,85,170,170,86,85,85,87,85,85,89,85,109,85,170,170,90,85,
+86,93,89,85,105,85,173,85,170,170,106,85,90,117,106,85,169,85,173,85,170,170,170,85,106,213,170,85,170,86,174,86,
+170,170,170,170,85,169,87,165,85,149,93,149,170,170,170,170,85,165,93,149,85,85,93,85,170,170,170,170,85,149,117,85,
+85,85,93,85,170,170,170,170,85,85,213,85,85,85,93,85,170,170,170,170,85,85,85,87,89,85,109,85,170,170,170,170,
+86,85,89,93,105,85,173,85,170,170,170,170,90,85,106,117,169,85,173,85,170,170,170,170,106,85,170,213,170,86,174,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,85,85,217,85,93,85,170,170,170,170,170,170,89,85,105,87,109,85,170,170,170,170,
+170,170,105,85,169,93,173,85,170,170,170,170,170,170,170,85,169,117,173,85,170,170,170,170,170,170,170,86,170,214,174,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,170,170,106,85,238,85,170,170,170,170,170,170,170,170,106,85,110,87,170,170,170,170,
+170,170,170,170,170,85,174,93,170,170,170,170,170,170,170,170,170,85,174,118,170,170,170,170,170,170,170,170,170,86,174,214,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,170,170,170,170,110,169,170,170,170,170,170,170,170,170,170,170,110,165,170,170,170,170,
+170,170,170,170,170,170,174,149,170,170,170,170,170,170,170,170,170,170,174,86,170,170,170,170,170,170,170,170,170,170,174,90,
+149,170,85,170,85,169,85,169,85,170,185,170,85,170,85,169,85,165,85,149,85,85,185,106,85,169,85,165,85,149,85,85,
+85,85,185,106,86,165,85,149,85,85,85,85,85,85,185,90,90,149,86,85,85,85,85,85,85,85,185,90,106,85,90,85,
+86,85,89,85,105,85,185,90,170,85,106,85,90,85,106,85,169,85,185,90,170,86,170,85,106,85,170,85,170,86,186,90,
+151,170,85,170,85,169,85,169,85,170,181,170,93,170,85,169,85,165,85,149,85,85,117,85,117,169,85,165,85,149,85,85,
+85,85,117,85,214,165,85,149,85,85,85,85,85,85,117,85,90,151,86,85,85,85,85,85,85,85,121,85,106,93,90,85,
+86,85,89,85,105,85,185,85,170,117,106,85,90,85,106,85,169,85,185,86,170,214,170,85,106,85,170,85,170,86,186,86,
+149,170,87,170,85,169,85,169,85,170,181,170,85,170,93,169,85,165,85,149,85,85,117,85,85,169,117,165,85,149,85,85,
+85,85,117,85,86,165,213,149,85,85,85,85,85,85,117,85,90,149,86,87,85,85,85,85,85,85,121,85,106,85,90,93,
+86,85,89,85,105,85,185,85,170,85,106,117,90,85,106,85,169,85,185,86,170,86,170,213,106,85,170,85,170,86,186,86,
+170,170,85,170,87,169,85,169,85,170,181,170,170,170,85,169,93,165,85,149,85,85,117,85,170,170,85,165,117,149,85,85,
+85,85,117,85,170,170,85,149,213,85,85,85,85,85,117,85,170,170,86,85,85,87,85,85,85,85,121,85,170,170,90,85,
+86,93,89,85,105,85,185,85,170,170,106,85,90,117,106,85,169,85,185,86,170,170,170,85,106,213,170,85,170,86,186,86,
+170,170,170,170,85,169,87,169,85,170,181,170,170,170,170,170,85,165,93,149,85,85,117,85,170,170,170,170,85,149,117,85,
+85,85,117,85,170,170,170,170,85,85,213,85,85,85,117,85,170,170,170,170,85,85,85,87,85,85,121,85,170,170,170,170,
+86,85,89,93,105,85,185,85,170,170,170,170,90,85,106,117,169,85,185,86,170,170,170,170,106,85,170,213,170,86,186,86,
+170,170,170,170,170,170,149,169,103,170,181,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,89,85,101,87,121,85,170,170,170,170,
+170,170,105,85,169,93,185,85,170,170,170,170,170,170,170,85,169,118,185,86,170,170,170,170,170,170,170,86,170,214,186,86,
+170,170,170,170,170,170,170,170,169,170,187,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,85,186,87,170,170,170,170,
+170,170,170,170,170,85,186,93,170,170,170,170,170,170,170,170,170,86,186,118,170,170,170,170,170,170,170,170,170,86,186,218,
+170,170,170,170,170,170,170,170,170,170,185,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,186,165,170,170,170,170,
+170,170,170,170,170,170,186,149,170,170,170,170,170,170,170,170,170,170,186,86,170,170,170,170,170,170,170,170,170,170,186,90,
+149,170,85,170,85,169,85,170,149,170,233,170,85,170,85,169,85,165,85,165,85,105,233,106,85,169,85,165,85,149,85,85,
+85,85,233,106,86,165,85,149,85,85,85,85,85,85,233,106,90,149,86,85,85,85,85,85,85,85,233,106,106,85,90,85,
+86,85,85,85,89,85,233,106,170,85,106,85,90,85,106,85,169,85,233,106,170,86,170,85,106,85,170,85,170,86,234,106,
+151,170,85,170,85,169,85,170,149,170,229,170,93,170,85,169,85,165,85,165,85,105,213,106,117,169,85,165,85,149,85,85,
+85,85,213,85,214,165,85,149,85,85,85,85,85,85,213,85,90,151,86,85,85,85,85,85,85,85,213,85,106,93,90,85,
+86,85,85,85,89,85,233,85,170,117,106,85,90,85,106,85,169,85,233,86,170,214,170,85,106,85,170,85,170,86,234,90,
+149,170,87,170,85,169,85,170,149,170,229,170,85,170,93,169,85,165,85,165,85,105,213,106,85,169,117,165,85,149,85,85,
+85,85,213,85,86,165,213,149,85,85,85,85,85,85,213,85,90,149,86,87,85,85,85,85,85,85,213,85,106,85,90,93,
+86,85,85,85,89,85,233,85,170,85,106,117,90,85,106,85,169,85,233,86,170,86,170,213,106,85,170,85,170,86,234,90,
+170,170,85,170,87,169,85,170,149,170,229,170,170,170,85,169,93,165,85,165,85,105,213,106,170,170,85,165,117,149,85,85,
+85,85,213,85,170,170,85,149,213,85,85,85,85,85,213,85,170,170,86,85,85,87,85,85,85,85,213,85,170,170,90,85,
+86,93,85,85,89,85,233,85,170,170,106,85,90,117,106,85,169,85,233,86,170,170,170,85,106,213,170,85,170,86,234,90,
+170,170,170,170,85,169,87,170,149,170,229,170,170,170,170,170,85,165,93,165,85,105,213,106,170,170,170,170,85,149,117,85,
+85,85,213,85,170,170,170,170,85,85,213,85,85,85,213,85,170,170,170,170,85,85,85,87,85,85,213,85,170,170,170,170,
+86,85,85,93,89,85,233,85,170,170,170,170,90,85,106,117,169,85,233,86,170,170,170,170,106,85,170,213,170,86,234,90,
+170,170,170,170,170,170,149,170,167,170,229,170,170,170,170,170,170,170,85,166,157,105,213,106,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,101,85,153,93,233,85,170,170,170,170,170,170,170,85,169,118,233,86,170,170,170,170,170,170,170,86,170,218,234,90,
+170,170,170,170,170,170,170,170,165,170,231,170,170,170,170,170,170,170,170,170,165,170,237,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,170,170,86,234,94,170,170,170,170,170,170,170,170,170,86,234,118,170,170,170,170,170,170,170,170,170,90,234,218,
+170,170,170,170,170,170,170,170,170,170,229,170,170,170,170,170,170,170,170,170,170,170,229,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,170,170,170,234,150,170,170,170,170,170,170,170,170,170,170,234,86,170,170,170,170,170,170,170,170,170,170,234,90,
+149,170,85,170,85,169,85,170,149,170,169,171,85,170,85,169,85,165,85,169,85,106,169,107,85,169,85,165,85,149,85,85,
+85,101,169,107,86,165,85,149,85,85,85,85,85,85,169,107,90,149,86,85,85,85,85,85,85,85,169,107,106,85,90,85,
+86,85,85,85,85,85,169,107,170,85,106,85,90,85,90,85,105,85,169,107,170,86,170,85,106,85,170,85,170,86,170,107,
+151,170,85,170,85,169,85,170,149,170,165,171,93,170,85,169,85,165,85,169,85,106,149,107,117,169,85,165,85,149,85,85,
+85,101,85,107,214,165,85,149,85,85,85,85,85,85,85,87,90,151,86,85,85,85,85,85,85,85,85,87,106,93,90,85,
+86,85,85,85,85,85,85,87,170,117,106,85,90,85,90,85,105,85,169,87,170,214,170,85,106,85,170,85,170,86,170,91,
+149,170,87,170,85,169,85,170,149,170,165,171,85,170,93,169,85,165,85,169,85,106,149,107,85,169,117,165,85,149,85,85,
+85,101,85,107,86,165,213,149,85,85,85,85,85,85,85,87,90,149,86,87,85,85,85,85,85,85,85,87,106,85,90,93,
+86,85,85,85,85,85,85,87,170,85,106,117,90,85,90,85,105,85,169,87,170,86,170,213,106,85,170,85,170,86,170,91,
+170,170,85,170,87,169,85,170,149,170,165,171,170,170,85,169,93,165,85,169,85,106,149,107,170,170,85,165,117,149,85,85,
+85,101,85,107,170,170,85,149,213,85,85,85,85,85,85,87,170,170,86,85,85,87,85,85,85,85,85,87,170,170,90,85,
+86,93,85,85,85,85,85,87,170,170,106,85,90,117,90,85,105,85,169,87,170,170,170,85,106,213,170,85,170,86,170,91,
+170,170,170,170,85,169,87,170,149,170,165,171,170,170,170,170,85,165,93,169,85,106,149,107,170,170,170,170,85,149,117,85,
+85,101,85,107,170,170,170,170,85,85,213,85,85,85,85,87,170,170,170,170,85,85,85,87,85,85,85,87,170,170,170,170,
+86,85,85,93,85,85,85,87,170,170,170,170,90,85,90,117,105,85,169,87,170,170,170,170,106,85,170,213,170,86,170,91,
+170,170,170,170,170,170,149,170,167,170,165,171,170,170,170,170,170,170,85,170,157,106,149,107,170,170,170,170,170,170,85,89,
+117,102,85,107,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,154,85,105,118,169,87,170,170,170,170,170,170,170,86,170,218,170,91,
+170,170,170,170,170,170,170,170,165,170,167,171,170,170,170,170,170,170,170,170,149,170,157,171,170,170,170,170,170,170,170,170,
+149,170,181,171,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,90,170,123,170,170,170,170,170,170,170,170,170,90,170,219,
+170,170,170,170,170,170,170,170,170,170,165,171,170,170,170,170,170,170,170,170,170,170,149,171,170,170,170,170,170,170,170,170,
+170,170,150,171,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,91,170,170,170,170,170,170,170,170,170,170,170,91,
+149,170,85,170,85,169,85,170,149,170,165,174,85,170,85,169,85,165,85,169,85,106,165,110,85,169,85,165,85,149,85,101,
+85,105,165,110,86,165,85,149,85,85,85,85,85,85,165,110,90,149,86,85,85,85,85,85,85,85,165,110,106,85,90,85,
+86,85,85,85,85,85,169,110,170,85,106,85,90,85,86,85,85,85,169,110,170,86,170,85,106,85,106,85,170,85,170,110,
+151,170,85,170,85,169,85,170,149,170,149,174,93,170,85,169,85,165,85,169,85,106,149,110,117,169,85,165,85,149,85,101,
+85,105,85,110,214,165,85,149,85,85,85,85,85,85,85,109,90,151,86,85,85,85,85,85,85,85,85,93,106,93,90,85,
+86,85,85,85,85,85,85,93,170,117,106,85,90,85,86,85,85,85,85,93,170,214,170,85,106,85,106,85,170,85,170,94,
+149,170,87,170,85,169,85,170,149,170,149,174,85,170,93,169,85,165,85,169,85,106,149,110,85,169,117,165,85,149,85,101,
+85,105,85,110,86,165,213,149,85,85,85,85,85,85,85,109,90,149,86,87,85,85,85,85,85,85,85,93,106,85,90,93,
+86,85,85,85,85,85,85,93,170,85,106,117,90,85,86,85,85,85,85,93,170,86,170,213,106,85,106,85,170,85,170,94,
+170,170,85,170,87,169,85,170,149,170,149,174,170,170,85,169,93,165,85,169,85,106,149,110,170,170,85,165,117,149,85,101,
+85,105,85,110,170,170,85,149,213,85,85,85,85,85,85,109,170,170,86,85,85,87,85,85,85,85,85,93,170,170,90,85,
+86,93,85,85,85,85,85,93,170,170,106,85,90,117,86,85,85,85,85,93,170,170,170,85,106,213,106,85,170,85,170,94,
+170,170,170,170,85,169,87,170,149,170,149,174,170,170,170,170,85,165,93,169,85,106,149,110,170,170,170,170,85,149,117,101,
+85,105,85,110,170,170,170,170,85,85,213,85,85,85,85,109,170,170,170,170,85,85,85,87,85,85,85,93,170,170,170,170,
+86,85,85,93,85,85,85,93,170,170,170,170,90,85,86,117,85,85,85,93,170,170,170,170,106,85,106,213,170,85,170,94,
+170,170,170,170,170,170,149,170,151,170,149,174,170,170,170,170,170,170,85,170,157,106,149,110,170,170,170,170,170,170,85,105,
+117,106,85,110,170,170,170,170,170,170,85,101,213,89,85,109,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,106,86,170,217,170,94,
+170,170,170,170,170,170,170,170,149,170,167,174,170,170,170,170,170,170,170,170,149,170,157,174,170,170,170,170,170,170,170,170,
+85,170,117,174,170,170,170,170,170,170,170,170,85,170,213,174,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,106,170,238,
+170,170,170,170,170,170,170,170,170,170,165,174,170,170,170,170,170,170,170,170,170,170,149,174,170,170,170,170,170,170,170,170,
+170,170,86,174,170,170,170,170,170,170,170,170,170,170,90,174,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,110,
+149,170,85,170,85,169,85,170,149,170,149,186,85,170,85,169,85,165,85,169,85,106,149,122,85,169,85,165,85,149,85,101,
+85,105,149,122,86,165,85,149,85,85,85,85,85,101,149,122,90,149,86,85,85,85,85,85,85,85,149,122,106,85,90,85,
+86,85,85,85,85,85,149,122,170,85,106,85,90,85,86,85,85,85,169,122,170,86,170,85,106,85,90,85,86,85,170,122,
+151,170,85,170,85,169,85,170,149,170,149,186,93,170,85,169,85,165,85,169,85,106,85,122,117,169,85,165,85,149,85,101,
+85,105,85,122,214,165,85,149,85,85,85,85,85,101,85,121,90,151,86,85,85,85,85,85,85,85,85,117,106,93,90,85,
+86,85,85,85,85,85,85,117,170,117,106,85,90,85,86,85,85,85,85,117,170,214,170,85,106,85,90,85,86,85,86,117,
+149,170,87,170,85,169,85,170,149,170,149,186,85,170,93,169,85,165,85,169,85,106,85,122,85,169,117,165,85,149,85,101,
+85,105,85,122,86,165,213,149,85,85,85,85,85,101,85,121,90,149,86,87,85,85,85,85,85,85,85,117,106,85,90,93,
+86,85,85,85,85,85,85,117,170,85,106,117,90,85,86,85,85,85,85,117,170,86,170,213,106,85,90,85,86,85,86,117,
+170,170,85,170,87,169,85,170,149,170,149,186,170,170,85,169,93,165,85,169,85,106,85,122,170,170,85,165,117,149,85,101,
+85,105,85,122,170,170,85,149,213,85,85,85,85,101,85,121,170,170,86,85,85,87,85,85,85,85,85,117,170,170,90,85,
+86,93,85,85,85,85,85,117,170,170,106,85,90,117,86,85,85,85,85,117,170,170,170,85,106,213,90,85,86,85,86,117,
+170,170,170,170,85,169,87,170,149,170,149,186,170,170,170,170,85,165,93,169,85,106,85,122,170,170,170,170,85,149,117,101,
+85,105,85,122,170,170,170,170,85,85,213,85,85,101,85,121,170,170,170,170,85,85,85,87,85,85,85,117,170,170,170,170,
+86,85,85,93,85,85,85,117,170,170,170,170,90,85,86,117,85,85,85,117,170,170,170,170,106,85,90,213,86,85,86,117,
+170,170,170,170,170,170,149,170,151,170,149,186,170,170,170,170,170,170,85,170,93,106,85,122,170,170,170,170,170,170,85,105,
+117,106,85,122,170,170,170,170,170,170,85,101,213,105,85,121,170,170,170,170,170,170,85,85,85,103,85,117,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,149,170,151,186,170,170,170,170,170,170,170,170,85,170,157,186,170,170,170,170,170,170,170,170,
+85,170,117,186,170,170,170,170,170,170,170,170,85,169,213,185,170,170,170,170,170,170,170,170,85,169,85,187,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,170,165,186,170,170,170,170,170,170,170,170,170,170,149,186,170,170,170,170,170,170,170,170,
+170,170,86,186,170,170,170,170,170,170,170,170,170,170,90,185,170,170,170,170,170,170,170,170,170,170,106,185,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+149,170,85,170,85,169,85,170,85,170,85,234,85,170,85,169,85,165,85,169,85,106,85,234,85,169,85,165,85,149,85,101,
+85,105,85,234,86,165,85,149,85,85,85,85,85,101,85,234,90,149,86,85,85,85,85,85,85,85,85,234,106,85,90,85,
+86,85,85,85,85,85,85,234,170,85,106,85,90,85,86,85,85,85,85,234,170,86,170,85,106,85,90,85,86,85,170,234,
+151,170,85,170,85,169,85,170,85,170,85,234,93,170,85,169,85,165,85,169,85,106,85,234,117,169,85,165,85,149,85,101,
+85,105,85,233,214,165,85,149,85,85,85,85,85,101,85,233,90,151,86,85,85,85,85,85,85,85,85,229,106,93,90,85,
+86,85,85,85,85,85,85,213,170,117,106,85,90,85,86,85,85,85,85,213,170,214,170,85,106,85,90,85,86,85,86,213,
+149,170,87,170,85,169,85,170,85,170,85,234,85,170,93,169,85,165,85,169,85,106,85,234,85,169,117,165,85,149,85,101,
+85,105,85,233,86,165,213,149,85,85,85,85,85,101,85,233,90,149,86,87,85,85,85,85,85,85,85,229,106,85,90,93,
+86,85,85,85,85,85,85,213,170,85,106,117,90,85,86,85,85,85,85,213,170,86,170,213,106,85,90,85,86,85,86,213,
+170,170,85,170,87,169,85,170,85,170,85,234,170,170,85,169,93,165,85,169,85,106,85,234,170,170,85,165,117,149,85,101,
+85,105,85,233,170,170,85,149,213,85,85,85,85,101,85,233,170,170,86,85,85,87,85,85,85,85,85,229,170,170,90,85,
+86,93,85,85,85,85,85,213,170,170,106,85,90,117,86,85,85,85,85,213,170,170,170,85,106,213,90,85,86,85,86,213,
+170,170,170,170,85,169,87,170,85,170,85,234,170,170,170,170,85,165,93,169,85,106,85,234,170,170,170,170,85,149,117,101,
+85,105,85,233,170,170,170,170,85,85,213,85,85,101,85,233,170,170,170,170,85,85,85,87,85,85,85,229,170,170,170,170,
+86,85,85,93,85,85,85,213,170,170,170,170,90,85,86,117,85,85,85,213,170,170,170,170,106,85,90,213,86,85,86,213,
+170,170,170,170,170,170,85,170,87,170,85,234,170,170,170,170,170,170,85,170,93,106,85,234,170,170,170,170,170,170,85,105,
+117,105,85,233,170,170,170,170,170,170,85,101,213,105,85,233,170,170,170,170,170,170,85,85,85,103,85,229,170,170,170,170,
+170,170,85,85,85,93,85,213,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,85,170,87,234,170,170,170,170,170,170,170,170,85,170,93,234,170,170,170,170,170,170,170,170,
+85,169,117,234,170,170,170,170,170,170,170,170,85,169,213,233,170,170,170,170,170,170,170,170,85,101,85,231,170,170,170,170,
+170,170,170,170,85,101,85,237,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,170,165,234,170,170,170,170,170,170,170,170,170,170,149,234,170,170,170,170,170,170,170,170,
+170,170,86,234,170,170,170,170,170,170,170,170,170,170,90,233,170,170,170,170,170,170,170,170,170,170,106,229,170,170,170,170,
+170,170,170,170,170,170,170,229,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+149,170,85,170,85,169,85,165,85,149,85,149,85,170,85,169,85,165,85,149,85,85,85,85,85,169,85,165,85,149,85,85,
+85,85,85,85,86,165,85,149,85,85,85,85,85,85,85,85,90,149,86,85,85,85,85,85,85,85,89,85,106,85,90,85,
+86,85,85,85,89,85,105,85,170,85,106,85,90,85,90,85,105,85,169,85,170,86,170,85,106,85,106,85,170,85,170,85,
+151,170,85,170,85,169,85,165,85,149,85,149,93,170,85,169,85,165,85,149,85,85,85,85,117,169,85,165,85,149,85,85,
+85,85,85,85,214,165,85,149,85,85,85,85,85,85,85,85,90,151,86,85,85,85,85,85,85,85,89,85,106,93,90,85,
+86,85,85,85,89,85,105,85,170,117,106,85,90,85,90,85,105,85,169,85,170,214,170,85,106,85,106,85,170,85,170,85,
+149,170,87,170,85,169,85,165,85,149,85,149,85,170,93,169,85,165,85,149,85,85,85,85,85,169,117,165,85,149,85,85,
+85,85,85,85,86,165,213,149,85,85,85,85,85,85,85,85,90,149,86,87,85,85,85,85,85,85,89,85,106,85,90,93,
+86,85,85,85,89,85,105,85,170,85,106,117,90,85,90,85,105,85,169,85,170,86,170,213,106,85,106,85,170,85,170,85,
+170,170,85,170,87,169,85,165,85,149,85,149,170,170,85,169,93,165,85,149,85,85,85,85,170,170,85,165,117,149,85,85,
+85,85,85,85,170,170,85,149,213,85,85,85,85,85,85,85,170,170,86,85,85,87,85,85,85,85,89,85,170,170,90,85,
+86,93,85,85,89,85,105,85,170,170,106,85,90,117,90,85,105,85,169,85,170,170,170,85,106,213,106,85,170,85,170,85,
+170,170,170,170,85,169,87,165,85,149,85,149,170,170,170,170,85,165,93,149,85,85,85,85,170,170,170,170,85,149,117,85,
+85,85,85,85,170,170,170,170,85,85,213,85,85,85,85,85,170,170,170,170,85,85,85,87,85,85,89,85,170,170,170,170,
+86,85,85,93,89,85,105,85,170,170,170,170,90,85,90,117,105,85,169,85,170,170,170,170,106,85,106,213,170,85,170,85,
+170,170,170,170,170,170,85,165,87,149,85,149,170,170,170,170,170,170,85,149,93,85,85,85,170,170,170,170,170,170,85,85,
+117,85,85,85,170,170,170,170,170,170,85,85,213,85,85,85,170,170,170,170,170,170,85,85,85,87,89,85,170,170,170,170,
+170,170,85,85,89,93,105,85,170,170,170,170,170,170,90,85,105,117,169,85,170,170,170,170,170,170,106,85,170,213,170,85,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,
+85,85,117,85,170,170,170,170,170,170,170,170,85,85,217,85,170,170,170,170,170,170,170,170,89,85,105,87,170,170,170,170,
+170,170,170,170,105,85,169,93,170,170,170,170,170,170,170,170,169,85,169,117,170,170,170,170,170,170,170,170,170,85,170,213,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,
+170,170,90,170,170,170,170,170,170,170,170,170,170,170,90,169,170,170,170,170,170,170,170,170,170,170,106,165,170,170,170,170,
+170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,
+149,170,85,170,85,169,85,165,85,149,85,149,85,170,85,169,85,165,85,149,85,85,85,85,85,169,85,165,85,149,85,85,
+85,85,85,85,86,165,85,149,85,85,85,85,85,85,85,85,90,149,86,85,85,85,85,85,85,85,89,85,106,85,90,85,
+86,85,85,85,89,85,105,85,170,85,106,85,90,85,90,85,105,85,169,85,170,86,170,85,106,85,106,85,170,85,170,86,
+151,170,85,170,85,169,85,165,85,149,85,149,93,170,85,169,85,165,85,149,85,85,85,85,117,169,85,165,85,149,85,85,
+85,85,85,85,214,165,85,149,85,85,85,85,85,85,85,85,90,151,86,85,85,85,85,85,85,85,89,85,106,93,90,85,
+86,85,85,85,89,85,105,85,170,117,106,85,90,85,90,85,105,85,169,85,170,214,170,85,106,85,106,85,170,85,170,86,
+149,170,87,170,85,169,85,165,85,149,85,149,85,170,93,169,85,165,85,149,85,85,85,85,85,169,117,165,85,149,85,85,
+85,85,85,85,86,165,213,149,85,85,85,85,85,85,85,85,90,149,86,87,85,85,85,85,85,85,89,85,106,85,90,93,
+86,85,85,85,89,85,105,85,170,85,106,117,90,85,90,85,105,85,169,85,170,86,170,213,106,85,106,85,170,85,170,86,
+170,170,85,170,87,169,85,165,85,149,85,149,170,170,85,169,93,165,85,149,85,85,85,85,170,170,85,165,117,149,85,85,
+85,85,85,85,170,170,85,149,213,85,85,85,85,85,85,85,170,170,86,85,85,87,85,85,85,85,89,85,170,170,90,85,
+86,93,85,85,89,85,105,85,170,170,106,85,90,117,90,85,105,85,169,85,170,170,170,85,106,213,106,85,170,85,170,86,
+170,170,170,170,85,169,87,165,85,149,85,149,170,170,170,170,85,165,93,149,85,85,85,85,170,170,170,170,85,149,117,85,
+85,85,85,85,170,170,170,170,85,85,213,85,85,85,85,85,170,170,170,170,85,85,85,87,85,85,89,85,170,170,170,170,
+86,85,85,93,89,85,105,85,170,170,170,170,90,85,90,117,105,85,169,85,170,170,170,170,106,85,106,213,170,85,170,86,
+170,170,170,170,170,170,85,165,87,149,85,149,170,170,170,170,170,170,85,149,93,85,85,85,170,170,170,170,170,170,85,85,
+117,85,85,85,170,170,170,170,170,170,85,85,213,85,85,85,170,170,170,170,170,170,85,85,85,87,89,85,170,170,170,170,
+170,170,85,85,89,93,105,85,170,170,170,170,170,170,90,85,105,117,169,85,170,170,170,170,170,170,106,85,170,213,170,86,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,170,170,85,85,217,85,170,170,170,170,170,170,170,170,89,85,105,87,170,170,170,170,
+170,170,170,170,105,85,169,93,170,170,170,170,170,170,170,170,169,85,169,118,170,170,170,170,170,170,170,170,170,86,170,214,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,170,170,170,170,170,170,170,170,170,170,106,169,170,170,170,170,170,170,170,170,170,170,106,165,170,170,170,170,
+170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,
+149,170,85,170,85,169,85,165,85,169,85,170,85,170,85,169,85,165,85,149,85,85,85,85,85,169,85,165,85,149,85,85,
+85,85,85,85,86,165,85,149,85,85,85,85,85,85,85,85,90,149,86,85,85,85,85,85,85,85,85,85,106,85,90,85,
+86,85,85,85,89,85,105,85,170,85,106,85,90,85,90,85,105,85,169,85,170,86,170,85,106,85,106,85,170,85,170,86,
+151,170,85,170,85,169,85,165,85,169,85,170,93,170,85,169,85,165,85,149,85,85,85,85,117,169,85,165,85,149,85,85,
+85,85,85,85,214,165,85,149,85,85,85,85,85,85,85,85,90,151,86,85,85,85,85,85,85,85,85,85,106,93,90,85,
+86,85,85,85,89,85,105,85,170,117,106,85,90,85,90,85,105,85,169,85,170,214,170,85,106,85,106,85,170,85,170,86,
+149,170,87,170,85,169,85,165,85,169,85,170,85,170,93,169,85,165,85,149,85,85,85,85,85,169,117,165,85,149,85,85,
+85,85,85,85,86,165,213,149,85,85,85,85,85,85,85,85,90,149,86,87,85,85,85,85,85,85,85,85,106,85,90,93,
+86,85,85,85,89,85,105,85,170,85,106,117,90,85,90,85,105,85,169,85,170,86,170,213,106,85,106,85,170,85,170,86,
+170,170,85,170,87,169,85,165,85,169,85,170,170,170,85,169,93,165,85,149,85,85,85,85,170,170,85,165,117,149,85,85,
+85,85,85,85,170,170,85,149,213,85,85,85,85,85,85,85,170,170,86,85,85,87,85,85,85,85,85,85,170,170,90,85,
+86,93,85,85,89,85,105,85,170,170,106,85,90,117,90,85,105,85,169,85,170,170,170,85,106,213,106,85,170,85,170,86,
+170,170,170,170,85,169,87,165,85,169,85,170,170,170,170,170,85,165,93,149,85,85,85,85,170,170,170,170,85,149,117,85,
+85,85,85,85,170,170,170,170,85,85,213,85,85,85,85,85,170,170,170,170,85,85,85,87,85,85,85,85,170,170,170,170,
+86,85,85,93,89,85,105,85,170,170,170,170,90,85,90,117,105,85,169,85,170,170,170,170,106,85,106,213,170,85,170,86,
+170,170,170,170,170,170,85,165,87,169,85,170,170,170,170,170,170,170,85,149,93,85,85,85,170,170,170,170,170,170,85,85,
+117,85,85,85,170,170,170,170,170,170,85,85,213,85,85,85,170,170,170,170,170,170,85,85,85,87,85,85,170,170,170,170,
+170,170,85,85,89,93,105,85,170,170,170,170,170,170,90,85,105,117,169,85,170,170,170,170,170,170,106,85,170,213,170,86,
+170,170,170,170,170,170,170,170,149,169,103,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,89,85,101,87,170,170,170,170,
+170,170,170,170,105,85,169,93,170,170,170,170,170,170,170,170,169,85,169,118,170,170,170,170,170,170,170,170,170,86,170,218,
+170,170,170,170,170,170,170,170,170,170,169,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,
+170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,
+149,170,85,170,85,169,85,169,85,170,149,170,85,170,85,169,85,165,85,149,85,101,85,105,85,169,85,165,85,149,85,85,
+85,85,85,85,86,165,85,149,85,85,85,85,85,85,85,85,90,149,86,85,85,85,85,85,85,85,85,85,106,85,90,85,
+86,85,85,85,85,85,89,85,170,85,106,85,90,85,90,85,105,85,169,85,170,86,170,85,106,85,106,85,170,85,170,86,
+151,170,85,170,85,169,85,169,85,170,149,170,93,170,85,169,85,165,85,149,85,101,85,105,117,169,85,165,85,149,85,85,
+85,85,85,85,214,165,85,149,85,85,85,85,85,85,85,85,90,151,86,85,85,85,85,85,85,85,85,85,106,93,90,85,
+86,85,85,85,85,85,89,85,170,117,106,85,90,85,90,85,105,85,169,85,170,214,170,85,106,85,106,85,170,85,170,86,
+149,170,87,170,85,169,85,169,85,170,149,170,85,170,93,169,85,165,85,149,85,101,85,105,85,169,117,165,85,149,85,85,
+85,85,85,85,86,165,213,149,85,85,85,85,85,85,85,85,90,149,86,87,85,85,85,85,85,85,85,85,106,85,90,93,
+86,85,85,85,85,85,89,85,170,85,106,117,90,85,90,85,105,85,169,85,170,86,170,213,106,85,106,85,170,85,170,86,
+170,170,85,170,87,169,85,169,85,170,149,170,170,170,85,169,93,165,85,149,85,101,85,105,170,170,85,165,117,149,85,85,
+85,85,85,85,170,170,85,149,213,85,85,85,85,85,85,85,170,170,86,85,85,87,85,85,85,85,85,85,170,170,90,85,
+86,93,85,85,85,85,89,85,170,170,106,85,90,117,90,85,105,85,169,85,170,170,170,85,106,213,106,85,170,85,170,86,
+170,170,170,170,85,169,87,169,85,170,149,170,170,170,170,170,85,165,93,149,85,101,85,105,170,170,170,170,85,149,117,85,
+85,85,85,85,170,170,170,170,85,85,213,85,85,85,85,85,170,170,170,170,85,85,85,87,85,85,85,85,170,170,170,170,
+86,85,85,93,85,85,89,85,170,170,170,170,90,85,90,117,105,85,169,85,170,170,170,170,106,85,106,213,170,85,170,86,
+170,170,170,170,170,170,85,169,87,170,149,170,170,170,170,170,170,170,85,149,93,101,85,105,170,170,170,170,170,170,85,85,
+117,85,85,85,170,170,170,170,170,170,85,85,213,85,85,85,170,170,170,170,170,170,85,85,85,87,85,85,170,170,170,170,
+170,170,85,85,85,93,89,85,170,170,170,170,170,170,90,85,105,117,169,85,170,170,170,170,170,170,106,85,170,213,170,86,
+170,170,170,170,170,170,170,170,149,170,167,170,170,170,170,170,170,170,170,170,85,102,157,105,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,170,101,85,153,93,170,170,170,170,170,170,170,170,169,85,169,118,170,170,170,170,170,170,170,170,170,86,170,218,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,165,170,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,
+170,170,170,170,170,170,170,150,170,170,170,170,170,170,170,170,170,170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,
+149,170,85,170,85,169,85,169,85,170,149,170,85,170,85,169,85,165,85,165,85,105,85,106,85,169,85,165,85,149,85,85,
+85,85,85,101,86,165,85,149,85,85,85,85,85,85,85,85,90,149,86,85,85,85,85,85,85,85,85,85,106,85,90,85,
+86,85,85,85,85,85,85,85,170,85,106,85,90,85,86,85,89,85,105,85,170,86,170,85,106,85,106,85,170,85,170,86,
+151,170,85,170,85,169,85,169,85,170,149,170,93,170,85,169,85,165,85,165,85,105,85,106,117,169,85,165,85,149,85,85,
+85,85,85,101,214,165,85,149,85,85,85,85,85,85,85,85,90,151,86,85,85,85,85,85,85,85,85,85,106,93,90,85,
+86,85,85,85,85,85,85,85,170,117,106,85,90,85,86,85,89,85,105,85,170,214,170,85,106,85,106,85,170,85,170,86,
+149,170,87,170,85,169,85,169,85,170,149,170,85,170,93,169,85,165,85,165,85,105,85,106,85,169,117,165,85,149,85,85,
+85,85,85,101,86,165,213,149,85,85,85,85,85,85,85,85,90,149,86,87,85,85,85,85,85,85,85,85,106,85,90,93,
+86,85,85,85,85,85,85,85,170,85,106,117,90,85,86,85,89,85,105,85,170,86,170,213,106,85,106,85,170,85,170,86,
+170,170,85,170,87,169,85,169,85,170,149,170,170,170,85,169,93,165,85,165,85,105,85,106,170,170,85,165,117,149,85,85,
+85,85,85,101,170,170,85,149,213,85,85,85,85,85,85,85,170,170,86,85,85,87,85,85,85,85,85,85,170,170,90,85,
+86,93,85,85,85,85,85,85,170,170,106,85,90,117,86,85,89,85,105,85,170,170,170,85,106,213,106,85,170,85,170,86,
+170,170,170,170,85,169,87,169,85,170,149,170,170,170,170,170,85,165,93,165,85,105,85,106,170,170,170,170,85,149,117,85,
+85,85,85,101,170,170,170,170,85,85,213,85,85,85,85,85,170,170,170,170,85,85,85,87,85,85,85,85,170,170,170,170,
+86,85,85,93,85,85,85,85,170,170,170,170,90,85,86,117,89,85,105,85,170,170,170,170,106,85,106,213,170,85,170,86,
+170,170,170,170,170,170,85,169,87,170,149,170,170,170,170,170,170,170,85,165,93,105,85,106,170,170,170,170,170,170,85,85,
+117,85,85,101,170,170,170,170,170,170,85,85,213,85,85,85,170,170,170,170,170,170,85,85,85,87,85,85,170,170,170,170,
+170,170,85,85,85,93,85,85,170,170,170,170,170,170,86,85,89,117,105,85,170,170,170,170,170,170,106,85,170,213,170,86,
+170,170,170,170,170,170,170,170,149,170,167,170,170,170,170,170,170,170,170,170,85,106,157,106,170,170,170,170,170,170,170,170,
+85,89,117,102,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,153,85,105,118,170,170,170,170,170,170,170,170,170,86,170,218,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,
+170,170,150,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,90,170,170,170,170,170,170,170,170,170,170,170,90,
+149,170,85,170,85,169,85,169,85,170,149,170,85,170,85,169,85,165,85,165,85,105,85,106,85,169,85,165,85,149,85,85,
+85,101,85,105,86,165,85,149,85,85,85,85,85,85,85,85,90,149,86,85,85,85,85,85,85,85,85,85,106,85,90,85,
+86,85,85,85,85,85,85,85,170,85,106,85,90,85,86,85,85,85,85,85,170,86,170,85,106,85,90,85,106,85,170,85,
+151,170,85,170,85,169,85,169,85,170,149,170,93,170,85,169,85,165,85,165,85,105,85,106,117,169,85,165,85,149,85,85,
+85,101,85,105,214,165,85,149,85,85,85,85,85,85,85,85,90,151,86,85,85,85,85,85,85,85,85,85,106,93,90,85,
+86,85,85,85,85,85,85,85,170,117,106,85,90,85,86,85,85,85,85,85,170,214,170,85,106,85,90,85,106,85,170,85,
+149,170,87,170,85,169,85,169,85,170,149,170,85,170,93,169,85,165,85,165,85,105,85,106,85,169,117,165,85,149,85,85,
+85,101,85,105,86,165,213,149,85,85,85,85,85,85,85,85,90,149,86,87,85,85,85,85,85,85,85,85,106,85,90,93,
+86,85,85,85,85,85,85,85,170,85,106,117,90,85,86,85,85,85,85,85,170,86,170,213,106,85,90,85,106,85,170,85,
+170,170,85,170,87,169,85,169,85,170,149,170,170,170,85,169,93,165,85,165,85,105,85,106,170,170,85,165,117,149,85,85,
+85,101,85,105,170,170,85,149,213,85,85,85,85,85,85,85,170,170,86,85,85,87,85,85,85,85,85,85,170,170,90,85,
+86,93,85,85,85,85,85,85,170,170,106,85,90,117,86,85,85,85,85,85,170,170,170,85,106,213,90,85,106,85,170,85,
+170,170,170,170,85,169,87,169,85,170,149,170,170,170,170,170,85,165,93,165,85,105,85,106,170,170,170,170,85,149,117,85,
+85,101,85,105,170,170,170,170,85,85,213,85,85,85,85,85,170,170,170,170,85,85,85,87,85,85,85,85,170,170,170,170,
+86,85,85,93,85,85,85,85,170,170,170,170,90,85,86,117,85,85,85,85,170,170,170,170,106,85,90,213,106,85,170,85,
+170,170,170,170,170,170,85,169,87,170,149,170,170,170,170,170,170,170,85,165,93,105,85,106,170,170,170,170,170,170,85,85,
+117,101,85,105,170,170,170,170,170,170,85,85,213,85,85,85,170,170,170,170,170,170,85,85,85,87,85,85,170,170,170,170,
+170,170,85,85,85,93,85,85,170,170,170,170,170,170,86,85,85,117,85,85,170,170,170,170,170,170,90,85,106,213,170,85,
+170,170,170,170,170,170,170,170,149,170,167,170,170,170,170,170,170,170,170,170,85,106,157,106,170,170,170,170,170,170,170,170,
+85,105,117,106,170,170,170,170,170,170,170,170,85,101,213,89,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,106,86,170,217,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,
+170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,170,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,170,170,170,170,170,170,170,170,170,170,170,106,
+149,170,85,170,85,169,85,169,85,170,149,170,85,170,85,169,85,165,85,165,85,105,85,106,85,169,85,165,85,149,85,85,
+85,101,85,105,86,165,85,149,85,85,85,85,85,85,85,101,90,149,86,85,85,85,85,85,85,85,85,85,106,85,90,85,
+86,85,85,85,85,85,85,85,170,85,106,85,90,85,86,85,85,85,85,85,170,86,170,85,106,85,90,85,86,85,86,85,
+151,170,85,170,85,169,85,169,85,170,149,170,93,170,85,169,85,165,85,165,85,105,85,106,117,169,85,165,85,149,85,85,
+85,101,85,105,214,165,85,149,85,85,85,85,85,85,85,101,90,151,86,85,85,85,85,85,85,85,85,85,106,93,90,85,
+86,85,85,85,85,85,85,85,170,117,106,85,90,85,86,85,85,85,85,85,170,214,170,85,106,85,90,85,86,85,86,85,
+149,170,87,170,85,169,85,169,85,170,149,170,85,170,93,169,85,165,85,165,85,105,85,106,85,169,117,165,85,149,85,85,
+85,101,85,105,86,165,213,149,85,85,85,85,85,85,85,101,90,149,86,87,85,85,85,85,85,85,85,85,106,85,90,93,
+86,85,85,85,85,85,85,85,170,85,106,117,90,85,86,85,85,85,85,85,170,86,170,213,106,85,90,85,86,85,86,85,
+170,170,85,170,87,169,85,169,85,170,149,170,170,170,85,169,93,165,85,165,85,105,85,106,170,170,85,165,117,149,85,85,
+85,101,85,105,170,170,85,149,213,85,85,85,85,85,85,101,170,170,86,85,85,87,85,85,85,85,85,85,170,170,90,85,
+86,93,85,85,85,85,85,85,170,170,106,85,90,117,86,85,85,85,85,85,170,170,170,85,106,213,90,85,86,85,86,85,
+170,170,170,170,85,169,87,169,85,170,149,170,170,170,170,170,85,165,93,165,85,105,85,106,170,170,170,170,85,149,117,85,
+85,101,85,105,170,170,170,170,85,85,213,85,85,85,85,101,170,170,170,170,85,85,85,87,85,85,85,85,170,170,170,170,
+86,85,85,93,85,85,85,85,170,170,170,170,90,85,86,117,85,85,85,85,170,170,170,170,106,85,90,213,86,85,86,85,
+170,170,170,170,170,170,85,169,87,170,149,170,170,170,170,170,170,170,85,165,93,105,85,106,170,170,170,170,170,170,85,85,
+117,101,85,105,170,170,170,170,170,170,85,85,213,85,85,101,170,170,170,170,170,170,85,85,85,87,85,85,170,170,170,170,
+170,170,85,85,85,93,85,85,170,170,170,170,170,170,86,85,85,117,85,85,170,170,170,170,170,170,90,85,86,213,86,85,
+170,170,170,170,170,170,170,170,149,170,151,170,170,170,170,170,170,170,170,170,85,106,157,106,170,170,170,170,170,170,170,170,
+85,105,117,106,170,170,170,170,170,170,170,170,85,101,213,105,170,170,170,170,170,170,170,170,85,85,85,103,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,
+170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,169,170,170,170,170,170,170,170,170,170,170,106,169,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+149,170,85,170,85,169,85,169,85,170,85,170,85,170,85,169,85,165,85,165,85,105,85,106,85,169,85,165,85,149,85,85,
+85,101,85,105,86,165,85,149,85,85,85,85,85,85,85,101,90,149,86,85,85,85,85,85,85,85,85,85,106,85,90,85,
+86,85,85,85,85,85,85,85,170,85,106,85,90,85,86,85,85,85,85,85,170,86,170,85,106,85,90,85,86,85,86,85,
+151,170,85,170,85,169,85,169,85,170,85,170,93,170,85,169,85,165,85,165,85,105,85,106,117,169,85,165,85,149,85,85,
+85,101,85,105,214,165,85,149,85,85,85,85,85,85,85,101,90,151,86,85,85,85,85,85,85,85,85,85,106,93,90,85,
+86,85,85,85,85,85,85,85,170,117,106,85,90,85,86,85,85,85,85,85,170,214,170,85,106,85,90,85,86,85,86,85,
+149,170,87,170,85,169,85,169,85,170,85,170,85,170,93,169,85,165,85,165,85,105,85,106,85,169,117,165,85,149,85,85,
+85,101,85,105,86,165,213,149,85,85,85,85,85,85,85,101,90,149,86,87,85,85,85,85,85,85,85,85,106,85,90,93,
+86,85,85,85,85,85,85,85,170,85,106,117,90,85,86,85,85,85,85,85,170,86,170,213,106,85,90,85,86,85,86,85,
+170,170,85,170,87,169,85,169,85,170,85,170,170,170,85,169,93,165,85,165,85,105,85,106,170,170,85,165,117,149,85,85,
+85,101,85,105,170,170,85,149,213,85,85,85,85,85,85,101,170,170,86,85,85,87,85,85,85,85,85,85,170,170,90,85,
+86,93,85,85,85,85,85,85,170,170,106,85,90,117,86,85,85,85,85,85,170,170,170,85,106,213,90,85,86,85,86,85,
+170,170,170,170,85,169,87,169,85,170,85,170,170,170,170,170,85,165,93,165,85,105,85,106,170,170,170,170,85,149,117,85,
+85,101,85,105,170,170,170,170,85,85,213,85,85,85,85,101,170,170,170,170,85,85,85,87,85,85,85,85,170,170,170,170,
+86,85,85,93,85,85,85,85,170,170,170,170,90,85,86,117,85,85,85,85,170,170,170,170,106,85,90,213,86,85,86,85,
+170,170,170,170,170,170,85,169,87,170,85,170,170,170,170,170,170,170,85,165,93,105,85,106,170,170,170,170,170,170,85,85,
+117,101,85,105,170,170,170,170,170,170,85,85,213,85,85,101,170,170,170,170,170,170,85,85,85,87,85,85,170,170,170,170,
+170,170,85,85,85,93,85,85,170,170,170,170,170,170,86,85,85,117,85,85,170,170,170,170,170,170,90,85,86,213,86,85,
+170,170,170,170,170,170,170,170,85,170,87,170,170,170,170,170,170,170,170,170,85,106,93,106,170,170,170,170,170,170,170,170,
+85,105,117,106,170,170,170,170,170,170,170,170,85,101,213,105,170,170,170,170,170,170,170,170,85,85,85,103,170,170,170,170,
+170,170,170,170,85,85,85,93,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+170,170,170,170,170,170,170,170,170,170,165,170,170,170,170,170,170,170,170,170,170,170,149,170,170,170,170,170,170,170,170,170,
+170,170,86,170,170,170,170,170,170,170,170,170,170,170,90,169,170,170,170,170,170,170,170,170,170,170,106,165,170,170,170,170,
+170,170,170,170,170,170,170,165,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255
+};
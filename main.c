@@ -5,6 +5,12 @@
 #include <stdbool.h>            // For using bool type
 #include <math.h>               // Math functions (e.g., abs)
 #include <stdlib.h>             // Standard library (e.g., memory allocation)
+#include <string.h>             // memset, memcpy and string helpers
+#include <stddef.h>             // offsetof for the vertex layout
+#include <time.h>               // time() to seed the random number generator
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>          // SSE2 for blending pixels and packing boards
+#endif
 #include <windows.h>            // Windows API (for PlaySound, etc.)
 #include <mmsystem.h>           // Multimedia functions (for PlaySound)
 #define STB_IMAGE_IMPLEMENTATION // Include the implementation of stb_image for loading images
@@ -14,36 +20,502 @@
 
 // Constants for board and colors
 #define BOARD_SIZE 8            // Number of squares per side on the chessboard
+#define LOGICAL_SIZE 700        // Every screen is laid out in a 700x700 space that is scaled to fit the window
 #define SQUARE_SIZE 87          // Pixel size of each square (700px / 8 squares = 87.5px, rounded to 87px , thats why we can see the black line at the right edge it is about 4px wide, but it is not a problem for the game logic)
 
+// Game state that the rules functions read is thread-local, so headless tools can replay many games at once
+#ifdef _MSC_VER
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL _Thread_local
+#endif
+
 // Data structures and global variables
 typedef struct {
     int row, col;               // Structure to hold board coordinates
 } T_Coordinates;
 
-int board[8][8];                // The chessboard: each cell encodes piece and color
+typedef struct {
+    int fromRow, fromCol;       // Square the piece leaves
+    int toRow, toCol;           // Square the piece lands on
+    int promotion;              // Piece a pawn promotes to (3 = queen, 4 = rook, 5 = bishop, 6 = knight, 0 = queen)
+} T_Move;
+
+THREAD_LOCAL int board[8][8];   // The chessboard: each cell encodes piece and color
 bool availableMoves[8][8] = {0}; // Highlight legal moves for selected piece
 int selectedRow = -1, selectedCol = -1; // Currently selected square (-1 means none), to track which piece is selected, it is equal to the index of the row and column of the selected square in the board array
-int currentPlayer = 0;          // 0 for white's turn, 1 for black's turn
+THREAD_LOCAL int currentPlayer = 0; // 0 for white's turn, 1 for black's turn
 
 // Texture handles for each chess piece,
 // textures are images (often PNG, JPG) that are mapped onto the surfaces of shapes or 3D models to give them detailed appearance, color, or patterns.
 //GLuint is a data type defined by OpenGL. It stands for "Unsigned Integer for OpenGL" and is typically used to store non-negative integer values.
 //When you create a texture in OpenGL (using glGenTextures), OpenGL gives you a unique number (called a "texture handle" or "texture ID") that you use to refer to that texture later. This number is of type GLuint.
-GLuint whitePawnTex, whiteKingTex, whiteQueenTex, whiteRookTex, whiteBishopTex, whiteKnightTex;
-GLuint blackPawnTex, blackKingTex, blackQueenTex, blackRookTex, blackBishopTex, blackKnightTex;
+// All twelve piece images live in one atlas texture, so the pieces are drawn without switching textures
+#define ATLAS_PADDING 2         // Border around every image in the atlas, filled with its edge pixels
+typedef struct {
+    float u0, v0, u1, v1;       // Where an image lies in the atlas, in texture coordinates
+} T_AtlasRect;
+GLuint pieceAtlasTex;
+T_AtlasRect pieceAtlasRects[17]; // Indexed by board value (color * 10 + piece); all zero if the image is missing
+int pieceAtlasHalvings = -1;     // How many times the piece images were halved to fit the squares on screen (-1 before the atlas exists)
+
+// Every image file the game loads; the pieces come first, white then black, in piece code order
+#define ASSET_COUNT 14
+const char* assetFiles[ASSET_COUNT] = {
+    "White_Pawn.png", "White_King.png", "White_Queen.png", "White_Rook.png", "White_Bishop.png", "White_Knight.png",
+    "Black_Pawn.png", "Black_King.png", "Black_Queen.png", "Black_Rook.png", "Black_Bishop.png", "Black_Knight.png",
+    "Background_Main_Menu.jpg", "TheCreator.jpg" };
+
+// Asset bundle: all images already decoded to RGBA with their mip chains, read straight from a memory-mapped file
+// Layout: header, ASSET_COUNT table entries, then the images (level 0 first, each level half the size of the one before)
+#define BUNDLE_MAGIC "CHSA"
+#define BUNDLE_VERSION 1
+typedef struct {
+    char magic[4];
+    unsigned int version;
+    unsigned int count;         // Entries in use
+} T_BundleHeader;
+typedef struct {
+    char name[32];              // File name the image was decoded from
+    unsigned int width, height, levels;
+    unsigned int reserved;
+    unsigned long long offset;  // Where level 0 starts in the file
+} T_BundleEntry;
+const unsigned char* bundleData = NULL; // Mapped bundle (NULL if there is none)
+size_t bundleSize = 0;
+
+// Startup image loading: worker threads decode, the main thread uploads each image as soon as it is ready
+typedef struct {
+    const unsigned char* pixels; // RGBA pixels, NULL until decoded or if the file is missing
+    int width, height;
+    volatile LONG done;         // Set by the decoding thread once pixels is final
+    bool uploaded;              // Turned into a texture (main thread only)
+} T_LoadingImage;
+T_LoadingImage loadingImages[ASSET_COUNT]; // In assetFiles order
+volatile LONG nextImageToDecode = 0;
+LARGE_INTEGER startupCounter, counterFrequency; // For the time to the first frame
+bool firstFrameShown = false;
 GLuint menuBackgroundTex; // Add this near your other texture globals
 GLuint theCreatorTex; // Add texture for the creator's image
 
+// Batched rendering: the game screen is written into one vertex buffer per frame instead of one glBegin/glEnd per square and piece
+typedef struct {
+    float x, y;                 // Position in window pixels
+    float u, v;                 // Texture coordinates (only used by pieces)
+    unsigned char r, g, b, a;   // Color
+} T_Vertex;
+#define RENDER_MAX_VERTICES 8192 // Squares, outlines, highlights and pieces of one board fit easily
+T_Vertex renderVertices[RENDER_MAX_VERTICES];
+int renderCount = 0;            // Vertices in the batch of the current frame
+GLuint boardBuffer = 0;         // Vertex buffer object, created on first use
+
+// Instanced pieces: one static quad, drawn once per piece from a small buffer of instances
+// A board view owns its instance buffer, so many boards can share one window and only rebuild what changed
+typedef struct {
+    float col, row;             // Top left corner in squares, fractional while a piece slides
+    float atlas;                // Atlas index (color * 6 + piece - 1)
+    float alpha;                // 1 = opaque, less while a captured piece fades out
+} T_PieceInstance;
+#define PIECE_EXTRA_INSTANCES 3 // Room after the board's pieces for the animated ones: two slides and one fading capture
+typedef struct {
+    float x, y, squareSize;     // Where the board is drawn, in pixels
+    GLuint vertexArray;         // Quad and instance buffer bindings, created on first draw
+    GLuint instanceBuffer;
+    int instanceCount;          // Pieces of lastBoard in the buffer, -1 = not built yet
+    int lastBoard[8][8];        // Board the instance buffer was built from
+} T_BoardView;
+GLuint pieceProgram = 0;        // Instanced piece shader, 0 if the driver cannot run it
+GLint pieceOriginUniform;
+GLuint pieceQuadBuffer;
+T_BoardView mainBoardView = { 0, 0, SQUARE_SIZE }; // reshape derives the square size from the window
+int viewportX = 0, viewportY = 0, viewportSize = LOGICAL_SIZE; // The square part of the window the screens are drawn into, in pixels
+
+// Dirty flags: everything that changes the picture says what it changed, and only then a frame is requested
+// A frame that GLUT asks for anyway (window uncovered) redraws from the buffers that are still valid
+#define DIRTY_BOARD 1           // Pieces moved
+#define DIRTY_SELECTION 2       // Selected square and its move highlights
+#define DIRTY_HIGHLIGHTS 4      // Opening trainer book moves
+#define DIRTY_OVERLAY 8         // Explorer panel and other text on top of the board
+#define DIRTY_SCREEN 16         // Menu, credits or game screen, or a menu setting
+#define DIRTY_ANIMATION 32      // Pieces of the last move are on their way
+#define DIRTY_ALL 63
+#define DIRTY_BATCH (DIRTY_BOARD | DIRTY_SELECTION | DIRTY_HIGHLIGHTS | DIRTY_SCREEN) // Changes that need a new board vertex batch
+unsigned int dirtyFlags = DIRTY_ALL;
+int renderColoredCount = 0;     // Vertices of squares and highlights at the start of the batch, the rest are pieces
+int framesDrawn = 0, batchesBuilt = 0; // Printed at exit to see how much rendering was saved
+
+// Move animation: the pieces of the last move slide to their squares and a captured piece fades out
+// Driven by a glutTimerFunc at the display refresh while something moves, and by nothing at all otherwise
+#define ANIMATION_MS 180.0          // Length of a move animation
+#define ANIMATION_MAX_STEP_MS 50.0  // A late frame advances the animation by at most this much, so a hitch slows it down instead of skipping it
+typedef struct {
+    int piece, fromRow, fromCol, toRow, toCol;
+} T_Slide;
+T_Slide slides[2];              // The moving piece, and the rook when castling
+int slideCount = 0;
+int fadePiece = 0, fadeRow, fadeCol; // Captured piece (0 if none)
+bool animating = false;
+int animationId = 0;            // Tells the timer of an old animation apart from the running one
+double animationElapsed, lastAnimationFrame; // Animation time so far and clock of its last frame, in ms
+int animationBoard[8][8];       // The board without the pieces that are still sliding, drawn while animating
+int frameIntervalMs = 16;       // Display refresh, measured at startup
+
+// Text from font atlases: every GLUT bitmap font is rasterised once into a texture, and every label is kept as a vertex buffer
+#define TEXT_FIRST_CHAR 32      // Space, the first printable character
+#define TEXT_CHARS 96           // Space up to the end of ASCII, 16 characters per atlas row
+#define TEXT_PADDING 2          // Empty pixels around each glyph cell
+#define TEXT_FONTS 3
+#define TEXT_CACHE_SIZE 64      // Labels kept ready to draw
+#define TEXT_MAX 128            // Longest label that is cached
+typedef struct {
+    void* glutFont;             // GLUT font the atlas was made from
+    GLuint texture;
+    int cellWidth, cellHeight;  // Size of one character cell in the atlas
+    int descent;                // Height of the baseline above the bottom of a cell
+    int atlasWidth, atlasHeight;
+    unsigned char advance[TEXT_CHARS]; // How far the pen moves after each character
+} T_Font;
+typedef struct {
+    void* glutFont;
+    int x, y;                   // Baseline start on screen
+    char text[TEXT_MAX];
+    GLuint buffer;              // The label's quads
+    int vertexCount;
+    int lastUsed;               // The least recently used label is replaced when the cache is full
+} T_TextRun;
+T_Font textFonts[TEXT_FONTS];
+int textFontCount = 0;          // Fonts with an atlas
+T_TextRun textCache[TEXT_CACHE_SIZE];
+int textClock = 0;
+
 // These variables is meant to handle the movements of some pieces for casteling reasons 
-bool whiteKingMoved = false, blackKingMoved = false;
-bool whiteKingsideRookMoved = false, whiteQueensideRookMoved = false;
-bool blackKingsideRookMoved = false, blackQueensideRookMoved = false;
+THREAD_LOCAL bool whiteKingMoved = false, blackKingMoved = false;
+THREAD_LOCAL bool whiteKingsideRookMoved = false, whiteQueensideRookMoved = false;
+THREAD_LOCAL bool blackKingsideRookMoved = false, blackQueensideRookMoved = false;
 
 // Game state management
 int gameState = 0; // 0 = menu, 1 = game, 2 = credits
 int starter = 0;   // 0 = white, 1 = black
 
+// Extra position state needed to write a complete FEN
+#define FEN_MAX 100     // Longest FEN string plus terminator
+#define MAX_GAME_PLIES 1024 // Longest game that is recorded or stored
+
+// Everything that describes a position during a game, so it can be saved and put back in one go
+typedef struct {
+    int board[8][8];
+    int currentPlayer;
+    bool castling[6];   // whiteKingMoved, blackKingMoved, then the four rook flags in declaration order
+    int enPassantCol;
+    int halfmoveClock, fullmoveNumber;
+} T_GameState;
+THREAD_LOCAL int enPassantCol = -1;  // Column of a pawn that just moved two squares (-1 = none)
+THREAD_LOCAL int halfmoveClock = 0;  // Moves since the last capture or pawn move
+THREAD_LOCAL int fullmoveNumber = 1; // Starts at 1 and goes up after every black move
+
+// Streaming PGN reading: the file goes through one fixed buffer and every token is parsed in place
+#define PGN_BUFFER_SIZE (1 << 20)  // Bytes read from disk at a time
+#define PGN_TOKEN_MAX 32           // Longest move or tag name kept, longer tokens are cut
+#define PGN_TAG_VALUE_MAX 256      // Longest tag value kept
+typedef struct {
+    FILE* file;                    // File being read
+    long long remaining;           // Bytes still allowed to be read (-1 = until the end of the file)
+    size_t length, pos;            // Bytes in the buffer and the read position inside it
+    unsigned char buffer[PGN_BUFFER_SIZE];
+} T_PgnReader;
+typedef struct {
+    char result[8];                // "1-0", "0-1", "1/2-1/2" or "*"
+    int plies;                     // Number of moves replayed
+    bool error;                    // True if a move could not be played (illegal, ambiguous or garbled)
+    char errorMove[PGN_TOKEN_MAX]; // The move that failed
+    char startFEN[FEN_MAX];        // FEN tag of the game ("" = standard starting position)
+    unsigned short moves[MAX_GAME_PLIES]; // Replayed moves in the 16-bit binary encoding
+} T_PgnGame;
+
+// Parallel PGN import: the file is cut into chunks at game boundaries and worker threads replay whole chunks
+#define PGN_CHUNK_SIZE (8 << 20)   // Approximate bytes per chunk
+#define PGN_CHUNK_ERRORS 10        // Errors remembered per chunk for the report
+#define PGN_MAX_THREADS 64
+typedef struct {
+    long long start, end;          // Byte range of the chunk in the file
+    long games, plies, errors;     // Filled in by the worker that replays the chunk
+    long whiteWins, blackWins, draws;
+    long errorGame[PGN_CHUNK_ERRORS]; // Game number inside the chunk of each remembered error
+    int errorPly[PGN_CHUNK_ERRORS];
+    char errorMove[PGN_CHUNK_ERRORS][PGN_TOKEN_MAX];
+} T_PgnChunk;
+typedef struct {
+    const char* filename;
+    T_PgnChunk* chunks;
+    int chunkCount;
+    volatile LONG nextChunk;       // Next chunk to hand out, shared by all workers
+} T_PgnImport;
+
+// Record of a game as SAN moves, so it can be written as PGN
+#define SAN_MAX 10                 // Longest SAN move ("Qa1xb2+" or "exd8=Q#") plus terminator
+typedef struct {
+    char startFEN[FEN_MAX];        // Position the game started from
+    int count;                     // Number of moves recorded
+    char san[MAX_GAME_PLIES][SAN_MAX];
+    char result[8];                // "1-0", "0-1", "1/2-1/2" or "*" while the game is running
+} T_GameRecord;
+T_GameRecord guiGame;              // The game being played in the window
+bool guiGameSaved = false;         // True once guiGame has been written to games.pgn
+
+// Snapshot files: one fixed header with the whole game state, then the SAN moves played so far (SAN_MAX bytes each)
+#define SNAPSHOT_MAGIC "CHSS"
+#define SNAPSHOT_VERSION 1
+#define AUTOSAVE_FILE "autosave.sav"  // Rewritten after every move, restored on the next start
+typedef struct {
+    char magic[4];
+    unsigned char version;
+    unsigned char screen, starter, trainer; // gameState, starter and trainerMode
+    unsigned char board[64];            // Board values, row by row
+    unsigned char player;               // Side to move
+    unsigned char castling;             // One bit per castling flag, in T_GameState order
+    signed char enPassantCol;
+    unsigned char reserved;
+    unsigned short halfmoveClock, fullmoveNumber;
+    unsigned short moveCount;           // Number of SAN moves after the header
+    char result[8];
+    char startFEN[FEN_MAX];
+} T_SnapshotHeader;
+
+// Binary game files: a 5-byte file header ("CHSG" + version), then per game a 4-byte header
+// (2-byte move count, result, FEN length), the start FEN if it is not the standard one, and 2 bytes per move
+#define BINARY_MAGIC "CHSG"
+#define BINARY_VERSION 1
+typedef struct {
+    char startFEN[FEN_MAX];        // "" = standard starting position
+    int result;                    // 0 = unknown, 1 = white won, 2 = black won, 3 = draw
+    int count;                     // Number of moves
+    unsigned short moves[MAX_GAME_PLIES]; // Moves packed by encodeMove
+} T_BinaryGame;
+
+// Position database: sorted 32-byte entries (one per position and move) in a memory-mapped file
+// Building it needs a fixed amount of memory; looking things up maps the whole file, so a 32-bit build is limited to about
+// 1 GB (30 million position/move pairs) while a 64-bit build can map databases of hundreds of millions of positions
+#define DB_MAGIC "CHESSDB3"
+#define DB_RUN_ENTRIES (1 << 22)   // Entries sorted in memory at a time while building (128 MB)
+#define DB_MAX_RUNS 500            // Sorted runs merged at the end, about 2 billion positions
+typedef struct {
+    unsigned long long key;        // polyglotHash of the position before the move
+    unsigned short move;           // Move played, packed by encodeMove
+    unsigned short reserved;
+    unsigned int whiteWins, draws, blackWins; // Results of the games that played this move here
+    unsigned int firstGame;        // Index of the first game (in the source file) that reached this position and move
+    unsigned int games;            // All games that played this move here, also those with an unknown result
+} T_DbEntry;
+const T_DbEntry* dbEntries = NULL; // Mapped entries (NULL if there is no database)
+size_t dbCount = 0;
+bool explorerMode = false;         // Show the explorer panel with the database moves of the board position
+
+// Packed position for training data: 32 bytes instead of the 256 of an int[8][8] board
+typedef struct {
+    unsigned long long occupancy;  // Bit (row * 8 + col) set for every occupied square
+    unsigned char pieces[16];      // 4 bits per occupied square in bit order: color in bit 3, piece code in bits 0-2
+    unsigned char flags;           // Bit 0 side to move, bits 1-4 castling rights K, Q, k, q
+    signed char enPassant;         // En passant column or -1
+    short score;                   // Evaluation in centipawns from white's point of view
+    unsigned char result;          // 0 = unknown, 1 = white won, 2 = black won, 3 = draw
+    unsigned char halfmoveClock;
+    unsigned short fullmoveNumber;
+} T_PackedPosition;
+#define SHARD_POSITIONS (1L << 22) // Positions per shard file (128 MB)
+typedef struct {
+    char prefix[260];              // Shard files are named prefix-000.bin, prefix-001.bin, ...
+    FILE* file;                    // Shard being written
+    int shard;                     // Number of the current shard
+    long perShard, inShard;        // Shard capacity and how much of it is used
+    long total;                    // Positions written over all shards
+} T_ShardWriter;
+
+// EPD test suites: each line is a position plus operations (id, bm, am, D1-D8 perft counts)
+#define EPD_MAX_DEPTH 8
+#define EPD_MOVES_MAX 64
+#define EPD_UNSUPPORTED 0  // Nothing in the line that this program can check
+#define EPD_PASSED 1
+#define EPD_FAILED 2
+typedef struct {
+    char fen[FEN_MAX];
+    char id[64];
+    char bestMoves[EPD_MOVES_MAX], avoidMoves[EPD_MOVES_MAX]; // SAN lists of the bm and am operations
+    long long perft[EPD_MAX_DEPTH + 1]; // Expected perft count per depth (0 = not given)
+    int maxDepth;
+    int status;                    // EPD_PASSED, EPD_FAILED or EPD_UNSUPPORTED
+    int depthReached;              // Deepest perft depth checked
+    long long nodes;               // Perft and search nodes counted
+    DWORD ms;                      // Time spent on the position
+    char played[SAN_MAX];          // Move the search chose for bm/am positions ("" = not searched)
+    long long evalHits, evalMisses; // Evaluation cache use of the search
+    int searchDepth;               // Deepest finished search depth
+    long long solvedNodes;         // Search nodes until the move was found for good (-1 = not solved)
+    DWORD solvedMs;                // Search time until the move was found for good
+    char detail[64];               // Why the position failed or stopped early
+} T_EpdPosition;
+typedef struct {
+    T_EpdPosition* positions;
+    int count;
+    volatile LONG next;            // Next position to hand out to a worker
+    long long nodeBudget;          // Maximum perft and search nodes per position
+    DWORD timeBudget;              // Maximum search time per position in milliseconds
+} T_EpdSuite;
+
+// Self-play: a small alpha-beta search with a node budget plays both sides, positions go to sharded packed files
+#define SEARCH_MAX_PLY 32
+#define SEARCH_MATE 32000          // Score of a mate right now, mates further away score a bit less
+#define SELFPLAY_RANDOM_PLIES 8    // Random moves at the start of every game
+#define EVAL_CACHE_ENTRIES (1 << 16) // Default evaluation cache entries per search thread (1 MB), --evalcache N changes it
+typedef struct {
+    unsigned long long key;        // positionHash of the evaluated position (0 means empty entry)
+    int score;                     // evaluate() for the side to move
+} T_EvalCacheEntry;
+typedef struct {
+    T_Move moves[SEARCH_MAX_PLY][256]; // Move list of every ply, allocated once per worker and reused for all games
+    long long nodes, nodeLimit;
+    DWORD startTime, timeLimit;    // Time budget in milliseconds, 0 = only the node budget counts
+    bool stopped;                  // Node or time budget used up, the search unwinds
+    long long tableHits;           // Positions the endgame tables answered instead of searching them
+    T_EvalCacheEntry* evalCache;   // Direct-mapped cache of leaf evaluations, every search thread has its own
+    unsigned int evalCacheMask;    // Entries - 1, the entry count is a power of two
+    long long evalHits, evalMisses; // Counters over the whole life of the search state
+    T_Move bestMove;               // Best root move of the last finished depth
+    int depthReached;              // Deepest finished depth, the arrays below are filled up to it
+    T_Move depthMoves[SEARCH_MAX_PLY + 1]; // Best root move after every finished depth
+    long long depthNodes[SEARCH_MAX_PLY + 1]; // Nodes searched when that depth finished
+    DWORD depthMs[SEARCH_MAX_PLY + 1]; // Milliseconds since the start when that depth finished
+} T_SearchState;
+typedef struct {
+    int games;                     // Games to play in total
+    long long nodesPerMove;
+    volatile LONG nextGame;        // Games handed out to workers so far
+} T_SelfPlay;
+typedef struct {
+    T_SelfPlay* run;
+    T_SearchState search;
+    T_PackedPosition batch[MAX_GAME_PLIES]; // Positions of the game being played
+    T_ShardWriter writer;          // Every worker writes its own shards, so nothing has to be locked
+    unsigned int seed;             // Random state for the openings
+    int games, results[3];         // Games played and white wins, black wins, draws
+} T_SelfPlayWorker;
+
+// Headless board diagrams: squares and pieces composited on the CPU into an RGBA buffer, written as PNG, one worker per core
+#define DIAGRAM_SQUARE 48          // Default pixel size of a square in a diagram (main.exe --square N)
+#define PNG_WINDOW 32768           // Farthest back a deflate match can reach
+typedef struct {
+    unsigned char* pieces[17];     // Premultiplied RGBA images scaled to one square, by board value (NULL if missing)
+    int squareSize;
+    char** fens;                   // One position per diagram
+    int count;
+    const char* prefix;            // Output files are prefix-00000.png, ...
+    volatile LONG next;            // Next position to hand out to a worker
+    volatile LONG written, failed;
+} T_DiagramRun;
+typedef struct {
+    unsigned char* data;           // Bytes written so far
+    size_t size, capacity;
+    unsigned int bits, bitCount;   // Bits not yet flushed, deflate fills bytes from the lowest bit
+} T_ByteWriter;
+
+// Zobrist keys: one random 64-bit number per (color, piece, square), plus side to move and the four castling rights
+// XORing the keys of everything on the board gives a hash that identifies the whole position
+unsigned long long zobristPieces[2][7][64];
+unsigned long long zobristSide;
+unsigned long long zobristCastling[4];
+unsigned long long zobristEnPassant[8];
+
+// Direct-mapped cache of the legal target squares of a piece, keyed by the position hash and the piece square
+// Selecting the same piece again in the same position skips the whole isLegalMove/isInCheck scan
+#define MOVE_CACHE_SIZE 4096    // Number of cache entries, must be a power of two
+typedef struct {
+    unsigned long long key;     // Position hash mixed with the selected square (0 means empty entry)
+    unsigned long long targets; // Bit (row * 8 + col) is set if the piece can legally move there
+} T_MoveCacheEntry;
+T_MoveCacheEntry moveCache[MOVE_CACHE_SIZE];
+unsigned long moveCacheHits = 0, moveCacheMisses = 0; // Counters to measure how useful the cache is
+unsigned int evalCacheEntries = EVAL_CACHE_ENTRIES; // Evaluation cache size of every search thread
+
+// Endgame tables: plies to mate in KQK, KRK, KPK and KBNK, generated offline by retrograde analysis (main.exe --build-egt endgame.egt)
+// and memory-mapped at startup. The side with the pieces is always stored as white. Pawnless tables index one of the 462 king
+// pairs left after the board symmetries, the pawn table keeps the pawn on files a-d; every further piece only counts free squares.
+// Each table is bit-packed with as many bits as its longest mate needs: plies to mate + 1, 0 = draw or impossible.
+#define EGT_MAGIC "CHESSEGT"
+#define EGT_TABLES 4
+#define EGT_MAX_PIECES 2               // Pieces of the strong side besides its king
+#define EGT_KING_PAIRS 462             // Strong king in the a1-d1-d4 triangle and a weak king that does not touch it
+#define EGT_DRAW 254                   // Working values while building (one byte): 0 = not known yet, below 254 = plies to mate + 1
+#define EGT_INVALID 255                // The side that just moved in check, or a symmetric copy of a stored position
+typedef struct {
+    const char* name;
+    int pieces[EGT_MAX_PIECES];        // Piece codes of the strong side besides its king
+    int count;
+    bool pawns;                        // The pawn table (one pawn, pieces[0]) may only be mirrored left to right
+} T_EgtDefinition;
+const T_EgtDefinition egtDefinitions[EGT_TABLES] = { // KQK and KRK first, KPK promotes into them
+    { "KQK", { 3 }, 1, false }, { "KRK", { 4 }, 1, false }, { "KPK", { 1 }, 1, true }, { "KBNK", { 5, 6 }, 2, false }
+};
+const int egtKingSteps[8][2] = { { -1, -1 }, { -1, 0 }, { -1, 1 }, { 0, -1 }, { 0, 1 }, { 1, -1 }, { 1, 0 }, { 1, 1 } }; // Row and column
+typedef struct {
+    char name[8];
+    unsigned int positions;            // Both sides to move
+    unsigned int bits;                 // Bits per position
+    unsigned int offset, size;         // Where the packed values are in the file, in bytes
+} T_EgtEntry;
+typedef struct {
+    char magic[8];                     // EGT_MAGIC
+    unsigned int count;                // Tables in the file
+    T_EgtEntry entries[EGT_TABLES];
+} T_EgtHeader;
+const unsigned char* egtData = NULL;   // Mapped table file (NULL if there is none)
+const T_EgtEntry* egtEntries[EGT_TABLES]; // Entry of every table in egtDefinitions order, NULL if the file does not have it
+short egtKingPair[10][64];             // King pair number by triangle slot of the strong king and weak king square, -1 = not stored
+unsigned char egtKingPairSquares[EGT_KING_PAIRS][2]; // Strong and weak king square of every pair
+bool egtKingsReady = false;            // The two king pair tables are filled
+
+// Building a table: ply by ply, every pass split into index ranges, one per worker thread
+#define EGT_PHASE_INIT 0               // Sort out impossible positions, list the weak king's moves, find mates and promotions
+#define EGT_PHASE_STRONG 1             // Positions lost at this ply make the positions before them won one ply later
+#define EGT_PHASE_WEAK 2               // Positions where every weak king move reaches a won position are lost
+typedef struct {
+    const T_EgtDefinition* def;
+    int positions;
+    volatile unsigned char* values;    // Plies to mate + 1, 0 (not known yet), EGT_DRAW or EGT_INVALID
+    unsigned char* aux;                // Weak side to move: its legal king moves as egtKingSteps bits; strong side: value of its best promotion
+    const unsigned char* converted[2]; // Finished KQK and KRK values, for the promotions in KPK
+} T_EgtBuild;
+typedef struct {
+    T_EgtBuild* build;
+    int phase, ply;
+    int begin, end;                    // Index range of this worker
+    long changed;                      // Positions solved by this worker in the pass
+    int longest;                       // Highest promotion value seen in the first pass
+} T_EgtWorker;
+
+// King and pawn against king bitbase: 2 bits per position (unknown, draw, win, invalid), 96 KB in total
+// Indexed by side to move, pawn-side king, lone king and pawn square (rows 1-6 only, 48 squares)
+// Generated once by main.exe --write-kpk kpk_bitbase.h and compiled in, so nothing is built while playing
+#define KPK_POSITIONS (2 * 64 * 64 * 48)
+#define KPK_INDEX(stm, wk, bk, psq) ((((stm) * 64 + (wk)) * 64 + (bk)) * 48 + (psq) - 8)
+#define KPK_UNKNOWN 0
+#define KPK_DRAW 1
+#define KPK_WIN 2
+#define KPK_INVALID 3
+#define KPK_WIN_BONUS 500       // Added for the pawn side of a won KPK ending: more than the pawn, less than promoting it gains
+#include "kpk_bitbase.h"        // static const unsigned char kpkBitbase[KPK_POSITIONS / 4]
+
+// Opening book in the Polyglot .bin layout: sorted 16-byte entries (key, move, weight, learn), read straight from a memory-mapped file
+// The keys are polyglotHash values, so books made by other Polyglot tools work too
+typedef struct {
+    int fromRow, fromCol, toRow, toCol; // The book move in board coordinates
+    int weight;                         // How often the move was played, used for the random pick
+} T_BookMove;
+const unsigned char* bookData = NULL; // Mapped book file (NULL if there is no book)
+size_t bookEntries = 0;               // Number of 16-byte entries in the book
+#include "polyglot_random.h"           // static const unsigned long long polyglotRandom[781]
+bool trainerMode = false;             // Opening trainer: highlight the book moves and comment on every move
+T_BookMove bookHints[32];             // Book moves for the position on the board, shown by the trainer
+int bookHintCount = 0;
+
 // Check if mouse is inside a rectangle function to help with button clicks
 bool inRect(int mx, int my, int x, int y, int w, int h) {
     return mx >= x && mx <= x + w && my >= y && my <= y + h;
@@ -53,15 +525,170 @@ bool inRect(int mx, int my, int x, int y, int w, int h) {
 bool isLegalMove(int board[8][8], int fromRow, int fromCol, int toRow, int toCol, int currentPlayer); // Checks if a move is legal
 bool isInCheck(int board[8][8], int player);      // Checks if a player is in check
 bool isCheckmate(int board[8][8], int player);    // Checks if a player is in checkmate
+bool isInsufficientMaterial(int board[8][8]);     // Checks if neither side has enough pieces left to mate
+void makeMove(int board[8][8], T_Move move);      // Moves a piece on a board (castling, en passant, promotion)
+void playMove(T_Move move);                       // Plays a move in the game and switches the turn
+int generateLegalMoves(int board[8][8], int player, int fromSquare, int toSquare, T_Move moves[]); // Lists legal moves
+void newGame(void);                               // Resets the game to the initial position
+void saveGameState(T_GameState* state);           // Copies the game state
+void restoreGameState(const T_GameState* state);  // Puts a copied game state back
+long long perft(int depth);                       // Counts the leaf positions of the move tree
 void display(void);                               // Draws the board and pieces
 void mouse(int button, int state, int x, int y);  // Handles mouse clicks
 void boardInitializer(int board[8][8]);           // Sets up the initial board
-void reshape(int w, int h);                       // Handles window resizing and fixing the window size to 700x700
+void reshape(int w, int h);                       // Fits the screens into the resized window
 void updateAvailableMoves();                  // Updates the available moves for the selected piece
 GLuint loadTexture(const char* filename);         // Loads a PNG texture which is a common format for images with transparency, suitable for chess pieces
+void zobristInit(void);                           // Fills the Zobrist key tables
+unsigned long long positionHash(int board[8][8], int player); // Hashes the board, side to move, castling rights and en passant
+unsigned long long polyglotHash(int board[8][8], int player); // Hashes the position with the standard Polyglot keys (book and database)
+void printMoveCacheStats(void);                   // Prints the move cache hit/miss counters
+bool loadFEN(const char* fen);                    // Sets up the game from a FEN string
+void writeFEN(char* out);                         // Writes the current position as a FEN string
+void keyboard(unsigned char key, int x, int y);   // Handles copy/paste of positions
+void pgnReaderInit(T_PgnReader* reader, FILE* file, long long limit); // Starts reading PGN text from a file
+int pgnGetChar(T_PgnReader* reader);              // Gets the next PGN character, refilling the buffer when needed
+bool pgnReadGame(T_PgnReader* reader, T_PgnGame* game); // Reads and replays one game
+bool sanToMove(const char* san, T_Move* move);    // Resolves a SAN move for the side to play
+long long pgnFindGameStart(FILE* file, long long offset, long long fileSize); // Finds the next game boundary in a PGN file
+DWORD WINAPI pgnImportWorker(LPVOID param);      // Worker thread of the parallel PGN import
+int replayPgnFile(const char* filename, int threads); // Replays a whole PGN file on several threads and prints the speed
+void moveToSAN(int board[8][8], int player, T_Move move, char* out); // Writes a move in SAN
+void recordStart(T_GameRecord* record);           // Starts recording a game from the current position
+void recordMove(T_GameRecord* record, T_Move move); // Plays a move and records it
+void writeRecordPGN(FILE* file, const T_GameRecord* record, const char* event); // Writes one game as PGN
+bool exportGamesPGN(const char* filename, const T_GameRecord records[], int count, const char* event); // Appends games to a PGN file
+void saveGuiGame(void);                           // Saves the window's game to games.pgn
+bool snapshotSave(const char* filename);          // Writes the whole game to a snapshot file
+bool snapshotLoad(const char* filename);          // Continues the game from a snapshot file
+bool snapshotValid(const T_SnapshotHeader* header, char san[][SAN_MAX]); // Checks a snapshot before it is used
+void autosave(void);                              // Updates the autosave after a move
+unsigned short encodeMove(T_Move move);           // Packs a move into 16 bits
+T_Move decodeMove(unsigned short code);           // Unpacks a 16-bit move
+FILE* binaryCreate(const char* filename);         // Creates a binary game file
+FILE* binaryOpen(const char* filename);           // Opens a binary game file for reading
+void binaryWriteGame(FILE* file, const T_BinaryGame* game); // Appends one game
+bool binaryReadGame(FILE* file, T_BinaryGame* game); // Reads the next game
+void binaryReplayGame(const T_BinaryGame* game);  // Plays all moves of a binary game on the board
+int convertPgnToBinary(const char* pgnName, const char* binName); // Converts PGN to the binary format
+int replayBinaryFile(const char* filename);       // Replays a binary file and prints the speed
+int compareDbEntries(const void* a, const void* b); // Sort order of the position database
+void mergeDbEntry(T_DbEntry* into, const T_DbEntry* from); // Adds up two entries of the same position and move
+size_t sortDbRun(T_DbEntry* entries, size_t count); // Sorts and merges a run of database entries
+int buildPositionDatabase(const char* gamesName, const char* dbName); // Builds the position database from binary games
+bool databaseOpen(const char* filename);          // Maps the position database
+int databaseProbe(unsigned long long key, const T_DbEntry** first); // Finds the database moves of a position
+int databaseToBook(const char* dbName, const char* bookName, int minGames); // Writes an opening book from the database
+void drawExplorer(void);                          // Draws the explorer panel
+void renderQuad(float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, const unsigned char color[4]); // Adds a quad to the batch
+void renderOutline(float x0, float y0, float x1, float y1, float width, const unsigned char color[4]); // Adds a rectangle outline to the batch
+void buildBoardBatch(void);                       // Writes squares, highlights and pieces into the vertex buffer
+void drawBoard(unsigned int dirty);               // Draws squares, highlights and pieces from one vertex buffer
+void markDirty(unsigned int flags);               // Notes what changed on screen and asks for a frame
+int refreshIntervalMs(void);                      // Time between two display refreshes
+void startMoveAnimation(int before[8][8], int mover); // Starts animating the last move
+void animationFrame(int id);                      // Advances the move animation (timer callback)
+int animatedPieces(T_PieceInstance out[]);        // Lists the moving and fading pieces where they are now
+bool buildFontAtlas(T_Font* font, void* glutFont); // Rasterises a GLUT font into an atlas texture
+void initTextRenderer(void);                      // Builds the font atlases
+void drawText(void* glutFont, int x, int y, const char* text); // Draws a cached label
+void printRenderStats(void);                      // Prints how many frames and vertex batches were produced
+GLuint buildPieceAtlas(const T_LoadingImage pieces[], int halvings); // Packs the piece images into one atlas texture
+int pieceHalvings(int squarePixels);              // How much the piece images can shrink for squares of that size
+void updatePieceAtlas(void);                      // Rebuilds the piece atlas when the square size needs other image sizes
+void updatePieceAtlasUniforms(void);              // Gives the piece shader the atlas rectangles
+GLuint createTexture(const unsigned char* data, int width, int height); // Creates a texture from RGBA pixels
+void generateMipmaps(void);                       // Mip levels for the bound texture
+double elapsedMs(void);                           // Time since startup
+DWORD WINAPI imageDecodeWorker(LPVOID param);     // Decodes startup images on a worker thread
+void startImageLoading(void);                     // Starts getting all images
+void uploadLoadedImages(void);                    // Turns decoded images into textures
+int mipLevels(int width, int height);             // Counts the mip levels of an image
+void downsampleImage(const unsigned char* src, int width, int height, unsigned char* dst); // Makes the next mip level
+int packAssets(const char* bundleName);           // Writes all images pre-decoded into one bundle file
+bool bundleOpen(const char* filename);            // Maps the asset bundle
+const T_BundleEntry* bundleFind(const char* name); // Finds an image in the bundle
+const unsigned char* imageLoad(const char* filename, int* width, int* height); // Gets RGBA pixels from the bundle or the file
+void imageFree(const unsigned char* pixels);      // Releases pixels from imageLoad
+GLuint compileShader(GLenum type, const char* source); // Compiles one shader stage
+void initPieceRenderer(void);                     // Builds the instanced piece shader
+void drawPiecesInstanced(T_BoardView* view, int board[8][8], const T_PieceInstance extra[], int extraCount); // Draws all pieces of a board in one instanced call
+void packPosition(const T_GameState* state, int score, int result, T_PackedPosition* out); // Packs a position into 32 bytes
+void unpackPosition(const T_PackedPosition* in);  // Restores the game state from a packed position
+void packBoards(const T_GameState states[], int count, T_PackedPosition out[]); // Packs many positions (SSE2)
+void unpackBoards(const T_PackedPosition in[], int count, int boards[][8][8]); // Decodes many boards (SSE2)
+void shardWriterOpen(T_ShardWriter* writer, const char* prefix, long perShard); // Starts a sharded dataset
+bool shardWrite(T_ShardWriter* writer, const T_PackedPosition positions[], int count); // Appends packed positions
+void shardWriterClose(T_ShardWriter* writer);     // Closes the current shard
+int packGamesToShards(const char* gamesName, const char* prefix); // Packs all positions of a binary game file
+bool epdParse(const char* line, T_EpdPosition* pos); // Parses one EPD line
+void epdRunPosition(T_EpdPosition* pos, T_SearchState* search, long long nodeBudget, DWORD timeBudget); // Checks one EPD position
+void jsonEscape(const char* text, char* out, int size); // Escapes a string for a JSON value
+DWORD WINAPI epdWorker(LPVOID param);            // Worker thread of the EPD runner
+int runEpdSuite(const char* filename, int threads, long long nodeBudget, DWORD timeBudget); // Runs a whole EPD suite
+int evaluate(void);                               // Scores the position for the side to move
+bool searchCacheInit(T_SearchState* search, unsigned int entries); // Allocates the evaluation cache of a search thread
+void searchCacheFree(T_SearchState* search);      // Releases the evaluation cache
+int cachedEvaluate(T_SearchState* search);        // evaluate() through the evaluation cache
+bool probeSearchScore(int ply, int* score);       // Exact search score of an ending the endgame tables cover
+bool searchTableRoot(T_SearchState* search, int count, int* score); // Picks the root move from the endgame tables
+int searchPosition(T_SearchState* search, int depth, int alpha, int beta, int ply); // Alpha-beta search
+int searchBestMove(T_SearchState* search, long long nodeLimit, DWORD timeLimit); // Iterative deepening within a node and time budget
+unsigned int selfPlayRandom(T_SelfPlayWorker* worker); // Per-thread random numbers
+DWORD WINAPI selfPlayWorker(LPVOID param);       // Worker thread of the self-play generator
+int runSelfPlay(const char* prefix, int games, long long nodesPerMove, int threads); // Generates self-play training data
+unsigned char* scalePremultiplied(const unsigned char* src, int width, int height, int size); // Scales a piece to one square
+void blendPremultiplied(unsigned char* dst, const unsigned char* src, int pixels); // Blends pixels over the board (SSE2)
+void renderDiagram(const T_DiagramRun* run, int board[8][8], unsigned char* image); // Draws a board into an RGBA image
+void byteWrite(T_ByteWriter* out, const void* bytes, size_t count); // Appends bytes to a buffer
+void byteWrite32(T_ByteWriter* out, unsigned int value); // Appends a big-endian number
+void bitWrite(T_ByteWriter* out, unsigned int value, int count); // Appends deflate bits
+void huffmanWrite(T_ByteWriter* out, unsigned int code, int length); // Appends a Huffman code
+void deflateSymbol(T_ByteWriter* out, int symbol); // Appends a fixed-code literal or length
+void zlibCompress(T_ByteWriter* out, const unsigned char* data, size_t size); // Compresses into a zlib stream
+unsigned int pngCrc(const unsigned char* data, size_t size); // CRC of a PNG chunk
+void pngChunk(T_ByteWriter* out, const char* type, const unsigned char* data, size_t size); // Appends a PNG chunk
+bool writePng(const char* filename, const unsigned char* image, int width, int height); // Saves an image as PNG
+DWORD WINAPI diagramWorker(LPVOID param);         // Worker thread of the diagram renderer
+int renderFenFile(const char* filename, const char* prefix, int squareSize, int threads); // Renders a PNG per FEN line
+void egtInitKings(void);                          // Fills the king pair tables of the pawnless endgame tables
+int egtPositions(const T_EgtDefinition* def);     // Number of positions of a table, both sides to move
+int egtTransform(int sq, int t);                  // Applies one of the eight board symmetries to a square
+int egtSkip(int sq, const int taken[], int count); // Number of a square among the free squares
+int egtUnskip(int n, const int taken[], int count); // Free square with a given number
+int egtIndex(const T_EgtDefinition* def, int stm, const int squares[]); // Index of the canonical copy of a position
+void egtSquares(const T_EgtDefinition* def, int idx, int* stm, int squares[]); // Squares of the position at an index
+void egtBoard(const T_EgtDefinition* def, const int squares[], int board[8][8]); // Sets up a table position on a board
+bool egtClaim(volatile unsigned char* values, int idx, unsigned char expected, unsigned char value); // Compare-exchange of one byte
+DWORD WINAPI egtWorker(LPVOID param);             // Worker thread of the endgame table generator
+long egtRunPass(T_EgtBuild* build, int phase, int ply, int threads, int* longest); // Runs one pass on all workers
+unsigned char* egtBuildTable(const T_EgtDefinition* def, const unsigned char* converted[2], int threads, int* longest); // Generates one table
+int buildEndgameTables(const char* filename, int threads); // Generates all endgame tables into a file
+bool egtOpen(const char* filename);               // Maps the endgame table file
+int egtReadValue(const T_EgtEntry* entry, int idx); // Reads one bit-packed table value
+int probeEndgameTable(int board[8][8], int player, int* winner); // Looks up plies to mate in KQK, KRK, KPK and KBNK endings
+bool buildKPKBitbase(unsigned char* table, int threads); // Generates the king and pawn against king win/draw bitbase
+int writeKPKBitbase(const char* filename, int threads); // Generates the bitbase as a C header
+int probeKPK(int board[8][8], int player, int* winner); // Looks up win/draw in KPK endings
+int kpkGet(const unsigned char* table, int idx);  // Reads a 2-bit bitbase entry
+void kpkSet(unsigned char* table, int idx, int value); // Writes a 2-bit bitbase entry
+const unsigned char* mapFile(const char* filename, size_t* size); // Memory-maps a file read-only
+void unmapFile(const unsigned char* data);        // Releases a mapped file
+bool bookOpen(const char* filename);              // Maps the opening book
+unsigned long long bookRead(const unsigned char* p, int n); // Reads a big-endian number from the book
+int bookProbe(int board[8][8], unsigned long long key, T_BookMove moves[], int maxMoves); // Lists the book moves of a position
+bool bookPickMove(T_BookMove moves[], int count, T_BookMove* picked); // Picks a weighted random move from a probed list
+void updateBookHints(void);                       // Refreshes the trainer's highlighted book moves
 
 // ### Draw the chessboard and pieces ###
 void display(void) {
+    if (!firstFrameShown) {
+        firstFrameShown = true;
+        printf("First frame after %.1f ms\n", elapsedMs()); // Cold start: from main to something on the screen
+    }
+    unsigned int dirty = dirtyFlags; // Everything that changed since the last frame
+    dirtyFlags = 0;
+    framesDrawn++;
     if (gameState == 0) {
         glClear(GL_COLOR_BUFFER_BIT); // Clear the screen before drawing the menu
 
@@ -83,9 +710,8 @@ void display(void) {
         glVertex2i(220, 240); glVertex2i(520, 240); glVertex2i(520, 280); glVertex2i(220, 280);
         glEnd();
         glColor3f(1, 1, 1);
-        glRasterPos2i(330, 265);
         const char* startMsg = "Start Game";
-        for (const char* p = startMsg; *p; p++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *p);
+        drawText(GLUT_BITMAP_HELVETICA_18, 330, 265, startMsg);
 
         // Draw Credits button
         glColor3f(0.2f, 0.2f, 0.6f);
@@ -93,9 +719,8 @@ void display(void) {
         glVertex2i(220, 300); glVertex2i(520, 300); glVertex2i(520, 340); glVertex2i(220, 340);
         glEnd();
         glColor3f(1, 1, 1);
-        glRasterPos2i(340, 325);
         const char* creditsMsg = "Credits";
-        for (const char* p = creditsMsg; *p; p++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *p);
+        drawText(GLUT_BITMAP_HELVETICA_18, 340, 325, creditsMsg);
 
         // Draw Change Starter button
         glColor3f(0.6f, 0.4f, 0.2f);
@@ -103,10 +728,18 @@ void display(void) {
         glVertex2i(220, 360); glVertex2i(520, 360); glVertex2i(520, 400); glVertex2i(220, 400);
         glEnd();
         glColor3f(1, 1, 1);
-        glRasterPos2i(320, 385);
         char starterMsg[18];
         sprintf(starterMsg, "%s Starts", starter == 0 ? "White" : "Black"); // To store the starter message in the starterMsg array
-        for (const char* p = starterMsg; *p; p++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *p);
+        drawText(GLUT_BITMAP_HELVETICA_18, 320, 385, starterMsg);
+
+        // Draw Opening Trainer button
+        glColor3f(0.5f, 0.2f, 0.5f);
+        glBegin(GL_QUADS);
+        glVertex2i(220, 420); glVertex2i(520, 420); glVertex2i(520, 460); glVertex2i(220, 460);
+        glEnd();
+        glColor3f(1, 1, 1);
+        const char* trainerMsg = trainerMode ? "Opening Trainer: On" : "Opening Trainer: Off";
+        drawText(GLUT_BITMAP_HELVETICA_18, 295, 445, trainerMsg);
 
         glutSwapBuffers();
         return;
@@ -128,126 +761,596 @@ void display(void) {
 
         // Credits text
         glColor3f(1, 1, 1);
-        glRasterPos2i(320, 300);
         const char* credits1 = "Ibrahim Mansour";
-        for (const char* p = credits1; *p; p++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *p);
-        glRasterPos2i(70, 350);
+        drawText(GLUT_BITMAP_HELVETICA_18, 320, 300, credits1);
         const char* credits1v = "HI! I am Ibrahim Mansour, the creator of this game.";
-        for (const char* p = credits1v; *p; p++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *p);
-        glRasterPos2i(70, 370);
+        drawText(GLUT_BITMAP_HELVETICA_12, 70, 350, credits1v);
         const char* credits2 = "This game was made in the process of developing a C project for my university course.";
-        for (const char* p = credits2; *p; p++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *p);
-        glRasterPos2i(70, 390);
+        drawText(GLUT_BITMAP_HELVETICA_12, 70, 370, credits2);
         const char* credits3 = "This game is made without using Cmake to make it easier and more like download and run.";
-        for (const char* p = credits3; *p; p++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *p);
-        glRasterPos2i(70, 410);
+        drawText(GLUT_BITMAP_HELVETICA_12, 70, 390, credits3);
         const char* credits4 = "Also this game had passed on different stages of development.";
-        for (const char* p = credits4; *p; p++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *p);
-        glRasterPos2i(70, 430);
+        drawText(GLUT_BITMAP_HELVETICA_12, 70, 410, credits4);
         const char* credits5 = "A Huge Shoutout to all my colleagues who helped in the early stages!";
-        for (const char* p = credits5; *p; p++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *p);
-        glRasterPos2i(70, 450);
+        drawText(GLUT_BITMAP_HELVETICA_12, 70, 430, credits5);
         const char* credits6 = "DISCLAIMER: If you are using this game for university projects please read the code carefully.";
-        for (const char* p = credits6; *p; p++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *p);
-        glRasterPos2i(300, 600);
+        drawText(GLUT_BITMAP_HELVETICA_12, 70, 450, credits6);
         const char* backMsg = "Click to go back";
-        for (const char* p = backMsg; *p; p++) glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *p);
+        drawText(GLUT_BITMAP_HELVETICA_18, 300, 600, backMsg);
 
         glutSwapBuffers();
         return;
     }
 
     glClear(GL_COLOR_BUFFER_BIT); // Clear the screen before drawing, so we start with a clean slate
+    drawBoard(dirty); // Squares, highlights and pieces (also the last move on its way) in a handful of draw calls
+    // Coordinates in the corners of the edge squares, in the color of the other squares so they stay readable
+    for (int k = 0; k < BOARD_SIZE; k++) {
+        char label[2] = { (char)('8' - k), '\0' };
+        glColor3f(k % 2 == 0 ? 0.5f : 0.95f, k % 2 == 0 ? 0.3f : 0.85f, k % 2 == 0 ? 0.1f : 0.7f);
+        drawText(GLUT_BITMAP_HELVETICA_10, 3, k * mainBoardView.squareSize + 12, label); // Rank on the left edge
+        label[0] = (char)('a' + k);
+        glColor3f(k % 2 == 0 ? 0.95f : 0.5f, k % 2 == 0 ? 0.85f : 0.3f, k % 2 == 0 ? 0.7f : 0.1f);
+        drawText(GLUT_BITMAP_HELVETICA_10, (k + 1) * mainBoardView.squareSize - 8, BOARD_SIZE * mainBoardView.squareSize - 4, label); // File on the bottom edge
+    }
+    if (explorerMode) drawExplorer(); // Database moves of this position on top of the board
+    glutSwapBuffers(); // Swap the front and back buffers (double buffering)
+}
+
+// ### Add a quad (two triangles) to the frame's vertex batch ###
+void renderQuad(float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, const unsigned char color[4]) {
+    if (renderCount + 6 > RENDER_MAX_VERTICES) return; // Never happens with one board, but never write past the batch either
+    const float corners[6][4] = { { x0, y0, u0, v0 }, { x1, y0, u1, v0 }, { x1, y1, u1, v1 },
+                                  { x0, y0, u0, v0 }, { x1, y1, u1, v1 }, { x0, y1, u0, v1 } };
+    for (int k = 0; k < 6; k++) {
+        T_Vertex* vertex = &renderVertices[renderCount++];
+        vertex->x = corners[k][0]; vertex->y = corners[k][1];
+        vertex->u = corners[k][2]; vertex->v = corners[k][3];
+        memcpy(&vertex->r, color, 4);
+    }
+}
 
-    // Loop through each square on the board (8x8 grid)
+// ### Add a rectangle outline as four quads, centred on the edges like a GL_LINE_LOOP of that width ###
+void renderOutline(float x0, float y0, float x1, float y1, float width, const unsigned char color[4]) {
+    float w = width / 2;
+    renderQuad(x0 - w, y0 - w, x1 + w, y0 + w, 0, 0, 0, 0, color); // Top
+    renderQuad(x0 - w, y1 - w, x1 + w, y1 + w, 0, 0, 0, 0, color); // Bottom
+    renderQuad(x0 - w, y0 + w, x0 + w, y1 - w, 0, 0, 0, 0, color); // Left
+    renderQuad(x1 - w, y0 + w, x1 + w, y1 - w, 0, 0, 0, 0, color); // Right
+}
+
+// ### Write the game screen into the vertex batch and upload it ###
+// Squares and highlights come first (renderColoredCount vertices); without the instanced shader the pieces follow,
+// the animated ones last, so the batch is rebuilt every animation frame in that case
+void buildBoardBatch(void) {
+    static const unsigned char light[4] = { 242, 217, 179, 255 }, dark[4] = { 128, 77, 26, 255 };
+    static const unsigned char selected[4] = { 204, 204, 51, 255 }, book[4] = { 51, 102, 230, 255 };
+    static const unsigned char available[4] = { 51, 204, 51, 102 }, white[4] = { 255, 255, 255, 255 }; // Green with some transparency
+    float size = mainBoardView.squareSize;
+    int (*pieces)[8] = animating ? animationBoard : board; // Sliding pieces are drawn on their own
+    renderCount = 0;
+
+    // Squares, then on top of each square its outlines and the move highlight, in the order they used to be drawn
     for (int i = 0; i < BOARD_SIZE; i++) {
         for (int j = 0; j < BOARD_SIZE; j++) {
-            // Set color for the square (alternating light/dark)
-            glColor3f((i + j) % 2 == 0 ? 0.95f : 0.5f, (i + j) % 2 == 0 ? 0.85f : 0.3f, (i + j) % 2 == 0 ? 0.7f : 0.1f);// if the square (i+j%2==0) is even, use light color,(i+j%2!=0) else dark color
-            glBegin(GL_QUADS); // Draw the square, to read 4 vertices in counter-clockwise order and connect them to form a square
-            // Define the four corners of the square starting from the bottmom left corner
-            // The coordinates are calculated based on the square size and position in the grid
-            glVertex2f(j * SQUARE_SIZE, i * SQUARE_SIZE);
-            glVertex2f((j + 1) * SQUARE_SIZE, i * SQUARE_SIZE);
-            glVertex2f((j + 1) * SQUARE_SIZE, (i + 1) * SQUARE_SIZE);
-            glVertex2f(j * SQUARE_SIZE, (i + 1) * SQUARE_SIZE);
-            glEnd();
-
-            // Highlight the selected square
-            if (i == selectedRow && j == selectedCol) { // Checks if the current square is selected or not
-                // If the square is selected, draw a yellow outline around it
-                glColor3f(0.8f, 0.8f, 0.2f); // Yellow highlight color setting
-                // Draw a line loop to create an outline to the selected square, starting from the bottom left corner and going counter-clockwise
-                glLineWidth(4); // Line width is set for 4px
-                glBegin(GL_LINE_LOOP);
-                glVertex2f(j * SQUARE_SIZE, i * SQUARE_SIZE);
-                glVertex2f((j + 1) * SQUARE_SIZE, i * SQUARE_SIZE);
-                glVertex2f((j + 1) * SQUARE_SIZE, (i + 1) * SQUARE_SIZE);
-                glVertex2f(j * SQUARE_SIZE, (i + 1) * SQUARE_SIZE);
-                glEnd();
-            }
-
-            // Highlight available moves
-            if (availableMoves[i][j]) { // When glutDisplayFunc() refreshes we check if there is a true value in a spicific square if the value of it is set to true that means that it was changed by updateAvailableMove() so we green the square
-                glColor4f(0.2f, 0.8f, 0.2f, 0.4f); // Green with some transparency
-                glBegin(GL_QUADS);
-                glVertex2f(j * SQUARE_SIZE, i * SQUARE_SIZE);
-                glVertex2f((j + 1) * SQUARE_SIZE, i * SQUARE_SIZE);
-                glVertex2f((j + 1) * SQUARE_SIZE, (i + 1) * SQUARE_SIZE);
-                glVertex2f(j * SQUARE_SIZE, (i + 1) * SQUARE_SIZE);
-                glEnd();
-            }
-
-            int val = board[i][j];           // Get the value at this square
-            int color = val / 10;            // Color: 0 for white, 1 for black
-            int piece = val % 10;            // Piece type (1=pawn, 2=king, etc.)
-            if (piece) {                     // If there is a piece
-                GLuint tex = 0;              // Intialize temporary texture to handle the piece texture ID
-                // Load the correct texture based on the piece type and color
-                // Select the correct texture based on color and piece type
-                if (color == 0) { // The square has a white piece
-                    // White pieces: 1=pawn, 2=king, 3=queen, 4=rook, 5=bishop, 6=knight
-                    if (piece == 1) tex = whitePawnTex;
-                    else if (piece == 2) tex = whiteKingTex;
-                    else if (piece == 3) tex = whiteQueenTex;
-                    else if (piece == 4) tex = whiteRookTex;
-                    else if (piece == 5) tex = whiteBishopTex;
-                    else if (piece == 6) tex = whiteKnightTex;
-                } else { // The square has a black pieace
-                    // Black pieces: 1=pawn, 2=king, 3=queen, 4=rook, 5=bishop, 6=knight
-                    if (piece == 1) tex = blackPawnTex;
-                    else if (piece == 2) tex = blackKingTex;
-                    else if (piece == 3) tex = blackQueenTex;
-                    else if (piece == 4) tex = blackRookTex;
-                    else if (piece == 5) tex = blackBishopTex;
-                    else if (piece == 6) tex = blackKnightTex;
-                }
-                if (tex) {                   // If a texture is found so it is not 0
-                    // Draw the piece using the texture
-                    glEnable(GL_TEXTURE_2D); // Enable 2D texturing
-                    glBindTexture(GL_TEXTURE_2D, tex); // Bind the texture, so OpenGL knows which texture to use
-                    // Set color to white (no tint), so the texture color is used as is
-                    glColor3f(1, 1, 1);      // Set color to white (no tint), ensuring the texture’s original colors are shown
-                    float x0 = j * SQUARE_SIZE, y0 = i * SQUARE_SIZE;//Calculates the bottom-left corner of the square on the board
-                    float x1 = x0 + SQUARE_SIZE, y1 = y0 + SQUARE_SIZE;//Calculates the top-right corner of the squareon the board
-                    // Draw the textured square (the piece)
-                    // The texture coordinates (0,0) to (1,1) map the entire texture to the square
-                    glBegin(GL_QUADS);       // Draw the textured quad
-                    // glTexCoord2f sets the texture coordinates for each vertex
-                    // glVertex2f sets the vertex position in the square
-                    // The texture coordinates map the entire texture to the square
-                    glTexCoord2f(0, 0); glVertex2f(x0, y0); // Maps the texture’s bottom-left to the square’s bottom-left
-                    glTexCoord2f(1, 0); glVertex2f(x1, y0); // Maps the texture’s bottom-right to the square’s bottom-right
-                    glTexCoord2f(1, 1); glVertex2f(x1, y1); // Maps the texture’s top-right to the square’s top-right
-                    glTexCoord2f(0, 1); glVertex2f(x0, y1); // Maps the texture’s top-left to the square’s top-left
-                    // The vertices are defined in counter-clockwise order to ensure correct texture mapping
-                    glEnd();
-                    glDisable(GL_TEXTURE_2D); // Disable texturing for next draw
+            float x0 = j * size, y0 = i * size, x1 = x0 + size, y1 = y0 + size;
+            renderQuad(x0, y0, x1, y1, 0, 0, 0, 0, (i + j) % 2 == 0 ? light : dark);
+            if (i == selectedRow && j == selectedCol) renderOutline(x0, y0, x1, y1, 4, selected); // Yellow outline on the selected square
+            for (int k = 0; k < bookHintCount; k++) // Opening trainer: blue outline on the squares of every book move
+                if ((bookHints[k].fromRow == i && bookHints[k].fromCol == j) || (bookHints[k].toRow == i && bookHints[k].toCol == j)) {
+                    renderOutline(x0 + 3, y0 + 3, x1 - 3, y1 - 3, 3, book);
+                    break;
                 }
+            if (availableMoves[i][j]) renderQuad(x0, y0, x1, y1, 0, 0, 0, 0, available);
+        }
+    }
+    renderColoredCount = renderCount;
+
+    // Without the instanced shader every piece takes its own rectangle of the atlas in the batch
+    for (int sq = 0; sq < 64 && !pieceProgram; sq++) {
+        const T_AtlasRect* rect = &pieceAtlasRects[pieces[sq / 8][sq % 8]];
+        if (rect->u1 == 0) continue; // Empty square, or the image could not be loaded
+        float x0 = (sq % 8) * size, y0 = (sq / 8) * size;
+        renderQuad(x0, y0, x0 + size, y0 + size, rect->u0, rect->v0, rect->u1, rect->v1, white);
+    }
+    T_PieceInstance moving[PIECE_EXTRA_INSTANCES];
+    for (int i = 0, count = pieceProgram ? 0 : animatedPieces(moving); i < count; i++) {
+        int atlas = (int)moving[i].atlas;
+        const T_AtlasRect* rect = &pieceAtlasRects[(atlas / 6) * 10 + atlas % 6 + 1];
+        unsigned char color[4] = { 255, 255, 255, (unsigned char)(moving[i].alpha * 255) };
+        float x0 = moving[i].col * size, y0 = moving[i].row * size;
+        renderQuad(x0, y0, x0 + size, y0 + size, rect->u0, rect->v0, rect->u1, rect->v1, color);
+    }
+
+    if (!boardBuffer) glGenBuffers(1, &boardBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, boardBuffer);
+    glBufferData(GL_ARRAY_BUFFER, renderCount * sizeof(T_Vertex), renderVertices, GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    batchesBuilt++;
+}
+
+// ### Draw the game screen from one vertex buffer: squares and highlights in one call, all pieces from the atlas in another ###
+// The pieces are instanced when the shader is available, batched with the squares otherwise.
+// The batch is only rebuilt when dirty says the board, the selection or the highlights changed; otherwise the buffer is drawn as it is.
+void drawBoard(unsigned int dirty) {
+    if ((dirty & DIRTY_BATCH) || !boardBuffer || (animating && !pieceProgram)) buildBoardBatch();
+    glBindBuffer(GL_ARRAY_BUFFER, boardBuffer);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(T_Vertex), (void*)offsetof(T_Vertex, x));
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(T_Vertex), (void*)offsetof(T_Vertex, r));
+    glDrawArrays(GL_TRIANGLES, 0, renderColoredCount);
+
+    if (renderCount > renderColoredCount) {
+        glEnable(GL_TEXTURE_2D);
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+        glTexCoordPointer(2, GL_FLOAT, sizeof(T_Vertex), (void*)offsetof(T_Vertex, u));
+        glBindTexture(GL_TEXTURE_2D, pieceAtlasTex);
+        glDrawArrays(GL_TRIANGLES, renderColoredCount, renderCount - renderColoredCount);
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        glDisable(GL_TEXTURE_2D);
+    }
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    if (pieceProgram) { // Rebuilds its instances by itself when the board changed, the animated pieces go after them
+        T_PieceInstance moving[PIECE_EXTRA_INSTANCES];
+        int movingCount = animatedPieces(moving);
+        drawPiecesInstanced(&mainBoardView, animating ? animationBoard : board, moving, movingCount);
+    }
+}
+
+// ### Note what changed on screen and ask GLUT for one frame (several changes before it is drawn share that frame) ###
+void markDirty(unsigned int flags) {
+    if (!flags) return;
+    if (flags & DIRTY_BOARD) animating = false; // Anything that changes the board ends a running animation
+    dirtyFlags |= flags;
+    glutPostRedisplay();
+}
+
+// ### Display refresh interval in milliseconds, so animation frames come as often as the screen can show them ###
+int refreshIntervalMs(void) {
+    DEVMODE mode;
+    memset(&mode, 0, sizeof(mode));
+    mode.dmSize = sizeof(mode);
+    if (EnumDisplaySettings(NULL, ENUM_CURRENT_SETTINGS, &mode) && mode.dmDisplayFrequency > 1) // 0 and 1 mean "hardware default"
+        return 1000 / (int)mode.dmDisplayFrequency > 0 ? 1000 / (int)mode.dmDisplayFrequency : 1;
+    return 16; // About 60 Hz
+}
+
+// ### Start animating the move that turned before into the current board ###
+// The pieces of the moving side that left a square slide to the squares they arrived on (the king and rook when castling,
+// a pawn that promotes slides as the new piece), and a captured piece fades out, also when it was taken en passant
+void startMoveAnimation(int before[8][8], int mover) {
+    int fromSquares[2], toSquares[2], fromCount = 0, toCount = 0;
+    fadePiece = 0;
+    for (int sq = 0; sq < 64; sq++) {
+        int was = before[sq / 8][sq % 8], now = board[sq / 8][sq % 8];
+        if (was == now) continue;
+        if (was && was / 10 == mover && fromCount < 2) fromSquares[fromCount++] = sq;
+        if (now && now / 10 == mover && toCount < 2) toSquares[toCount++] = sq;
+        if (was && was / 10 != mover) { fadePiece = was; fadeRow = sq / 8; fadeCol = sq % 8; }
+    }
+    if (fromCount != toCount) return; // Not a single move, nothing to animate
+    memcpy(animationBoard, board, sizeof(animationBoard));
+    slideCount = 0;
+    for (int i = 0; i < toCount; i++) {
+        int to = toSquares[i], from = fromSquares[0];
+        for (int k = 0; k < fromCount; k++) // The same piece where there is one, otherwise the promoted pawn
+            if (fromSquares[k] >= 0 && before[fromSquares[k] / 8][fromSquares[k] % 8] == board[to / 8][to % 8]) from = fromSquares[k];
+        if (from < 0) for (int k = 0; k < fromCount; k++) if (fromSquares[k] >= 0) from = fromSquares[k];
+        for (int k = 0; k < fromCount; k++) if (fromSquares[k] == from) fromSquares[k] = -1; // Every square starts one slide only
+        T_Slide* slide = &slides[slideCount++];
+        slide->piece = board[to / 8][to % 8];
+        slide->fromRow = from / 8; slide->fromCol = from % 8;
+        slide->toRow = to / 8; slide->toCol = to % 8;
+        animationBoard[to / 8][to % 8] = 0; // Drawn from animatedPieces until it arrives
+    }
+    animating = true;
+    animationElapsed = 0;
+    lastAnimationFrame = elapsedMs();
+    markDirty(DIRTY_ANIMATION); // The move already marked the board, so the batch is built without the sliding pieces
+    glutTimerFunc(frameIntervalMs, animationFrame, ++animationId);
+}
+
+// ### Timer callback: advance the running animation by the time since the last frame, and ask for the next frame ###
+// A late frame moves the animation on by at most ANIMATION_MAX_STEP_MS. Once the pieces have arrived no more timers are set,
+// so a board where nothing moves costs no frames at all.
+void animationFrame(int id) {
+    if (!animating || id != animationId) return; // Stopped, or a newer animation has its own timer
+    double now = elapsedMs(), step = now - lastAnimationFrame;
+    lastAnimationFrame = now;
+    animationElapsed += step < ANIMATION_MAX_STEP_MS ? step : ANIMATION_MAX_STEP_MS;
+    if (animationElapsed >= ANIMATION_MS) {
+        markDirty(DIRTY_BOARD); // Also ends the animation, the pieces are back in the board batch
+        return;
+    }
+    markDirty(DIRTY_ANIMATION);
+    int delay = frameIntervalMs - (int)(elapsedMs() - now); // Keep the pace even when this frame took a while
+    glutTimerFunc(delay > 1 ? delay : 1, animationFrame, id);
+}
+
+// ### Where the pieces of the running animation are now, the captured piece first so it fades out under the one taking it ###
+int animatedPieces(T_PieceInstance out[]) {
+    if (!animating) return 0;
+    float t = (float)(animationElapsed / ANIMATION_MS);
+    float eased = t * t * (3 - 2 * t); // Starts and stops gently
+    int count = 0;
+    if (fadePiece && pieceAtlasRects[fadePiece].u1 != 0) {
+        T_PieceInstance* piece = &out[count++];
+        piece->col = (float)fadeCol; piece->row = (float)fadeRow;
+        piece->atlas = (float)((fadePiece / 10) * 6 + fadePiece % 10 - 1);
+        piece->alpha = 1 - t;
+    }
+    for (int i = 0; i < slideCount; i++) {
+        const T_Slide* slide = &slides[i];
+        if (pieceAtlasRects[slide->piece].u1 == 0) continue; // The image could not be loaded
+        T_PieceInstance* piece = &out[count++];
+        piece->col = slide->fromCol + (slide->toCol - slide->fromCol) * eased;
+        piece->row = slide->fromRow + (slide->toRow - slide->fromRow) * eased;
+        piece->atlas = (float)((slide->piece / 10) * 6 + slide->piece % 10 - 1);
+        piece->alpha = 1;
+    }
+    return count;
+}
+
+// ### Print how many frames were drawn and how often the board batch had to be rebuilt ###
+void printRenderStats(void) {
+    printf("Frames drawn: %d, board batch rebuilt %d times\n", framesDrawn, batchesBuilt);
+}
+
+// ### Pack the twelve piece images into one atlas texture ###
+// The pixels come from the loading images, in assetFiles order, halved first as often as the squares on screen allow. Pieces of one color share a row, in piece code order. Each cell has a border that repeats the image's edge pixels,
+// so linear filtering never pulls in a neighbouring piece.
+GLuint buildPieceAtlas(const T_LoadingImage pieces[], int halvings) {
+    const unsigned char* images[2][6];
+    unsigned char* shrunk[2][6] = { { NULL } }; // Smaller copies, when the squares are much smaller than the images
+    int widths[2][6], heights[2][6], cellWidth = 1, cellHeight = 1;
+    for (int color = 0; color < 2; color++)
+        for (int piece = 0; piece < 6; piece++) {
+            const T_LoadingImage* image = &pieces[color * 6 + piece]; // Same order as assetFiles
+            images[color][piece] = image->pixels;
+            widths[color][piece] = image->width;
+            heights[color][piece] = image->height;
+            if (!image->pixels) continue; // Missing file, that piece stays invisible
+            for (int k = 0; k < halvings; k++) {
+                int w = widths[color][piece], h = heights[color][piece];
+                unsigned char* smaller = malloc((size_t)(w > 1 ? w / 2 : 1) * (h > 1 ? h / 2 : 1) * 4);
+                downsampleImage(images[color][piece], w, h, smaller);
+                free(shrunk[color][piece]);
+                images[color][piece] = shrunk[color][piece] = smaller;
+                widths[color][piece] = w > 1 ? w / 2 : 1;
+                heights[color][piece] = h > 1 ? h / 2 : 1;
             }
+            if (widths[color][piece] > cellWidth) cellWidth = widths[color][piece];
+            if (heights[color][piece] > cellHeight) cellHeight = heights[color][piece];
+        }
+    cellWidth += 2 * ATLAS_PADDING;
+    cellHeight += 2 * ATLAS_PADDING;
+    int atlasWidth = 6 * cellWidth, atlasHeight = 2 * cellHeight;
+    unsigned char* atlas = calloc((size_t)atlasWidth * atlasHeight, 4); // Unused space stays transparent
+
+    memset(pieceAtlasRects, 0, sizeof(pieceAtlasRects));
+    for (int color = 0; color < 2; color++)
+        for (int piece = 0; piece < 6; piece++) {
+            const unsigned char* image = images[color][piece];
+            if (!image) continue;
+            int w = widths[color][piece], h = heights[color][piece];
+            int left = piece * cellWidth + ATLAS_PADDING, top = color * cellHeight + ATLAS_PADDING;
+            for (int y = -ATLAS_PADDING; y < h + ATLAS_PADDING; y++)
+                for (int x = -ATLAS_PADDING; x < w + ATLAS_PADDING; x++) {
+                    int sx = x < 0 ? 0 : x >= w ? w - 1 : x, sy = y < 0 ? 0 : y >= h ? h - 1 : y; // Clamp into the image for the border
+                    memcpy(&atlas[((size_t)(top + y) * atlasWidth + left + x) * 4], &image[((size_t)sy * w + sx) * 4], 4);
+                }
+            T_AtlasRect* rect = &pieceAtlasRects[color * 10 + piece + 1];
+            rect->u0 = (float)left / atlasWidth;
+            rect->v0 = (float)top / atlasHeight;
+            rect->u1 = (float)(left + w) / atlasWidth;
+            rect->v1 = (float)(top + h) / atlasHeight;
+            free(shrunk[color][piece]);
         }
+
+    GLuint tex;
+    glGenTextures(1, &tex);
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, atlasWidth, atlasHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, atlas);
+    generateMipmaps(); // The padding keeps the first levels from bleeding into the neighbours
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    free(atlas);
+    return tex;
+}
+
+// ### Compile one shader stage, printing the driver's log if it fails ###
+GLuint compileShader(GLenum type, const char* source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    GLint ok;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (!ok) {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        printf("Shader compile failed: %s\n", log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+// ### Build the instanced piece shader and the static quad every piece instance is drawn from ###
+// Needs OpenGL 3.3 (instanced arrays); without it pieceProgram stays 0 and drawBoard batches the pieces instead
+void initPieceRenderer(void) {
+    static const char* vertexSource =
+        "#version 130\n"
+        "in vec2 corner;\n"            // Corner of the unit quad, 0 or 1 on each axis
+        "in vec4 instance;\n"          // Column and row in squares, atlas index and opacity of one piece (T_PieceInstance)
+        "uniform vec4 atlasRects[12];\n"
+        "uniform vec3 boardOrigin;\n"  // Top left corner of the board and the square size, in pixels
+        "out vec2 uv;\n"
+        "out float alpha;\n"
+        "void main() {\n"
+        "    vec4 rect = atlasRects[int(instance.z)];\n"
+        "    uv = mix(rect.xy, rect.zw, corner);\n"
+        "    alpha = instance.w;\n"
+        "    gl_Position = gl_ModelViewProjectionMatrix * vec4(boardOrigin.xy + (instance.xy + corner) * boardOrigin.z, 0.0, 1.0);\n"
+        "}\n";
+    static const char* fragmentSource =
+        "#version 130\n"
+        "in vec2 uv;\n"
+        "in float alpha;\n"
+        "uniform sampler2D atlas;\n"
+        "void main() {\n"
+        "    gl_FragColor = texture2D(atlas, uv) * vec4(1.0, 1.0, 1.0, alpha);\n"
+        "}\n";
+    static const float quad[8] = { 0, 0, 1, 0, 0, 1, 1, 1 }; // Triangle strip
+    if (!GLEW_VERSION_3_3) { printf("OpenGL 3.3 not available, pieces are drawn without instancing.\n"); return; }
+
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexSource), fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentSource);
+    if (!vertexShader || !fragmentShader) return;
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glBindAttribLocation(program, 0, "corner");
+    glBindAttribLocation(program, 1, "instance");
+    glLinkProgram(program);
+    glDeleteShader(vertexShader); // Freed together with the program
+    glDeleteShader(fragmentShader);
+    GLint ok;
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok) {
+        char log[1024];
+        glGetProgramInfoLog(program, sizeof(log), NULL, log);
+        printf("Shader link failed: %s\n", log);
+        glDeleteProgram(program);
+        return;
+    }
+
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "atlas"), 0);
+    glUseProgram(0);
+    pieceOriginUniform = glGetUniformLocation(program, "boardOrigin");
+
+    glGenBuffers(1, &pieceQuadBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, pieceQuadBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    pieceProgram = program;
+    updatePieceAtlasUniforms();
+}
+
+// ### Give the shader the atlas rectangles of all pieces (atlas index = color * 6 + piece - 1) ###
+// Set once the atlas is built; they do not change after that
+void updatePieceAtlasUniforms(void) {
+    if (!pieceProgram) return;
+    float rects[12][4];
+    for (int i = 0; i < 12; i++) {
+        const T_AtlasRect* rect = &pieceAtlasRects[(i / 6) * 10 + i % 6 + 1];
+        rects[i][0] = rect->u0; rects[i][1] = rect->v0; rects[i][2] = rect->u1; rects[i][3] = rect->v1;
+    }
+    glUseProgram(pieceProgram);
+    glUniform4fv(glGetUniformLocation(pieceProgram, "atlasRects"), 12, &rects[0][0]);
+    glUseProgram(0);
+}
+
+// ### Draw the pieces of a board with one instanced call, plus up to PIECE_EXTRA_INSTANCES pieces anywhere on it (animations) ###
+// The board's instances are only rebuilt when the board differs from the one they were built from; the extra ones follow them
+void drawPiecesInstanced(T_BoardView* view, int board[8][8], const T_PieceInstance extra[], int extraCount) {
+    if (!view->vertexArray) { // First use: the quad and the instance buffer stay bound to the view's vertex array
+        glGenVertexArrays(1, &view->vertexArray);
+        glGenBuffers(1, &view->instanceBuffer);
+        glBindVertexArray(view->vertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, pieceQuadBuffer);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, NULL);
+        glBindBuffer(GL_ARRAY_BUFFER, view->instanceBuffer);
+        glBufferData(GL_ARRAY_BUFFER, (64 + PIECE_EXTRA_INSTANCES) * sizeof(T_PieceInstance), NULL, GL_DYNAMIC_DRAW); // Room for a full board and the extras
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(T_PieceInstance), NULL);
+        glVertexAttribDivisor(1, 1); // One instance per piece, not per corner
+        glBindVertexArray(0);
+        view->instanceCount = -1; // Force the first upload
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, view->instanceBuffer);
+    if (view->instanceCount < 0 || memcmp(view->lastBoard, board, sizeof(view->lastBoard)) != 0) {
+        T_PieceInstance instances[64];
+        int count = 0;
+        for (int sq = 0; sq < 64; sq++) {
+            int val = board[sq / 8][sq % 8];
+            if (!val || pieceAtlasRects[val].u1 == 0) continue; // Empty, or the image could not be loaded
+            T_PieceInstance* piece = &instances[count++];
+            piece->col = (float)(sq % 8); piece->row = (float)(sq / 8);
+            piece->atlas = (float)((val / 10) * 6 + val % 10 - 1);
+            piece->alpha = 1;
+        }
+        glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(T_PieceInstance), instances);
+        memcpy(view->lastBoard, board, sizeof(view->lastBoard));
+        view->instanceCount = count;
+    }
+    if (extraCount > PIECE_EXTRA_INSTANCES) extraCount = PIECE_EXTRA_INSTANCES;
+    if (extraCount) glBufferSubData(GL_ARRAY_BUFFER, view->instanceCount * sizeof(T_PieceInstance), extraCount * sizeof(T_PieceInstance), extra);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    if (!view->instanceCount && !extraCount) return;
+    glUseProgram(pieceProgram);
+    glUniform3f(pieceOriginUniform, view->x, view->y, view->squareSize);
+    glBindTexture(GL_TEXTURE_2D, pieceAtlasTex);
+    glBindVertexArray(view->vertexArray);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, view->instanceCount + extraCount);
+    glBindVertexArray(0);
+    glUseProgram(0);
+}
+
+// ### Rasterise one GLUT bitmap font into an atlas texture, one cell per character, by drawing it into a framebuffer object ###
+bool buildFontAtlas(T_Font* font, void* glutFont) {
+    int height = glutBitmapHeight(glutFont), widest = 1;
+    for (int c = 0; c < TEXT_CHARS; c++) {
+        font->advance[c] = (unsigned char)glutBitmapWidth(glutFont, TEXT_FIRST_CHAR + c);
+        if (font->advance[c] > widest) widest = font->advance[c];
+    }
+    font->glutFont = glutFont;
+    font->cellWidth = widest + 2 * TEXT_PADDING;
+    font->cellHeight = height + 2 * TEXT_PADDING;
+    font->descent = height / 3 + TEXT_PADDING; // Room below the baseline for g, j, p, q, y
+    font->atlasWidth = 16 * font->cellWidth;
+    font->atlasHeight = (TEXT_CHARS / 16) * font->cellHeight;
+
+    glGenTextures(1, &font->texture);
+    glBindTexture(GL_TEXTURE_2D, font->texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, font->atlasWidth, font->atlasHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST); // Glyphs are drawn 1:1, so texels land exactly on pixels
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    GLuint framebuffer;
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, font->texture, 0);
+    bool ok = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    if (ok) {
+        // Pixel coordinates with y up, so a texel row is a framebuffer row; glyphs are white, everything else transparent
+        glPushAttrib(GL_VIEWPORT_BIT | GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_CURRENT_BIT);
+        glMatrixMode(GL_PROJECTION); glPushMatrix(); glLoadIdentity(); gluOrtho2D(0, font->atlasWidth, 0, font->atlasHeight);
+        glMatrixMode(GL_MODELVIEW); glPushMatrix(); glLoadIdentity();
+        glViewport(0, 0, font->atlasWidth, font->atlasHeight);
+        glDisable(GL_BLEND);
+        glClearColor(0, 0, 0, 0);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glColor4f(1, 1, 1, 1);
+        for (int c = 0; c < TEXT_CHARS; c++) {
+            glRasterPos2i((c % 16) * font->cellWidth + TEXT_PADDING, (c / 16) * font->cellHeight + font->descent);
+            glutBitmapCharacter(glutFont, TEXT_FIRST_CHAR + c);
+        }
+        glMatrixMode(GL_PROJECTION); glPopMatrix();
+        glMatrixMode(GL_MODELVIEW); glPopMatrix();
+        glPopAttrib();
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f); // Back to the window's black background
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &framebuffer);
+    if (!ok) { glDeleteTextures(1, &font->texture); font->texture = 0; }
+    return ok;
+}
+
+// ### Rasterise the fonts the screens use, once at startup ###
+// Needs framebuffer objects (OpenGL 3.0); without them drawText falls back to glutBitmapCharacter
+void initTextRenderer(void) {
+    void* fonts[TEXT_FONTS] = { GLUT_BITMAP_HELVETICA_10, GLUT_BITMAP_HELVETICA_12, GLUT_BITMAP_HELVETICA_18 };
+    if (!GLEW_VERSION_3_0) return;
+    for (int i = 0; i < TEXT_FONTS; i++)
+        if (buildFontAtlas(&textFonts[textFontCount], fonts[i])) textFontCount++;
+}
+
+// ### Draw a string with its baseline starting at (x, y) in the current color, like glRasterPos2i + glutBitmapCharacter ###
+// Every label is kept as a ready vertex buffer, so drawing it again is a single draw call
+void drawText(void* glutFont, int x, int y, const char* text) {
+    const T_Font* font = NULL;
+    for (int i = 0; i < textFontCount; i++) if (textFonts[i].glutFont == glutFont) font = &textFonts[i];
+    if (!font || strlen(text) >= TEXT_MAX) { // No atlas for this font, or a label too long to cache
+        glRasterPos2i(x, y);
+        for (const char* p = text; *p; p++) glutBitmapCharacter(glutFont, *p);
+        return;
+    }
+
+    // Find the label in the cache, or replace the one that was used longest ago
+    T_TextRun* run = NULL;
+    for (int i = 0; i < TEXT_CACHE_SIZE && !run; i++)
+        if (textCache[i].glutFont == glutFont && textCache[i].x == x && textCache[i].y == y && strcmp(textCache[i].text, text) == 0)
+            run = &textCache[i];
+    if (!run) {
+        run = &textCache[0];
+        for (int i = 1; i < TEXT_CACHE_SIZE; i++) if (textCache[i].lastUsed < run->lastUsed) run = &textCache[i];
+        static const unsigned char white[4] = { 255, 255, 255, 255 };
+        int saved = renderCount; // Build the quads at the end of the vertex batch, then give the space back
+        float pen = (float)x;
+        for (const char* p = text; *p; p++) {
+            int c = (unsigned char)*p - TEXT_FIRST_CHAR;
+            if (c < 0 || c >= TEXT_CHARS) c = '?' - TEXT_FIRST_CHAR;
+            float u0 = (float)((c % 16) * font->cellWidth) / font->atlasWidth, u1 = u0 + (float)font->cellWidth / font->atlasWidth;
+            float v0 = (float)((c / 16) * font->cellHeight) / font->atlasHeight, v1 = v0 + (float)font->cellHeight / font->atlasHeight;
+            float left = pen - TEXT_PADDING, bottom = (float)(y + font->descent); // The atlas is upside down compared to the screen
+            renderQuad(left, bottom - font->cellHeight, left + font->cellWidth, bottom, u0, v1, u1, v0, white);
+            pen += font->advance[c];
+        }
+        if (!run->buffer) glGenBuffers(1, &run->buffer);
+        glBindBuffer(GL_ARRAY_BUFFER, run->buffer);
+        glBufferData(GL_ARRAY_BUFFER, (renderCount - saved) * sizeof(T_Vertex), &renderVertices[saved], GL_STATIC_DRAW);
+        run->vertexCount = renderCount - saved;
+        renderCount = saved;
+        run->glutFont = glutFont;
+        run->x = x;
+        run->y = y;
+        strcpy(run->text, text);
+    }
+    run->lastUsed = ++textClock;
+
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, font->texture);
+    glBindBuffer(GL_ARRAY_BUFFER, run->buffer);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(T_Vertex), (void*)offsetof(T_Vertex, x));
+    glTexCoordPointer(2, GL_FLOAT, sizeof(T_Vertex), (void*)offsetof(T_Vertex, u)); // No color array: the current color tints the glyphs
+    glDrawArrays(GL_TRIANGLES, 0, run->vertexCount);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glDisable(GL_TEXTURE_2D);
+}
+
+// ### Draw the explorer panel: every database move of the board position with its results ###
+void drawExplorer(void) {
+    const T_DbEntry* first = NULL;
+    int count = dbEntries ? databaseProbe(polyglotHash(board, currentPlayer), &first) : 0;
+    int lines = count < 10 ? count : 10; // The ten most played moves fit on the board
+    T_DbEntry top[10];
+    // Pick the most played moves (the entries are sorted by move, not by popularity)
+    for (int n = 0; n < lines; n++) {
+        int best = -1;
+        unsigned int bestGames = 0;
+        for (int k = 0; k < count; k++) {
+            bool taken = false;
+            for (int t = 0; t < n; t++) if (top[t].move == first[k].move) taken = true;
+            if (!taken && (best < 0 || first[k].games > bestGames)) { best = k; bestGames = first[k].games; }
+        }
+        top[n] = first[best];
+    }
+
+    // Dark see-through panel in the top right corner
+    glColor4f(0.0f, 0.0f, 0.0f, 0.75f);
+    glBegin(GL_QUADS);
+    glVertex2i(430, 10); glVertex2i(690, 10); glVertex2i(690, 40 + lines * 18); glVertex2i(430, 40 + lines * 18);
+    glEnd();
+    glColor3f(1, 1, 1);
+    const char* title = !dbEntries ? "No positions.db found" : count ? "Move   Games   White / Draw / Black" : "Position not in database";
+    drawText(GLUT_BITMAP_HELVETICA_12, 440, 28, title);
+    for (int n = 0; n < lines; n++) {
+        char san[SAN_MAX], line[64];
+        unsigned int decided = top[n].whiteWins + top[n].draws + top[n].blackWins; // Percentages only of games with a known result
+        moveToSAN(board, currentPlayer, decodeMove(top[n].move), san);
+        if (decided) sprintf(line, "%-6s %6u   %3u%% / %3u%% / %3u%%", san, top[n].games,
+                             (unsigned)(100ULL * top[n].whiteWins / decided), (unsigned)(100ULL * top[n].draws / decided), (unsigned)(100ULL * top[n].blackWins / decided));
+        else sprintf(line, "%-6s %6u   no results", san, top[n].games);
+        drawText(GLUT_BITMAP_HELVETICA_12, 440, 48 + n * 18, line);
     }
-    glutSwapBuffers(); // Swap the front and back buffers (double buffering)
 }
 
 // ### Check if the current player's king is under attack ###
@@ -291,10 +1394,12 @@ bool isLegalMove(int board[8][8], int fromRow, int fromCol, int toRow, int toCol
                 if (fromRow == 1 && dr == 2 && dc == 0 && board[fromRow+1][fromCol] == 0 && target == 0) return true; // Double move from start
                 if (dr == 1 && dc == 0 && target == 0) return true; // Forward
                 if (dr == 1 && abs(dc) == 1 && target && targetColor == 0) return true; // Capture
+                if (dr == 1 && abs(dc) == 1 && !target && fromRow == 4 && toCol == enPassantCol && board[4][toCol] == 1) return true; // En passant
             } else { // White
                 if (fromRow == 6 && dr == -2 && dc == 0 && board[fromRow-1][fromCol] == 0 && target == 0) return true; // Double move from start
                 if (dr == -1 && dc == 0 && target == 0) return true; // Forward
                 if (dr == -1 && abs(dc) == 1 && target && targetColor == 1) return true; // Capture
+                if (dr == -1 && abs(dc) == 1 && !target && fromRow == 3 && toCol == enPassantCol && board[3][toCol] == 11) return true; // En passant
             }
             break;
         case 2: // King
@@ -311,10 +1416,12 @@ bool isLegalMove(int board[8][8], int fromRow, int fromCol, int toRow, int toCol
                     // Check e1 (7,4), f1 (7,5), g1 (7,6)
                     int squares[3][2] = { {7,4}, {7,5}, {7,6} };
                     for (int k = 0; k < 3; ++k) {
+                        board[fromRow][fromCol] = 0; // Lift the king off its square so isInCheck only finds the tested one
                         int backup = board[squares[k][0]][squares[k][1]];
                         board[squares[k][0]][squares[k][1]] = 2; // Temporarily place king
                         if (isInCheck(board, color)) safe = false;
                         board[squares[k][0]][squares[k][1]] = backup;
+                        board[fromRow][fromCol] = val; // Put the king back
                         if (!safe) break;
                     }
                     if (safe) return true;
@@ -326,10 +1433,12 @@ bool isLegalMove(int board[8][8], int fromRow, int fromCol, int toRow, int toCol
                     bool safe = true;
                     int squares[3][2] = { {7,4}, {7,3}, {7,2} };
                     for (int k = 0; k < 3; ++k) {
+                        board[fromRow][fromCol] = 0; // Lift the king off its square so isInCheck only finds the tested one
                         int backup = board[squares[k][0]][squares[k][1]];
                         board[squares[k][0]][squares[k][1]] = 2;
                         if (isInCheck(board, color)) safe = false;
                         board[squares[k][0]][squares[k][1]] = backup;
+                        board[fromRow][fromCol] = val; // Put the king back
                         if (!safe) break;
                     }
                     if (safe) return true;
@@ -343,10 +1452,12 @@ bool isLegalMove(int board[8][8], int fromRow, int fromCol, int toRow, int toCol
                     bool safe = true;
                     int squares[3][2] = { {0,4}, {0,5}, {0,6} };
                     for (int k = 0; k < 3; ++k) {
+                        board[fromRow][fromCol] = 0; // Lift the king off its square so isInCheck only finds the tested one
                         int backup = board[squares[k][0]][squares[k][1]];
                         board[squares[k][0]][squares[k][1]] = 12;
                         if (isInCheck(board, color)) safe = false;
                         board[squares[k][0]][squares[k][1]] = backup;
+                        board[fromRow][fromCol] = val; // Put the king back
                         if (!safe) break;
                     }
                     if (safe) return true;
@@ -358,10 +1469,12 @@ bool isLegalMove(int board[8][8], int fromRow, int fromCol, int toRow, int toCol
                     bool safe = true;
                     int squares[3][2] = { {0,4}, {0,3}, {0,2} };
                     for (int k = 0; k < 3; ++k) {
+                        board[fromRow][fromCol] = 0; // Lift the king off its square so isInCheck only finds the tested one
                         int backup = board[squares[k][0]][squares[k][1]];
                         board[squares[k][0]][squares[k][1]] = 12;
                         if (isInCheck(board, color)) safe = false;
                         board[squares[k][0]][squares[k][1]] = backup;
+                        board[fromRow][fromCol] = val; // Put the king back
                         if (!safe) break;
                     }
                     if (safe) return true;
@@ -441,8 +1554,161 @@ bool isCheckmate(int board[8][8], int player) {
     return true; // No legal moves to escape check
 }
 
+// ### Make a move on a board: handles castling, en passant and promotion ###
+// Only the board changes; castling rights, counters and the turn are handled by playMove
+void makeMove(int board[8][8], T_Move move) {
+    int movedPiece = board[move.fromRow][move.fromCol], color = movedPiece / 10, piece = movedPiece % 10;
+    // A pawn moving diagonally onto an empty square captures en passant, so remove the pawn it passed
+    if (piece == 1 && move.fromCol != move.toCol && board[move.toRow][move.toCol] == 0)
+        board[move.fromRow][move.toCol] = 0;
+    board[move.toRow][move.toCol] = movedPiece;
+    board[move.fromRow][move.fromCol] = 0;
+    // A king moving two squares is castling, so bring the rook to the other side of it
+    if (piece == 2 && abs(move.toCol - move.fromCol) == 2) {
+        int rookFrom = move.toCol == 6 ? 7 : 0, rookTo = move.toCol == 6 ? 5 : 3;
+        board[move.toRow][rookTo] = board[move.toRow][rookFrom];
+        board[move.toRow][rookFrom] = 0;
+    }
+    // Pawn promotion, to a queen unless the move asks for another piece
+    if (piece == 1 && (move.toRow == 0 || move.toRow == 7))
+        board[move.toRow][move.toCol] = color * 10 + (move.promotion ? move.promotion : 3);
+}
+
+// ### Play a move in the game: updates the board, castling rights, en passant column, counters and the turn ###
+void playMove(T_Move move) {
+    int movedPiece = board[move.fromRow][move.fromCol], piece = movedPiece % 10;
+    bool capture = board[move.toRow][move.toCol] != 0 || (piece == 1 && move.fromCol != move.toCol);
+
+    // Castling rights are lost when the king or a rook leaves its square, or when a rook is captured on it
+    if (movedPiece == 2) whiteKingMoved = true;
+    if (movedPiece == 12) blackKingMoved = true;
+    if ((move.fromRow == 7 && move.fromCol == 7) || (move.toRow == 7 && move.toCol == 7)) whiteKingsideRookMoved = true;
+    if ((move.fromRow == 7 && move.fromCol == 0) || (move.toRow == 7 && move.toCol == 0)) whiteQueensideRookMoved = true;
+    if ((move.fromRow == 0 && move.fromCol == 7) || (move.toRow == 0 && move.toCol == 7)) blackKingsideRookMoved = true;
+    if ((move.fromRow == 0 && move.fromCol == 0) || (move.toRow == 0 && move.toCol == 0)) blackQueensideRookMoved = true;
+
+    // Keep the FEN counters and en passant column up to date
+    halfmoveClock = (piece == 1 || capture) ? 0 : halfmoveClock + 1;
+    if (currentPlayer == 1) fullmoveNumber++;
+    enPassantCol = (piece == 1 && abs(move.toRow - move.fromRow) == 2) ? move.fromCol : -1;
+
+    makeMove(board, move);
+    currentPlayer = 1 - currentPlayer; // Switch player
+}
+
+// ### List the legal moves of a player ###
+// fromSquare and toSquare (row * 8 + col) limit the search to one piece or one target, -1 means any square.
+// A move is legal if the piece may make it and it does not leave the own king in check.
+// moves must have room for 256 moves when the whole board is searched.
+int generateLegalMoves(int board[8][8], int player, int fromSquare, int toSquare, T_Move moves[]) {
+    int count = 0;
+    for (int from = fromSquare < 0 ? 0 : fromSquare; from < (fromSquare < 0 ? 64 : fromSquare + 1); from++) {
+        int val = board[from / 8][from % 8];
+        if (!val || val / 10 != player) continue; // Only the player's own pieces
+        for (int to = toSquare < 0 ? 0 : toSquare; to < (toSquare < 0 ? 64 : toSquare + 1); to++) {
+            if (!isLegalMove(board, from / 8, from % 8, to / 8, to % 8, player)) continue;
+            T_Move move = { from / 8, from % 8, to / 8, to % 8, 0 };
+            int copy[8][8]; // Try the move on a copy so castling and en passant are simulated exactly
+            memcpy(copy, board, sizeof(copy));
+            makeMove(copy, move);
+            if (isInCheck(copy, player)) continue;
+            if (val % 10 == 1 && (to / 8 == 0 || to / 8 == 7)) // A promoting pawn gives one move per piece it can become
+                for (move.promotion = 3; move.promotion <= 6; move.promotion++)
+                    moves[count++] = move;
+            else moves[count++] = move;
+        }
+    }
+    return count;
+}
+
+// ### Reset everything to a new game from the initial position ###
+void newGame(void) {
+    boardInitializer(board);
+    whiteKingMoved = blackKingMoved = false;
+    whiteKingsideRookMoved = whiteQueensideRookMoved = false;
+    blackKingsideRookMoved = blackQueensideRookMoved = false;
+    currentPlayer = 0;
+    enPassantCol = -1;
+    halfmoveClock = 0;
+    fullmoveNumber = 1;
+}
+
+// ### Copy the whole game state (board, turn, castling rights, en passant, counters) ###
+void saveGameState(T_GameState* state) {
+    memcpy(state->board, board, sizeof(state->board));
+    state->currentPlayer = currentPlayer;
+    state->castling[0] = whiteKingMoved;
+    state->castling[1] = blackKingMoved;
+    state->castling[2] = whiteKingsideRookMoved;
+    state->castling[3] = whiteQueensideRookMoved;
+    state->castling[4] = blackKingsideRookMoved;
+    state->castling[5] = blackQueensideRookMoved;
+    state->enPassantCol = enPassantCol;
+    state->halfmoveClock = halfmoveClock;
+    state->fullmoveNumber = fullmoveNumber;
+}
+
+// ### Put back a game state copied by saveGameState ###
+void restoreGameState(const T_GameState* state) {
+    memcpy(board, state->board, sizeof(board));
+    currentPlayer = state->currentPlayer;
+    whiteKingMoved = state->castling[0];
+    blackKingMoved = state->castling[1];
+    whiteKingsideRookMoved = state->castling[2];
+    whiteQueensideRookMoved = state->castling[3];
+    blackKingsideRookMoved = state->castling[4];
+    blackQueensideRookMoved = state->castling[5];
+    enPassantCol = state->enPassantCol;
+    halfmoveClock = state->halfmoveClock;
+    fullmoveNumber = state->fullmoveNumber;
+}
+
+// ### Count the leaf positions of the move tree (perft), used to test the rules against known numbers ###
+long long perft(int depth) {
+    T_Move moves[256];
+    int count = generateLegalMoves(board, currentPlayer, -1, -1, moves);
+    if (depth <= 1) return depth == 1 ? count : 1;
+    long long nodes = 0;
+    T_GameState state;
+    saveGameState(&state);
+    for (int i = 0; i < count; i++) {
+        playMove(moves[i]);
+        nodes += perft(depth - 1);
+        restoreGameState(&state);
+    }
+    return nodes;
+}
+
+// ### Check if the position is a dead draw because nobody can mate ###
+bool isInsufficientMaterial(int board[8][8]) {
+    int minors[2] = {0, 0};        // Number of bishops and knights per color
+    int bishopSquareColor[2] = {-1, -1}; // Square color of the last bishop seen per side (-1 = none)
+    bool bishopsOnBothColors = false;    // True if the bishops stand on light and dark squares
+    for (int i = 0; i < 8; i++)
+        for (int j = 0; j < 8; j++) {
+            int val = board[i][j], color = val / 10, piece = val % 10;
+            if (piece == 1 || piece == 3 || piece == 4) return false; // A pawn, queen or rook can always mate
+            if (piece == 5 || piece == 6) minors[color]++;
+            if (piece == 5) {
+                for (int c = 0; c < 2; c++)
+                    if (bishopSquareColor[c] != -1 && bishopSquareColor[c] != (i + j) % 2)
+                        bishopsOnBothColors = true;
+                bishopSquareColor[color] = (i + j) % 2;
+            }
+        }
+    // King against king, or king and one minor piece against a bare king
+    if (minors[0] + minors[1] <= 1) return true;
+    // King and bishop against king and bishop with both bishops on the same square color
+    if (minors[0] == 1 && minors[1] == 1 && bishopSquareColor[0] != -1 && bishopSquareColor[1] != -1 && !bishopsOnBothColors)
+        return true;
+    return false;
+}
+
 // ### Handle mouse clicks for selecting and moving pieces ###
 void mouse(int button, int state, int x, int y) {
+    // From window pixels to the 700x700 layout everything is drawn in
+    x = (int)floor((x - viewportX) * (double)LOGICAL_SIZE / viewportSize);
+    y = (int)floor((y - viewportY) * (double)LOGICAL_SIZE / viewportSize);
     if (button == GLUT_LEFT_BUTTON && state == GLUT_DOWN) {
         // Next block will handle the menu buttons
         if (gameState == 0) {
@@ -450,41 +1716,51 @@ void mouse(int button, int state, int x, int y) {
 
             // HUSH!!
             if (inRect(x, y, 0, 0, 10, 10)) {
-                PlaySound("Fun.wav", NULL, SND_FILENAME | SND_ASYNC);
-                glutPostRedisplay();
+                PlaySound("Fun.wav", NULL, SND_FILENAME | SND_ASYNC); // Nothing on screen changes
                 return;
             }
             // Start Game button
             if (inRect(x, y, 220, 240, 300, 40)) {
                 currentPlayer = starter;
                 gameState = 1;
-                glutPostRedisplay();
+                recordStart(&guiGame); // Every game is recorded so it can be saved as PGN
+                guiGameSaved = false;
+                updateBookHints(); // Show the book moves of the starting position if the trainer is on
+                autosave();
+                markDirty(DIRTY_ALL);
                 return;
             }
             // Credits button
             if (inRect(x, y, 220, 300, 300, 40)) {
                 gameState = 2;
-                glutPostRedisplay();
+                markDirty(DIRTY_SCREEN);
                 return;
             }
             // Change Starter button
             if (inRect(x, y, 220, 360, 300, 40)) {
                 starter = 1 - starter;
-                glutPostRedisplay();
+                markDirty(DIRTY_SCREEN);
+                return;
+            }
+            // Opening Trainer button
+            if (inRect(x, y, 220, 420, 300, 40)) {
+                trainerMode = !trainerMode;
+                if (trainerMode && !bookData) printf("No opening book found (book.bin), the trainer has nothing to show.\n");
+                markDirty(DIRTY_SCREEN);
                 return;
             }
             // Next will handle the credits screen
         } else if (gameState == 2) {
             // Any click returns to menu
             gameState = 0;
-            glutPostRedisplay();
+            markDirty(DIRTY_SCREEN);
             return;
         }
     }
     // If we are in the game state, handle piece selection and movement
     if (gameState == 1) {
         if (button == GLUT_LEFT_BUTTON && state == GLUT_DOWN) { // Only on left click
-            int col = x / SQUARE_SIZE, row = y / SQUARE_SIZE; // Convert pixel to board coordinates
+            int col = (int)floorf(x / mainBoardView.squareSize), row = (int)floorf(y / mainBoardView.squareSize); // Convert pixel to board coordinates
             if (row >= 0 && row < 8 && col >= 0 && col < 8) {
                 if (selectedRow == -1) { // No piece selected yet
                     int val = board[row][col], color = val / 10; // Get the piece color at the clicked square
@@ -493,104 +1769,72 @@ void mouse(int button, int state, int x, int y) {
                         selectedRow = row;
                         selectedCol = col;
                         updateAvailableMoves(); // Update available moves for the selected piece
+                        markDirty(DIRTY_SELECTION);
                     }
                 } else { // Piece already selected, try to move
                     if (!(selectedRow == row && selectedCol == col)) { // If the clicked square is not the same as the selected square, attempt to move the selected piece to the clicked square
-                        if (isLegalMove(board, selectedRow, selectedCol, row, col, currentPlayer)) { // Check if the move is legal
-                            // Make the move if it is legal
-                            int backup = board[row][col]; // Backup the piece at the target square
+                        if (availableMoves[row][col]) { // updateAvailableMoves already checked the move and that it does not leave the king in check
+                            T_Move move = { selectedRow, selectedCol, row, col, 0 }; // Promotion 0 means queen, like it always was in the GUI
                             int movedPiece = board[selectedRow][selectedCol]; // Get the piece being moved
-                            board[row][col] = movedPiece; // Move the piece to the target square
-                            board[selectedRow][selectedCol] = 0; // Empty the starting square
-
-                            // ### Update castling rights for any king or rook move ###
-                            // White king moves from e1
-                            if (movedPiece == 2 && selectedRow == 7 && selectedCol == 4)
-                                whiteKingMoved = true;
-                            // Black king moves from e8
-                            if (movedPiece == 12 && selectedRow == 0 && selectedCol == 4)
-                                blackKingMoved = true;
-                            // White kingside rook moves from h1
-                            if (movedPiece == 4 && selectedRow == 7 && selectedCol == 7)
-                                whiteKingsideRookMoved = true;
-                            // White queenside rook moves from a1
-                            if (movedPiece == 4 && selectedRow == 7 && selectedCol == 0)
-                                whiteQueensideRookMoved = true;
-                            // Black kingside rook moves from h8
-                            if (movedPiece == 14 && selectedRow == 0 && selectedCol == 7)
-                                blackKingsideRookMoved = true;
-                            // Black queenside rook moves from a8
-                            if (movedPiece == 14 && selectedRow == 0 && selectedCol == 0)
-                                blackQueensideRookMoved = true;
-
-                            // ### Castling rook move logic ###
-                            if (movedPiece % 10 == 2 && !isInCheck(board,currentPlayer)) { // King
-                                // White kingside castling
-                                if (movedPiece == 2 && selectedRow == 7 && selectedCol == 4 && row == 7 && col == 6) {
-                                    board[7][5] = board[7][7]; // Move rook
-                                    board[7][7] = 0;
-                                }
-                                // White queenside castling
-                                if (movedPiece == 2 && selectedRow == 7 && selectedCol == 4 && row == 7 && col == 2) {
-                                    board[7][3] = board[7][0];
-                                    board[7][0] = 0;
-                                }
-                                // Black kingside castling
-                                if (movedPiece == 12 && selectedRow == 0 && selectedCol == 4 && row == 0 && col == 6) {
-                                    board[0][5] = board[0][7];
-                                    board[0][7] = 0;
-                                }
-                                // Black queenside castling
-                                if (movedPiece == 12 && selectedRow == 0 && selectedCol == 4 && row == 0 && col == 2) {
-                                    board[0][3] = board[0][0];
-                                    board[0][0] = 0;
-                                }
-
-                                // ### Update castling rights ###
-                                if (movedPiece == 2) whiteKingMoved = true;
-                                if (movedPiece == 12) blackKingMoved = true;
-                                if (movedPiece == 4 && selectedRow == 7 && selectedCol == 0) whiteQueensideRookMoved = true;
-                                if (movedPiece == 4 && selectedRow == 7 && selectedCol == 7) whiteKingsideRookMoved = true;
-                                if (movedPiece == 14 && selectedRow == 0 && selectedCol == 0) blackQueensideRookMoved = true;
-                                if (movedPiece == 14 && selectedRow == 0 && selectedCol == 7) blackKingsideRookMoved = true;
-                            }
-
-                           
-                            // ### Pawn Promotion ###
                             int piece = movedPiece % 10;
-                            int color = movedPiece / 10;
-                            if (piece == 1) { // If the moved piece is a pawn
-                                if ((color == 0 && row == 0) || (color == 1 && row == 7)) {
-                                    // Promote to queen (3)
-                                    board[row][col] = color * 10 + 3;
-                                    printf("Pawn promoted to Queen!\n");
-                                }
-                            }
+                            bool capture = board[row][col] != 0 || (piece == 1 && col != selectedCol); // A diagonal pawn move onto an empty square is en passant
+                            int before[8][8];
+                            memcpy(before, board, sizeof(before)); // For the animation
+                            T_Move replies[256]; // Legal moves of the opponent, to spot stalemate
+                            recordMove(&guiGame, move); // Move the piece and the castling rook, promote, update castling rights and counters, switch player, and record the move
+                            if (piece == 1 && (row == 0 || row == 7)) printf("Pawn promoted to Queen!\n");
 
-                            // Check if the move puts the player in check
-                            // If the move does not put the player in check, then switch players and play sound
-                            if (!isInCheck(board, currentPlayer)) {
-                                (backup==0)? PlaySound("Move.wav", NULL, SND_FILENAME | SND_SYNC) /* Play move sound */ : PlaySound("Capture.wav", NULL, SND_FILENAME | SND_SYNC); /* Play capture sound */
-                                PlaySound("sound.wav", NULL, SND_FILENAME | SND_ASYNC | SND_LOOP); // Play background music
-                                currentPlayer = 1 - currentPlayer; // Switch player
-                                if (isInCheck(board, currentPlayer)) printf("Check!\n");
-                                if (isCheckmate(board, currentPlayer)) {
-                                    printf("Checkmate!\n");
-                                    PlaySound("gameEnd.wav", NULL, SND_FILENAME | SND_SYNC); // Play end sound
-                                    printf("%s wins!\n", currentPlayer? "White":"Black"); // Print the winning player (the logic of currentPlayer is reversed because it came after switching players)
-                                }
+                            (!capture)? PlaySound("Move.wav", NULL, SND_FILENAME | SND_SYNC) /* Play move sound */ : PlaySound("Capture.wav", NULL, SND_FILENAME | SND_SYNC); /* Play capture sound */
+                            PlaySound("sound.wav", NULL, SND_FILENAME | SND_ASYNC | SND_LOOP); // Play background music
+                            // Opening trainer: tell the player if the move was book and what the book would have played
+                            // bookHints still holds the book moves of the position before this move
+                            if (trainerMode && bookData) {
+                                T_BookMove suggestion;
+                                bool inBook = false;
+                                for (int k = 0; k < bookHintCount; k++)
+                                    if (bookHints[k].fromRow == selectedRow && bookHints[k].fromCol == selectedCol && bookHints[k].toRow == row && bookHints[k].toCol == col)
+                                        inBook = true;
+                                if (inBook) printf("Book move.\n");
+                                else if (bookPickMove(bookHints, bookHintCount, &suggestion))
+                                    printf("Out of book! The book plays %c%d-%c%d here.\n", 'a' + suggestion.fromCol, 8 - suggestion.fromRow, 'a' + suggestion.toCol, 8 - suggestion.toRow);
+                            }
+                            updateBookHints(); // Book moves for the new position
+                            if (isInCheck(board, currentPlayer)) printf("Check!\n");
+                            if (isCheckmate(board, currentPlayer)) {
+                                printf("Checkmate!\n");
+                                PlaySound("gameEnd.wav", NULL, SND_FILENAME | SND_SYNC); // Play end sound
+                                printf("%s wins!\n", currentPlayer? "White":"Black"); // Print the winning player (the logic of currentPlayer is reversed because it came after switching players)
+                                strcpy(guiGame.result, currentPlayer ? "1-0" : "0-1");
+                                saveGuiGame();
+                            } else if (generateLegalMoves(board, currentPlayer, -1, -1, replies) == 0 && !isInCheck(board, currentPlayer)) {
+                                printf("Stalemate! The game is a draw.\n"); // No legal move but not in check
+                                strcpy(guiGame.result, "1/2-1/2");
+                                saveGuiGame();
+                                PlaySound("gameEnd.wav", NULL, SND_FILENAME | SND_SYNC); // Play end sound
+                            } else if (isInsufficientMaterial(board)) { // Endings like K vs K or K+N vs K are drawn no matter how they are played
+                                printf("Draw by insufficient material!\n");
+                                strcpy(guiGame.result, "1/2-1/2");
+                                saveGuiGame();
+                                PlaySound("gameEnd.wav", NULL, SND_FILENAME | SND_SYNC); // Play end sound
                             } else {
-                                // Undo move if it puts player in check
-                                board[selectedRow][selectedCol] = movedPiece;
-                                board[row][col] = backup;
+                                // In the endings the tables cover they know the exact result, so announce forced mates right away
+                                int winner, plies = probeEndgameTable(board, currentPlayer, &winner);
+                                if (plies > 0) printf("%s mates in %d!\n", winner ? "Black" : "White", (plies + 1) / 2);
+                                else if (plies == -1) printf("This ending is a draw with best play.\n");
+                                else if ((plies = probeKPK(board, currentPlayer, &winner)) == 1) printf("%s is winning this pawn ending.\n", winner ? "Black" : "White");
+                                else if (plies == 0) printf("This pawn ending is a draw with best play.\n");
                             }
+                            autosave(); // A crash or a closed window loses nothing
+                            markDirty(DIRTY_BOARD | DIRTY_HIGHLIGHTS | DIRTY_OVERLAY);
+                            startMoveAnimation(before, movedPiece / 10); // After the sounds, which block, so the animation is seen from its start
                         }
                     }
                     selectedRow = -1;
                     selectedCol = -1;
                     updateAvailableMoves(); // Resetting the AvailableMoves array to be ready for the next selection
+                    markDirty(DIRTY_SELECTION);
                 }
-                glutPostRedisplay(); // Redraw the board
+                // Clicks that change nothing (an empty square or an opponent piece with nothing selected) do not redraw
             }
         }
     }
@@ -615,112 +1859,3066 @@ void boardInitializer(int board[8][8]) {
             board[i][j] = chessBoard[i][j];
 }
 
-// ### Force window size back to 700x700 ###
-void reshape(int w, int h) {
-    glutReshapeWindow(700, 700); // Always keep window square and fixed size
+// ### Load a position from a FEN string ###
+// Sets the board, side to move, castling flags, en passant column and move counters.
+// Returns false and leaves the game untouched if the string is not a valid FEN.
+bool loadFEN(const char* fen) {
+    static const char pieceLetters[] = " pkqrbn"; // Index is the piece code used on the board
+    int newBoard[8][8] = {{0}};
+    const char* p = fen;
+    int row = 0, col = 0;
+    // Field 1: piece placement, rank 8 first, which is row 0 of our board
+    for (; *p && *p != ' '; p++) {
+        if (*p == '/') {
+            if (col != 8 || ++row > 7) return false;
+            col = 0;
+        } else if (*p >= '1' && *p <= '8') {
+            col += *p - '0';
+            if (col > 8) return false;
+        } else {
+            const char* letter = strchr(pieceLetters, *p | 32); // | 32 turns uppercase letters into lowercase
+            if (!letter || col > 7) return false;
+            int piece = (int)(letter - pieceLetters);
+            newBoard[row][col++] = (*p >= 'a' ? 10 : 0) + piece; // Lowercase letters are black pieces
+        }
+    }
+    if (row != 7 || col != 8 || *p++ != ' ') return false;
+    int kings[2] = { 0, 0 }; // The rules code needs exactly one king per side
+    for (int i = 0; i < 64; i++) if (newBoard[i / 8][i % 8] % 10 == 2) kings[newBoard[i / 8][i % 8] / 10]++;
+    if (kings[0] != 1 || kings[1] != 1) return false;
+    for (int j = 0; j < 8; j++) // Pawns can never stand on the first or last rank
+        if (newBoard[0][j] % 10 == 1 || newBoard[7][j] % 10 == 1) return false;
+    // Field 2: side to move
+    if (*p != 'w' && *p != 'b') return false;
+    int player = *p++ == 'b';
+    if (*p == ' ') p++;
+    else if (*p) return false; // Fields after the side to move may be left out
+    // Field 3: castling rights
+    bool rights[4] = {false, false, false, false}; // K, Q, k, q
+    if (*p == '-') p++;
+    else for (; *p && *p != ' '; p++) {
+        const char* flag = strchr("KQkq", *p);
+        if (!flag) return false;
+        rights[flag - "KQkq"] = true;
+    }
+    // Drop rights whose king and rook are not on their home squares, makeMove would move whatever stands there as the rook
+    if (newBoard[7][4] != 2) rights[0] = rights[1] = false;
+    if (newBoard[0][4] != 12) rights[2] = rights[3] = false;
+    if (newBoard[7][7] != 4) rights[0] = false;
+    if (newBoard[7][0] != 4) rights[1] = false;
+    if (newBoard[0][7] != 14) rights[2] = false;
+    if (newBoard[0][0] != 14) rights[3] = false;
+    // Field 4: en passant target square, rank 6 when white is to move and rank 3 when black is
+    int epCol = -1;
+    if (*p == ' ') p++;
+    if (*p == '-') p++;
+    else if (*p >= 'a' && *p <= 'h' && p[1] == (player ? '3' : '6')) { epCol = *p - 'a'; p += 2; } // Both characters are there
+    else if (*p) return false;
+    // Fields 5 and 6: half-move clock and full-move number, both optional
+    int halfmoves = 0, fullmoves = 1;
+    if (*p == ' ') halfmoves = (int)strtol(p, (char**)&p, 10);
+    if (halfmoves < 0) return false;
+    if (*p == ' ') fullmoves = (int)strtol(p, (char**)&p, 10);
+
+    // Everything parsed, now commit it to the game state
+    memcpy(board, newBoard, sizeof(newBoard));
+    currentPlayer = player;
+    whiteKingsideRookMoved = !rights[0];
+    whiteQueensideRookMoved = !rights[1];
+    blackKingsideRookMoved = !rights[2];
+    blackQueensideRookMoved = !rights[3];
+    whiteKingMoved = !rights[0] && !rights[1];
+    blackKingMoved = !rights[2] && !rights[3];
+    enPassantCol = epCol;
+    halfmoveClock = halfmoves;
+    fullmoveNumber = fullmoves > 0 ? fullmoves : 1;
+    return true;
 }
 
-// ### Load texture from file ###
-GLuint loadTexture(const char* filename) { // Load a PNG texture from file
-    // Use stb_image to load the PNG file
-    int width, height, channels; // Variables to hold image dimensions and channels
-    unsigned char* data = stbi_load(filename, &width, &height, &channels, 4); // Load PNG as RGBA
-    if (!data) {
-        printf("Failed to load texture: %s\n", filename); // Print error if file not found
-        return 0;
+// ### Write the current position as a FEN string ###
+// out must hold at least FEN_MAX characters
+void writeFEN(char* out) {
+    static const char pieceLetters[] = " pkqrbn";
+    char* p = out;
+    for (int i = 0; i < 8; i++) {
+        int empty = 0; // Run of empty squares on this row
+        for (int j = 0; j < 8; j++) {
+            int val = board[i][j];
+            if (!val) { empty++; continue; }
+            if (empty) { *p++ = (char)('0' + empty); empty = 0; }
+            char letter = pieceLetters[val % 10];
+            *p++ = val / 10 ? letter : (char)(letter - 32); // Uppercase for white
+        }
+        if (empty) *p++ = (char)('0' + empty);
+        if (i < 7) *p++ = '/';
     }
-    GLuint tex; // Texture handle to be returned
-    // Generate and set up the texture
-    glGenTextures(1, &tex); // 1 is the number of textures to be generated and to store the texture ID in the variable tex
-    glBindTexture(GL_TEXTURE_2D, tex); // Bind it for setup (2D setup), which means making it the current texture for 2D rendering
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data); // Upload pixel data
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR); // Linear filtering for minification
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR); // Linear magnification
-    stbi_image_free(data); // Free image memory
-    return tex; // Return texture handle
+    *p++ = ' ';
+    *p++ = currentPlayer ? 'b' : 'w';
+    *p++ = ' ';
+    // A right is only written if neither piece has moved and both are still on their squares
+    char* rights = p;
+    if (!whiteKingMoved && !whiteKingsideRookMoved && board[7][4] == 2 && board[7][7] == 4) *p++ = 'K';
+    if (!whiteKingMoved && !whiteQueensideRookMoved && board[7][4] == 2 && board[7][0] == 4) *p++ = 'Q';
+    if (!blackKingMoved && !blackKingsideRookMoved && board[0][4] == 12 && board[0][7] == 14) *p++ = 'k';
+    if (!blackKingMoved && !blackQueensideRookMoved && board[0][4] == 12 && board[0][0] == 14) *p++ = 'q';
+    if (p == rights) *p++ = '-';
+    *p++ = ' ';
+    if (enPassantCol >= 0) { *p++ = (char)('a' + enPassantCol); *p++ = currentPlayer ? '3' : '6'; }
+    else *p++ = '-';
+    sprintf(p, " %d %d", halfmoveClock, fullmoveNumber);
 }
 
-// ### Update available moves for the selected piece ###
-void updateAvailableMoves() {
-    // Clear previous highlights
-    for (int i = 0; i < BOARD_SIZE; i++)
-        for (int j = 0; j < BOARD_SIZE; j++)
-            availableMoves[i][j] = false;
-
-    if (selectedRow == -1 || selectedCol == -1) // Checks if there is a selected piece
-        return;
-
-    int val = board[selectedRow][selectedCol];
-    int color = val / 10;
-    if (val == 0 || color != currentPlayer) // Checks if there is a piece selected and not just an empty square and the color selected matches the player color to validate players turn
+// ### Handle key presses: Ctrl+C copies the position as FEN, Ctrl+V pastes a FEN position, Ctrl+S/Ctrl+O save and restore a snapshot, E toggles the explorer ###
+void keyboard(unsigned char key, int x, int y) {
+    if (key == 'e' || key == 'E') {
+        explorerMode = !explorerMode;
+        markDirty(DIRTY_OVERLAY);
         return;
-
-    // check all squares on the board for available moves for the selected piece
-    // Loop through all squares on the board to find legal moves for the selected piece
-    for (int r = 0; r < BOARD_SIZE; r++)
-        for (int c = 0; c < BOARD_SIZE; c++)
-            if (isLegalMove(board, selectedRow, selectedCol, r, c, currentPlayer)) { // Check if the move is legal for the selected piece
-            // If the move is legal, mark it as available
-            // Simulate the move
-            int backup = board[r][c];   // Backup the piece at the target square
-            // Move the piece to the target square
-            int movedPiece = board[selectedRow][selectedCol];
-            board[r][c] = movedPiece; // Place the selected piece at the target square
-            // Empty the selected square
-            board[selectedRow][selectedCol] = 0;
-            bool leavesInCheck = isInCheck(board, currentPlayer);  // Check if the move leaves the player in check
-            if (!leavesInCheck) // If the move does not leave the player in check
-                availableMoves[r][c] = true; // Mark the target square as available for the selected piece
-            // Undo the move
-            board[selectedRow][selectedCol] = movedPiece;
-            board[r][c] = backup;
-            if (!leavesInCheck)
-                availableMoves[r][c] = true;
+    }
+    if (key == 3) { // Ctrl+C
+        char fen[FEN_MAX];
+        writeFEN(fen);
+        printf("FEN: %s\n", fen);
+        if (OpenClipboard(NULL)) {
+            EmptyClipboard();
+            HGLOBAL memory = GlobalAlloc(GMEM_MOVEABLE, strlen(fen) + 1); // The clipboard takes ownership of this block
+            if (memory) {
+                memcpy(GlobalLock(memory), fen, strlen(fen) + 1);
+                GlobalUnlock(memory);
+                SetClipboardData(CF_TEXT, memory);
+            }
+            CloseClipboard();
+        }
+    } else if (key == 22) { // Ctrl+V
+        if (!OpenClipboard(NULL)) return;
+        HANDLE memory = GetClipboardData(CF_TEXT);
+        const char* text = memory ? (const char*)GlobalLock(memory) : NULL;
+        if (text) {
+            if (loadFEN(text)) {
+                starter = currentPlayer; // The pasted side to move starts
+                selectedRow = selectedCol = -1;
+                updateAvailableMoves();
+                updateBookHints();
+                printf("Position loaded from clipboard.\n");
+                saveGuiGame(); // Keep what was played so far, then record from the pasted position
+                recordStart(&guiGame);
+                guiGameSaved = false;
+                autosave();
+                markDirty(DIRTY_ALL);
+            } else printf("The clipboard does not hold a valid FEN.\n");
+            GlobalUnlock(memory);
         }
+        CloseClipboard();
+    } else if (key == 19) { // Ctrl+S
+        if (snapshotSave("snapshot.sav")) printf("Game saved to snapshot.sav\n");
+        else printf("Cannot write snapshot.sav\n");
+    } else if (key == 15) { // Ctrl+O
+        saveGuiGame(); // Keep the game that is replaced
+        if (snapshotLoad("snapshot.sav")) {
+            printf("Game restored from snapshot.sav\n");
+            markDirty(DIRTY_ALL);
+        } else printf("No valid snapshot.sav to restore.\n");
+    }
 }
 
-// ### Main function: initializes everything and starts the game loop ###
-int main(int argc, char **argv) {
-    glutInit(&argc, argv); // Initialize GLUT
-    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA); // Double buffering, RGBA color
-    glutInitWindowSize(700, 700); // Set window size
-    glutCreateWindow("Chess Game"); // Create window with title
-    glewInit(); // Initialize GLEW (must be after window creation)
+// ### Start reading PGN text from a file ###
+// At most limit bytes are read from the current file position (-1 = until the end of the file)
+void pgnReaderInit(T_PgnReader* reader, FILE* file, long long limit) {
+    reader->file = file;
+    reader->remaining = limit;
+    reader->length = reader->pos = 0;
+}
 
-    // Enable alpha blending for PNG transparency, to show only the chess piece without a background
-    glEnable(GL_BLEND); // Enable blending for transparency
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); // Set blending function for transparency
+// ### Get the next character of the PGN input, refilling the buffer chunk by chunk ###
+int pgnGetChar(T_PgnReader* reader) {
+    if (reader->pos == reader->length) {
+        size_t want = PGN_BUFFER_SIZE;
+        if (reader->remaining >= 0 && (long long)want > reader->remaining) want = (size_t)reader->remaining;
+        reader->length = want ? fread(reader->buffer, 1, want, reader->file) : 0;
+        reader->pos = 0;
+        if (reader->remaining >= 0) reader->remaining -= (long long)reader->length;
+        if (!reader->length) return EOF;
+    }
+    return reader->buffer[reader->pos++];
+}
 
-    // Matching the coordinates of the mouse and input drawing to the chessboard
-    glClearColor(0.0f, 0.0f, 0.0f, 1.0f); // Set background color to black
-    glMatrixMode(GL_PROJECTION); // Set projection matrix
-    glLoadIdentity(); // Load identity matrix to reset projection
-    gluOrtho2D(0, 700, 700, 0); // Set orthographic projection (top-left origin)
-    
-    glutReshapeFunc(reshape); // Set reshape callback
+// ### Read one game: tags, then movetext replayed on the board until the result ###
+// Returns false when the input has no more games
+bool pgnReadGame(T_PgnReader* reader, T_PgnGame* game) {
+    char token[PGN_TOKEN_MAX]; // Current movetext token, reused for every token so nothing is allocated
+    bool seenAnything = false, inMovetext = false;
+    int c;
+    newGame();
+    strcpy(game->result, "*");
+    game->plies = 0;
+    game->error = false;
+    game->errorMove[0] = '\0';
+    game->startFEN[0] = '\0';
 
-    PlaySound("sound.wav", NULL, SND_FILENAME | SND_ASYNC | SND_LOOP); // Play background music
+    while ((c = pgnGetChar(reader)) != EOF) {
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n') continue;
+        if (c == '[') { // Tag pair like [Result "1-0"]
+            if (inMovetext) { reader->pos--; return true; } // Next game starts, this one had no result token
+            char name[PGN_TOKEN_MAX], value[PGN_TAG_VALUE_MAX];
+            int n = 0, v = 0;
+            while ((c = pgnGetChar(reader)) != EOF && c != ' ' && c != ']')
+                if (n < PGN_TOKEN_MAX - 1) name[n++] = (char)c;
+            while (c != EOF && c != '"' && c != ']') c = pgnGetChar(reader);
+            if (c == '"')
+                while ((c = pgnGetChar(reader)) != EOF && c != '"') {
+                    if (c == '\\') c = pgnGetChar(reader); // Escaped quote or backslash
+                    if (v < PGN_TAG_VALUE_MAX - 1) value[v++] = (char)c;
+                }
+            while (c != EOF && c != ']') c = pgnGetChar(reader);
+            name[n] = value[v] = '\0';
+            if (strcmp(name, "Result") == 0) { strncpy(game->result, value, sizeof(game->result) - 1); game->result[sizeof(game->result) - 1] = '\0'; }
+            if (strcmp(name, "FEN") == 0) {
+                if (!loadFEN(value) || v >= FEN_MAX) { game->error = true; strcpy(game->errorMove, "FEN"); }
+                else strcpy(game->startFEN, value);
+            }
+            seenAnything = true;
+            continue;
+        }
+        seenAnything = inMovetext = true;
+        if (c == '{') { // Comment
+            while ((c = pgnGetChar(reader)) != EOF && c != '}');
+            continue;
+        }
+        if (c == ';') { // Comment to the end of the line
+            while ((c = pgnGetChar(reader)) != EOF && c != '\n');
+            continue;
+        }
+        if (c == '(') { // Variation, possibly nested, skipped completely
+            int depth = 1;
+            while (depth > 0 && (c = pgnGetChar(reader)) != EOF) {
+                if (c == '(') depth++;
+                else if (c == ')') depth--;
+                else if (c == '{') while ((c = pgnGetChar(reader)) != EOF && c != '}');
+            }
+            continue;
+        }
+        if (c == '$' || c == ')') { // Numeric annotation glyph or stray bracket
+            while ((c = pgnGetChar(reader)) != EOF && c >= '0' && c <= '9');
+            if (c != EOF) reader->pos--;
+            continue;
+        }
 
-    // Load all chess piece textures before even starting the game
-    whitePawnTex   = loadTexture("White_Pawn.png");
-    whiteKingTex   = loadTexture("White_King.png");
-    whiteQueenTex  = loadTexture("White_Queen.png");
-    whiteRookTex   = loadTexture("White_Rook.png");
-    whiteBishopTex = loadTexture("White_Bishop.png");
-    whiteKnightTex = loadTexture("White_Knight.png");
-    blackPawnTex   = loadTexture("Black_Pawn.png");
-    blackKingTex   = loadTexture("Black_King.png");
-    blackQueenTex  = loadTexture("Black_Queen.png");
-    blackRookTex   = loadTexture("Black_Rook.png");
-    blackBishopTex = loadTexture("Black_Bishop.png");
-    blackKnightTex = loadTexture("Black_Knight.png");
-    menuBackgroundTex = loadTexture("Background_Main_Menu.jpg");
-    theCreatorTex = loadTexture("TheCreator.jpg");
+        // Anything else is a token: move number, SAN move or result
+        int n = 0;
+        do {
+            if (n < PGN_TOKEN_MAX - 1) token[n++] = (char)c;
+            c = pgnGetChar(reader);
+        } while (c != EOF && c != ' ' && c != '\t' && c != '\r' && c != '\n' && c != '{' && c != '(' && c != ')' && c != '[' && c != ';' && c != '$');
+        if (c != EOF) reader->pos--; // Leave the delimiter for the next round
+        token[n] = '\0';
+
+        if (strcmp(token, "1-0") == 0 || strcmp(token, "0-1") == 0 || strcmp(token, "1/2-1/2") == 0 || strcmp(token, "*") == 0) {
+            strcpy(game->result, token);
+            return true; // The result token ends the game
+        }
+        const char* san = token;
+        while (*san >= '0' && *san <= '9') san++; // Skip a move number like "12." or "12..."
+        if (san != token) while (*san == '.') san++;
+        if (!*san || game->error) continue; // Nothing left, or the game is already broken so the rest is skipped
+
+        T_Move move;
+        if (sanToMove(san, &move)) {
+            if (game->plies < MAX_GAME_PLIES) game->moves[game->plies] = encodeMove(move); // Kept for the binary format
+            playMove(move);
+            game->plies++;
+        } else {
+            game->error = true; // Keep reading to the end of the game, but stop replaying it
+            strncpy(game->errorMove, san, sizeof(game->errorMove) - 1);
+            game->errorMove[sizeof(game->errorMove) - 1] = '\0';
+        }
+    }
+    return seenAnything;
+}
+
+// ### Turn a SAN move like "Nbd7", "exd6", "O-O" or "e8=Q+" into a move for the side to play ###
+bool sanToMove(const char* san, T_Move* move) {
+    char s[PGN_TOKEN_MAX];
+    int len = 0;
+    for (; *san && len < PGN_TOKEN_MAX - 1; san++)
+        if (!strchr("+#!?", *san)) s[len++] = *san; // Check marks and annotations do not change the move
+    s[len] = '\0';
+
+    int row = currentPlayer ? 0 : 7; // Home row of the side to move
+    T_Move moves[64];
+    if (strcmp(s, "O-O") == 0 || strcmp(s, "0-0") == 0 || strcmp(s, "O-O-O") == 0 || strcmp(s, "0-0-0") == 0) {
+        int toCol = len == 5 ? 2 : 6;
+        if (board[row][4] % 10 != 2 || generateLegalMoves(board, currentPlayer, row * 8 + 4, row * 8 + toCol, moves) != 1) return false;
+        *move = moves[0];
+        return true;
+    }
+
+    static const char pieceLetters[] = "PKQRBN"; // Index + 1 is the piece code used on the board
+    int piece = 1, start = 0, promotion = 0;
+    const char* letter = strchr(pieceLetters, s[0]);
+    if (s[0] && letter) { piece = (int)(letter - pieceLetters) + 1; start = 1; }
+    // Promotion is written "e8=Q" or "e8Q"
+    if (len >= 2 && piece == 1 && strchr("QRBN", s[len - 1])) {
+        promotion = (int)(strchr(pieceLetters, s[len - 1]) - pieceLetters) + 1;
+        len -= s[len - 2] == '=' ? 2 : 1;
+    }
+    if (len - start < 2) return false;
+    int toCol = s[len - 2] - 'a', toRow = 8 - (s[len - 1] - '0');
+    if (toCol < 0 || toCol > 7 || toRow < 0 || toRow > 7) return false;
+    // Whatever is between the piece letter and the target square is disambiguation (file, rank or both) and 'x'
+    int fromCol = -1, fromRow = -1;
+    for (int i = start; i < len - 2; i++) {
+        if (s[i] >= 'a' && s[i] <= 'h') fromCol = s[i] - 'a';
+        else if (s[i] >= '1' && s[i] <= '8') fromRow = 8 - (s[i] - '0');
+        else if (s[i] != 'x' && s[i] != '-' && s[i] != ':') return false;
+    }
+
+    int count = generateLegalMoves(board, currentPlayer, -1, toRow * 8 + toCol, moves), found = 0;
+    for (int k = 0; k < count; k++) {
+        if (board[moves[k].fromRow][moves[k].fromCol] % 10 != piece) continue;
+        if ((fromCol >= 0 && moves[k].fromCol != fromCol) || (fromRow >= 0 && moves[k].fromRow != fromRow)) continue;
+        if (piece == 1 && fromCol < 0 && moves[k].fromCol != toCol) continue; // A pawn without a file letter moves straight
+        if (moves[k].promotion && moves[k].promotion != (promotion ? promotion : 3)) continue; // Promotion without a piece means queen
+        *move = moves[k];
+        found++;
+    }
+    return found == 1; // No match is an illegal move, more than one is ambiguous
+}
+
+// ### Find where the first game at or after offset starts (a line beginning with "[Event ") ###
+long long pgnFindGameStart(FILE* file, long long offset, long long fileSize) {
+    if (offset <= 0) return 0;
+    if (offset >= fileSize || _fseeki64(file, offset - 1, SEEK_SET) != 0) return fileSize;
+    static const char marker[] = "\n[Event ";
+    int matched = 0, c;
+    long long pos = offset - 1; // Start one byte early so a game starting exactly at offset is found too
+    for (; (c = getc(file)) != EOF; pos++) { // pos is the file position of c
+        if (c == marker[matched]) {
+            if (++matched == (int)sizeof(marker) - 1) return pos - (matched - 2); // Position of the '['
+        } else matched = (c == '\n') ? 1 : 0;
+    }
+    return fileSize;
+}
+
+// ### Worker thread: take the next chunk, replay its games, repeat until every chunk is done ###
+DWORD WINAPI pgnImportWorker(LPVOID param) {
+    T_PgnImport* import = (T_PgnImport*)param;
+    T_PgnReader* reader = malloc(sizeof(T_PgnReader)); // One buffer per worker, reused for all of its chunks
+    FILE* file = fopen(import->filename, "rb");        // Own file handle so seeking does not disturb the other workers
+    if (!reader || !file) { free(reader); if (file) fclose(file); return 1; }
+    T_PgnGame game;
+    for (;;) {
+        int index = (int)InterlockedIncrement(&import->nextChunk) - 1; // Chunks are handed out in order
+        if (index >= import->chunkCount) break;
+        T_PgnChunk* chunk = &import->chunks[index];
+        _fseeki64(file, chunk->start, SEEK_SET);
+        pgnReaderInit(reader, file, chunk->end - chunk->start);
+        while (pgnReadGame(reader, &game)) { // Board, castling flags and turn are thread-local, so every worker replays independently
+            chunk->games++;
+            chunk->plies += game.plies;
+            if (strcmp(game.result, "1-0") == 0) chunk->whiteWins++;
+            else if (strcmp(game.result, "0-1") == 0) chunk->blackWins++;
+            else if (strcmp(game.result, "1/2-1/2") == 0) chunk->draws++;
+            if (game.error) {
+                if (chunk->errors < PGN_CHUNK_ERRORS) { // Keep the first few errors, they are printed in file order later
+                    chunk->errorGame[chunk->errors] = chunk->games;
+                    chunk->errorPly[chunk->errors] = game.plies;
+                    strcpy(chunk->errorMove[chunk->errors], game.errorMove);
+                }
+                chunk->errors++;
+            }
+        }
+    }
+    fclose(file);
+    free(reader);
+    return 0;
+}
+
+// ### Replay every game of a PGN file on all cores and report the speed (main.exe --pgn games.pgn [--threads N]) ###
+// The file is cut into chunks at game boundaries; workers replay chunks and the results are merged in file order.
+int replayPgnFile(const char* filename, int threads) {
+    FILE* file = fopen(filename, "rb");
+    if (!file) {
+        printf("Cannot open %s\n", filename);
+        return 1;
+    }
+    _fseeki64(file, 0, SEEK_END);
+    long long fileSize = _ftelli64(file);
+
+    // Cut the file into chunks that each start at a game
+    T_PgnImport import;
+    import.filename = filename;
+    import.chunkCount = (int)(fileSize / PGN_CHUNK_SIZE) + 1;
+    import.chunks = calloc(import.chunkCount, sizeof(T_PgnChunk));
+    import.nextChunk = 0;
+    for (int i = 0; i < import.chunkCount; i++)
+        import.chunks[i].start = pgnFindGameStart(file, (long long)i * PGN_CHUNK_SIZE, fileSize);
+    for (int i = 0; i < import.chunkCount; i++)
+        import.chunks[i].end = i + 1 < import.chunkCount ? import.chunks[i + 1].start : fileSize;
+    fclose(file);
+
+    if (threads <= 0) { // Default to one worker per core
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        threads = (int)info.dwNumberOfProcessors;
+    }
+    if (threads > import.chunkCount) threads = import.chunkCount; // No point in idle workers
+    if (threads > PGN_MAX_THREADS) threads = PGN_MAX_THREADS;
+
+    DWORD start = GetTickCount();
+    HANDLE workers[PGN_MAX_THREADS];
+    for (int i = 0; i < threads; i++)
+        workers[i] = CreateThread(NULL, 0, pgnImportWorker, &import, 0, NULL);
+    for (int i = 0; i < threads; i++) {
+        WaitForSingleObject(workers[i], INFINITE);
+        CloseHandle(workers[i]);
+    }
+    double seconds = (GetTickCount() - start) / 1000.0;
+    if (seconds <= 0) seconds = 0.001;
+
+    // Merge the chunk results in file order so game numbers match the file
+    long games = 0, plies = 0, errors = 0, whiteWins = 0, blackWins = 0, draws = 0;
+    for (int i = 0; i < import.chunkCount; i++) {
+        T_PgnChunk* chunk = &import.chunks[i];
+        for (int e = 0; e < chunk->errors && e < PGN_CHUNK_ERRORS; e++)
+            if (errors + e < 10)
+                printf("Game %ld: cannot play \"%s\" after %d plies\n", games + chunk->errorGame[e], chunk->errorMove[e], chunk->errorPly[e]);
+        games += chunk->games;
+        plies += chunk->plies;
+        errors += chunk->errors;
+        whiteWins += chunk->whiteWins;
+        blackWins += chunk->blackWins;
+        draws += chunk->draws;
+    }
+    printf("%ld games (+%ld -%ld =%ld), %ld plies, %ld with errors\n", games, whiteWins, blackWins, draws, plies, errors);
+    printf("%d threads, %d chunks, %.2f s (%.0f games/s, %.0f plies/s)\n",
+           threads, import.chunkCount, seconds, games / seconds, plies / seconds);
+    free(import.chunks);
+    return errors ? 1 : 0;
+}
+
+// ### Write a move in Standard Algebraic Notation, e.g. "Nbd7", "exd6", "O-O", "e8=Q" ###
+// The position must be the one before the move; check and mate marks are added by recordMove.
+// Disambiguation comes from the move generator: only pieces that can really reach the target square count.
+void moveToSAN(int board[8][8], int player, T_Move move, char* out) {
+    static const char pieceLetters[] = " PKQRBN";
+    int piece = board[move.fromRow][move.fromCol] % 10;
+    char* p = out;
+    if (piece == 2 && abs(move.toCol - move.fromCol) == 2) { // Castling
+        strcpy(out, move.toCol == 6 ? "O-O" : "O-O-O");
+        return;
+    }
+    bool capture = board[move.toRow][move.toCol] != 0 || (piece == 1 && move.fromCol != move.toCol);
+    if (piece == 1) {
+        if (capture) *p++ = (char)('a' + move.fromCol); // Pawn captures name the file they come from
+    } else {
+        *p++ = pieceLetters[piece];
+        T_Move moves[64];
+        int count = generateLegalMoves(board, player, -1, move.toRow * 8 + move.toCol, moves);
+        bool ambiguous = false, sameCol = false, sameRow = false;
+        for (int k = 0; k < count; k++) {
+            if (moves[k].fromRow == move.fromRow && moves[k].fromCol == move.fromCol) continue; // The move itself
+            if (board[moves[k].fromRow][moves[k].fromCol] % 10 != piece) continue;          // Other piece types do not matter
+            ambiguous = true;
+            if (moves[k].fromCol == move.fromCol) sameCol = true;
+            if (moves[k].fromRow == move.fromRow) sameRow = true;
+        }
+        if (ambiguous && (!sameCol || sameRow)) *p++ = (char)('a' + move.fromCol); // The file is enough unless another piece shares it
+        if (ambiguous && sameCol) *p++ = (char)('8' - move.fromRow);
+    }
+    if (capture) *p++ = 'x';
+    *p++ = (char)('a' + move.toCol);
+    *p++ = (char)('8' - move.toRow);
+    if (piece == 1 && (move.toRow == 0 || move.toRow == 7)) {
+        *p++ = '=';
+        *p++ = pieceLetters[move.promotion ? move.promotion : 3];
+    }
+    *p = '\0';
+}
+
+// ### Start recording a game from the current position ###
+void recordStart(T_GameRecord* record) {
+    writeFEN(record->startFEN);
+    record->count = 0;
+    strcpy(record->result, "*");
+}
+
+// ### Play a move in the game and add it to the record ###
+void recordMove(T_GameRecord* record, T_Move move) {
+    char* san = record->san[record->count];
+    moveToSAN(board, currentPlayer, move, san); // Needs the position before the move
+    playMove(move);
+    if (isCheckmate(board, currentPlayer)) strcat(san, "#");
+    else if (isInCheck(board, currentPlayer)) strcat(san, "+");
+    if (record->count < MAX_GAME_PLIES - 1) record->count++; // Extremely long games keep overwriting the last move instead of overflowing
+}
+
+// ### Write one recorded game as PGN ###
+void writeRecordPGN(FILE* file, const T_GameRecord* record, const char* event) {
+    static const char startFEN[] = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+    time_t now = time(NULL);
+    struct tm* date = localtime(&now);
+    fprintf(file, "[Event \"%s\"]\n[Site \"?\"]\n[Date \"%04d.%02d.%02d\"]\n[Round \"-\"]\n[White \"White\"]\n[Black \"Black\"]\n[Result \"%s\"]\n",
+            event, date->tm_year + 1900, date->tm_mon + 1, date->tm_mday, record->result);
+    if (strcmp(record->startFEN, startFEN) != 0) // Only games from a custom position need the setup tags
+        fprintf(file, "[SetUp \"1\"]\n[FEN \"%s\"]\n", record->startFEN);
+    fputc('\n', file);
+
+    // The move number and the side that moved first come from the starting FEN
+    const char* side = strchr(record->startFEN, ' ');
+    int player = side && side[1] == 'b';
+    int moveNumber = atoi(strrchr(record->startFEN, ' ') + 1);
+    int column = 0; // Lines are wrapped before 80 characters
+    for (int i = 0; i < record->count; i++, player = 1 - player) {
+        char text[24];
+        int n = 0;
+        if (player == 0) n = sprintf(text, "%d. ", moveNumber);
+        else if (i == 0) n = sprintf(text, "%d... ", moveNumber);
+        n += sprintf(text + n, "%s", record->san[i]);
+        if (player == 1) moveNumber++;
+        if (column + n + 1 > 79) { fputc('\n', file); column = 0; }
+        else if (column) { fputc(' ', file); column++; }
+        fputs(text, file);
+        column += n;
+    }
+    fprintf(file, "%s%s\n\n", column ? " " : "", record->result);
+}
+
+// ### Append many recorded games to a PGN file at once (for self-play runs) ###
+bool exportGamesPGN(const char* filename, const T_GameRecord records[], int count, const char* event) {
+    FILE* file = fopen(filename, "a");
+    if (!file) return false;
+    for (int i = 0; i < count; i++)
+        writeRecordPGN(file, &records[i], event);
+    fclose(file);
+    return true;
+}
+
+// ### Save the game played in the window to games.pgn once it is over (or when the window closes) ###
+void saveGuiGame(void) {
+    if (guiGameSaved || guiGame.count == 0) return; // Nothing played, or already written
+    if (exportGamesPGN("games.pgn", &guiGame, 1, "Casual game")) printf("Game saved to games.pgn\n");
+    guiGameSaved = true;
+}
+
+// ### Save everything needed to continue the game: position, game state, settings and the moves played so far ###
+// The file is written under a temporary name and then renamed over the old one, so a crash never leaves half a snapshot
+bool snapshotSave(const char* filename) {
+    T_GameState state;
+    T_SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    saveGameState(&state);
+    memcpy(header.magic, SNAPSHOT_MAGIC, 4);
+    header.version = SNAPSHOT_VERSION;
+    header.screen = (unsigned char)gameState;
+    header.starter = (unsigned char)starter;
+    header.trainer = trainerMode;
+    for (int i = 0; i < 64; i++) header.board[i] = (unsigned char)state.board[i / 8][i % 8];
+    header.player = (unsigned char)state.currentPlayer;
+    for (int i = 0; i < 6; i++) header.castling |= state.castling[i] << i;
+    header.enPassantCol = (signed char)state.enPassantCol;
+    header.halfmoveClock = (unsigned short)state.halfmoveClock;
+    header.fullmoveNumber = (unsigned short)state.fullmoveNumber;
+    header.moveCount = (unsigned short)guiGame.count;
+    strcpy(header.result, guiGame.result);
+    strcpy(header.startFEN, guiGame.startFEN);
+
+    char tempName[MAX_PATH];
+    snprintf(tempName, sizeof(tempName), "%s.tmp", filename);
+    FILE* file = fopen(tempName, "wb");
+    if (!file) return false;
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    if (guiGame.count) ok = ok && fwrite(guiGame.san, SAN_MAX, guiGame.count, file) == (size_t)guiGame.count;
+    ok = fclose(file) == 0 && ok;
+    if (ok) ok = MoveFileExA(tempName, filename, MOVEFILE_REPLACE_EXISTING) != 0;
+    if (!ok) DeleteFileA(tempName);
+    return ok;
+}
+
+// ### Load a snapshot written by snapshotSave and continue from it ###
+// Returns false and leaves the game untouched if the file is missing or not a valid snapshot, so the game starts fresh
+bool snapshotLoad(const char* filename) {
+    FILE* file = fopen(filename, "rb");
+    if (!file) return false;
+    T_SnapshotHeader header;
+    bool ok = fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.magic, SNAPSHOT_MAGIC, 4) == 0
+              && header.version == SNAPSHOT_VERSION && header.moveCount < MAX_GAME_PLIES;
+    static char san[MAX_GAME_PLIES][SAN_MAX]; // Read aside first, so a broken file cannot damage the running game
+    if (ok && header.moveCount) ok = fread(san, SAN_MAX, header.moveCount, file) == header.moveCount;
+    fclose(file);
+    if (ok) ok = snapshotValid(&header, san);
+    if (!ok) {
+        printf("%s is damaged, it was not loaded\n", filename);
+        return false;
+    }
+
+    T_GameState state;
+    for (int i = 0; i < 64; i++) state.board[i / 8][i % 8] = header.board[i];
+    state.currentPlayer = header.player;
+    for (int i = 0; i < 6; i++) state.castling[i] = (header.castling >> i) & 1;
+    state.enPassantCol = header.enPassantCol;
+    state.halfmoveClock = header.halfmoveClock;
+    state.fullmoveNumber = header.fullmoveNumber;
+    restoreGameState(&state);
+    gameState = header.screen;
+    starter = header.starter;
+    trainerMode = header.trainer;
+    header.result[sizeof(header.result) - 1] = header.startFEN[FEN_MAX - 1] = '\0';
+    strcpy(guiGame.result, header.result);
+    strcpy(guiGame.startFEN, header.startFEN);
+    guiGame.count = header.moveCount;
+    memcpy(guiGame.san, san, (size_t)header.moveCount * SAN_MAX);
+    guiGameSaved = false;
+    selectedRow = selectedCol = -1;
+    updateAvailableMoves();
+    updateBookHints();
+    return true;
+}
+
+// ### Check everything a snapshot header and its moves contain before any of it is used ###
+// Board values index tables and the hash keys, so only real pieces are accepted, with exactly one king per side,
+// no pawn on the first or last row and the side that just moved not in check; strings must be terminated and known
+bool snapshotValid(const T_SnapshotHeader* header, char san[][SAN_MAX]) {
+    int kings[2] = { 0, 0 };
+    T_GameState state;
+    memset(&state, 0, sizeof(state));
+    for (int i = 0; i < 64; i++) {
+        int val = header->board[i], piece = val % 10;
+        if (val && (val / 10 > 1 || piece < 1 || piece > 6)) return false; // Only 0, 1-6 (white) and 11-16 (black)
+        if (piece == 2) kings[val / 10]++;
+        if (piece == 1 && (i < 8 || i >= 56)) return false;
+        state.board[i / 8][i % 8] = val;
+    }
+    if (kings[0] != 1 || kings[1] != 1) return false;
+    if (header->player > 1 || header->screen > 2 || header->starter > 1 || header->trainer > 1 || header->castling >= 64) return false;
+    if (header->enPassantCol < -1 || header->enPassantCol > 7 || header->fullmoveNumber == 0) return false;
+    if (!memchr(header->result, '\0', sizeof(header->result)) || !memchr(header->startFEN, '\0', FEN_MAX)) return false;
+    if (strcmp(header->result, "*") && strcmp(header->result, "1-0") && strcmp(header->result, "0-1") && strcmp(header->result, "1/2-1/2")) return false;
+    for (int i = 0; i < header->moveCount; i++)
+        if (!san[i][0] || !memchr(san[i], '\0', SAN_MAX)) return false;
+    if (isInCheck(state.board, 1 - header->player)) return false; // The side that just moved cannot have left its king in check
+    if (header->startFEN[0]) { // The start position must parse, without touching the running game
+        T_GameState running;
+        saveGameState(&running);
+        bool parsed = loadFEN(header->startFEN);
+        restoreGameState(&running);
+        if (!parsed) return false;
+    }
+    return true;
+}
+
+// ### Keep the autosave up to date after every move: rewrite it while the game runs, remove it once the game is over ###
+void autosave(void) {
+    if (strcmp(guiGame.result, "*") != 0) DeleteFileA(AUTOSAVE_FILE);
+    else if (!snapshotSave(AUTOSAVE_FILE)) printf("Autosave failed.\n");
+}
+
+// ### Pack a move into 16 bits: from square (bits 0-5), to square (6-11), promotion piece (12-13) ###
+unsigned short encodeMove(T_Move move) {
+    int promotion = move.promotion ? move.promotion - 3 : 0; // 0 = queen, 1 = rook, 2 = bishop, 3 = knight
+    return (unsigned short)((move.fromRow * 8 + move.fromCol) | ((move.toRow * 8 + move.toCol) << 6) | (promotion << 12));
+}
+
+// ### Unpack a 16-bit move ###
+T_Move decodeMove(unsigned short code) {
+    T_Move move = { (code & 63) / 8, code & 7, ((code >> 6) & 63) / 8, (code >> 6) & 7, ((code >> 12) & 3) + 3 };
+    return move;
+}
+
+// ### Create a binary game file and write its header ###
+FILE* binaryCreate(const char* filename) {
+    FILE* file = fopen(filename, "wb");
+    if (!file) return NULL;
+    setvbuf(file, NULL, _IOFBF, 1 << 20); // Large buffer, games are streamed out one after another
+    fwrite(BINARY_MAGIC, 1, 4, file);
+    fputc(BINARY_VERSION, file);
+    return file;
+}
+
+// ### Open a binary game file and check its header ###
+FILE* binaryOpen(const char* filename) {
+    FILE* file = fopen(filename, "rb");
+    if (!file) return NULL;
+    setvbuf(file, NULL, _IOFBF, 1 << 20);
+    char magic[4];
+    if (fread(magic, 1, 4, file) != 4 || memcmp(magic, BINARY_MAGIC, 4) != 0 || fgetc(file) != BINARY_VERSION) {
+        printf("Not a binary game file (or a different version)\n");
+        fclose(file);
+        return NULL;
+    }
+    return file;
+}
+
+// ### Append one game: 2-byte move count, 1-byte result, optional start FEN, then 2 bytes per move ###
+void binaryWriteGame(FILE* file, const T_BinaryGame* game) {
+    int fenLength = (int)strlen(game->startFEN); // 0 = standard starting position
+    unsigned char header[4] = { (unsigned char)(game->count & 255), (unsigned char)(game->count >> 8), (unsigned char)game->result, (unsigned char)fenLength };
+    fwrite(header, 1, 4, file);
+    fwrite(game->startFEN, 1, fenLength, file);
+    unsigned char moves[MAX_GAME_PLIES * 2];
+    for (int i = 0; i < game->count; i++) { // Little endian on disk whatever the machine is
+        moves[i * 2] = (unsigned char)(game->moves[i] & 255);
+        moves[i * 2 + 1] = (unsigned char)(game->moves[i] >> 8);
+    }
+    fwrite(moves, 2, game->count, file);
+}
+
+// ### Read the next game, returns false at the end of the file ###
+bool binaryReadGame(FILE* file, T_BinaryGame* game) {
+    unsigned char header[4], moves[MAX_GAME_PLIES * 2];
+    if (fread(header, 1, 4, file) != 4) return false;
+    game->count = header[0] | (header[1] << 8);
+    game->result = header[2];
+    if (game->count > MAX_GAME_PLIES || header[3] >= FEN_MAX) return false; // Corrupt file
+    if (fread(game->startFEN, 1, header[3], file) != header[3]) return false;
+    game->startFEN[header[3]] = '\0';
+    if (fread(moves, 2, game->count, file) != (size_t)game->count) return false;
+    for (int i = 0; i < game->count; i++)
+        game->moves[i] = (unsigned short)(moves[i * 2] | (moves[i * 2 + 1] << 8));
+    return true;
+}
+
+// ### Set up the start position of a binary game and play all of its moves ###
+// The moves were legal when they were written, so they are played without checking them again
+void binaryReplayGame(const T_BinaryGame* game) {
+    newGame();
+    if (game->startFEN[0]) loadFEN(game->startFEN);
+    for (int i = 0; i < game->count; i++)
+        playMove(decodeMove(game->moves[i]));
+}
+
+// ### Convert a PGN file to the binary format (main.exe --pgn2bin games.pgn games.bin) ###
+int convertPgnToBinary(const char* pgnName, const char* binName) {
+    FILE* pgn = fopen(pgnName, "rb");
+    FILE* out = binaryCreate(binName);
+    if (!pgn || !out) {
+        printf("Cannot open %s or create %s\n", pgnName, binName);
+        if (pgn) fclose(pgn);
+        if (out) fclose(out);
+        return 1;
+    }
+    T_PgnReader* reader = malloc(sizeof(T_PgnReader));
+    T_PgnGame* game = malloc(sizeof(T_PgnGame));
+    T_BinaryGame* binary = malloc(sizeof(T_BinaryGame));
+    pgnReaderInit(reader, pgn, -1);
+    long games = 0, skipped = 0;
+    while (pgnReadGame(reader, game)) {
+        if (game->error || game->plies > MAX_GAME_PLIES) { skipped++; continue; } // Only games that replay cleanly and fit go into the archive
+        strcpy(binary->startFEN, game->startFEN);
+        binary->count = game->plies;
+        memcpy(binary->moves, game->moves, game->plies * sizeof(unsigned short));
+        binary->result = strcmp(game->result, "1-0") == 0 ? 1 : strcmp(game->result, "0-1") == 0 ? 2 : strcmp(game->result, "1/2-1/2") == 0 ? 3 : 0;
+        binaryWriteGame(out, binary);
+        games++;
+    }
+    printf("%ld games written to %s (%ld skipped because of errors)\n", games, binName, skipped);
+    free(binary);
+    free(game);
+    free(reader);
+    fclose(pgn);
+    fclose(out);
+    return 0;
+}
+
+// ### Replay every game of a binary file and report the speed (main.exe --bin games.bin) ###
+int replayBinaryFile(const char* filename) {
+    FILE* file = binaryOpen(filename);
+    if (!file) return 1;
+    T_BinaryGame* game = malloc(sizeof(T_BinaryGame));
+    long games = 0, plies = 0;
+    DWORD start = GetTickCount();
+    while (binaryReadGame(file, game)) {
+        binaryReplayGame(game);
+        games++;
+        plies += game->count;
+    }
+    double seconds = (GetTickCount() - start) / 1000.0;
+    if (seconds <= 0) seconds = 0.001;
+    printf("%ld games, %ld plies in %.2f s (%.0f games/s, %.0f plies/s)\n", games, plies, seconds, games / seconds, plies / seconds);
+    free(game);
+    fclose(file);
+    return 0;
+}
+
+// ### Order position database entries by key, then move ###
+int compareDbEntries(const void* a, const void* b) {
+    const T_DbEntry* x = (const T_DbEntry*)a;
+    const T_DbEntry* y = (const T_DbEntry*)b;
+    if (x->key != y->key) return x->key < y->key ? -1 : 1;
+    return (int)x->move - (int)y->move;
+}
+
+// ### Add the counts of another entry for the same position and move ###
+void mergeDbEntry(T_DbEntry* into, const T_DbEntry* from) {
+    into->whiteWins += from->whiteWins;
+    into->draws += from->draws;
+    into->blackWins += from->blackWins;
+    into->games += from->games;
+    if (from->firstGame < into->firstGame) into->firstGame = from->firstGame;
+}
+
+// ### Sort a run of entries and merge equal position/move pairs; returns how many are left ###
+size_t sortDbRun(T_DbEntry* entries, size_t count) {
+    qsort(entries, count, sizeof(T_DbEntry), compareDbEntries);
+    size_t merged = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (merged && compareDbEntries(&entries[merged - 1], &entries[i]) == 0) mergeDbEntry(&entries[merged - 1], &entries[i]);
+        else entries[merged++] = entries[i];
+    }
+    return merged;
+}
+
+// ### Build the position database from a binary game file (main.exe --build-db games.bin positions.db) ###
+// Every position of every game becomes one entry. Entries are collected in runs of DB_RUN_ENTRIES; every full run is sorted,
+// merged and written to a temporary file, and at the end all runs are merged into the database in one pass.
+// So the memory used stays the same for any number of games, only the disk space grows.
+int buildPositionDatabase(const char* gamesName, const char* dbName) {
+    FILE* games = binaryOpen(gamesName);
+    if (!games) return 1;
+    T_DbEntry* entries = malloc(DB_RUN_ENTRIES * sizeof(T_DbEntry));
+    T_BinaryGame* game = malloc(sizeof(T_BinaryGame));
+    if (!entries || !game) { printf("Out of memory\n"); free(entries); free(game); fclose(games); return 1; }
+    size_t count = 0;                // Entries in the current run
+    unsigned long long positions = 0;
+    int runs = 0;
+    char runName[300];
+    unsigned int gameIndex = 0;
+    bool ok = true;
+    DWORD start = GetTickCount();
+    while (ok && binaryReadGame(games, game)) {
+        newGame();
+        if (game->startFEN[0]) loadFEN(game->startFEN);
+        for (int i = 0; i < game->count && ok; i++) {
+            if (count == DB_RUN_ENTRIES) { // Run full: sort it and move it out to disk
+                count = sortDbRun(entries, count);
+                snprintf(runName, sizeof(runName), "%s.run%03d", dbName, runs);
+                FILE* run = runs < DB_MAX_RUNS ? fopen(runName, "wb") : NULL;
+                if (!run || fwrite(entries, sizeof(T_DbEntry), count, run) != count) {
+                    printf("Cannot write %s\n", runs < DB_MAX_RUNS ? runName : "more runs, the game file is too big");
+                    ok = false;
+                }
+                if (run && fclose(run) != 0) ok = false;
+                runs++;
+                count = 0;
+                if (!ok) break;
+            }
+            T_DbEntry* e = &entries[count++];
+            memset(e, 0, sizeof(*e));
+            e->key = polyglotHash(board, currentPlayer); // The Polyglot key, so the database can be written out as a book
+            e->move = game->moves[i];
+            e->whiteWins = game->result == 1;
+            e->draws = game->result == 3;
+            e->blackWins = game->result == 2;
+            e->games = 1; // Games with an unknown result count too
+            e->firstGame = gameIndex;
+            playMove(decodeMove(game->moves[i]));
+            positions++;
+        }
+        gameIndex++;
+    }
+    fclose(games);
+    free(game);
+    count = sortDbRun(entries, count);
+
+    FILE* out = ok ? fopen(dbName, "wb") : NULL;
+    if (ok && !out) { printf("Cannot create %s\n", dbName); ok = false; }
+    unsigned long long merged = 0;
+    if (ok) {
+        // Header as big as one entry so entries stay aligned in the mapped file; the count is filled in at the end
+        unsigned char header[sizeof(T_DbEntry)] = { 0 };
+        memcpy(header, DB_MAGIC, 8);
+        fwrite(header, 1, sizeof(header), out);
+    }
+    if (ok && runs == 0) { // Everything fitted in one run, it is already the database
+        merged = count;
+        if (fwrite(entries, sizeof(T_DbEntry), count, out) != count) ok = false;
+    } else if (ok) { // Merge the runs: the last one stays in memory, the others are read back one entry at a time
+        FILE* files[DB_MAX_RUNS];
+        T_DbEntry heads[DB_MAX_RUNS + 1];
+        bool live[DB_MAX_RUNS + 1];
+        size_t memoryNext = 0;
+        for (int r = 0; r < runs; r++) {
+            snprintf(runName, sizeof(runName), "%s.run%03d", dbName, r);
+            files[r] = fopen(runName, "rb");
+            live[r] = files[r] && fread(&heads[r], sizeof(T_DbEntry), 1, files[r]) == 1;
+            if (!files[r]) { printf("Cannot read %s\n", runName); ok = false; }
+        }
+        live[runs] = count > 0;
+        if (live[runs]) heads[runs] = entries[memoryNext++];
+        T_DbEntry pending;
+        bool hasPending = false;
+        while (ok) {
+            int smallest = -1;
+            for (int r = 0; r <= runs; r++)
+                if (live[r] && (smallest < 0 || compareDbEntries(&heads[r], &heads[smallest]) < 0)) smallest = r;
+            if (smallest < 0) break;
+            if (hasPending && compareDbEntries(&pending, &heads[smallest]) == 0) mergeDbEntry(&pending, &heads[smallest]);
+            else {
+                if (hasPending && fwrite(&pending, sizeof(T_DbEntry), 1, out) != 1) ok = false;
+                if (hasPending) merged++;
+                pending = heads[smallest];
+                hasPending = true;
+            }
+            if (smallest == runs) { // Next entry of the run in memory
+                live[runs] = memoryNext < count;
+                if (live[runs]) heads[runs] = entries[memoryNext++];
+            } else live[smallest] = fread(&heads[smallest], sizeof(T_DbEntry), 1, files[smallest]) == 1;
+        }
+        if (ok && hasPending) { ok = fwrite(&pending, sizeof(T_DbEntry), 1, out) == 1; merged++; }
+        for (int r = 0; r < runs; r++) {
+            if (files[r]) fclose(files[r]);
+            snprintf(runName, sizeof(runName), "%s.run%03d", dbName, r);
+            remove(runName);
+        }
+    }
+    free(entries);
+    if (out) {
+        if (ok) { // Now the number of entries is known
+            fseek(out, 8, SEEK_SET);
+            ok = fwrite(&merged, sizeof(merged), 1, out) == 1;
+        }
+        if (fclose(out) != 0) ok = false;
+        if (!ok) remove(dbName); // Never leave a truncated database behind
+    }
+    if (!ok) {
+        for (int r = 0; r < runs && r < DB_MAX_RUNS; r++) { snprintf(runName, sizeof(runName), "%s.run%03d", dbName, r); remove(runName); }
+        printf("Building %s failed\n", dbName);
+        return 1;
+    }
+    printf("%u games, %llu positions, %llu distinct position/move pairs written to %s in %.2f s (%d runs)\n",
+           gameIndex, positions, merged, dbName, (GetTickCount() - start) / 1000.0, runs + 1);
+    return 0;
+}
+
+// ### Map the position database, if there is one ###
+bool databaseOpen(const char* filename) {
+    size_t size = 0;
+    const unsigned char* data = mapFile(filename, &size);
+    if (!data) {
+        FILE* file = fopen(filename, "rb");
+        if (file) { // It is there but could not be mapped, a 32-bit build has room for about 1 GB
+            fclose(file);
+            printf("Cannot map %s, it is too big for this build (use a 64-bit build)\n", filename);
+        }
+        return false;
+    }
+    if (size < sizeof(T_DbEntry) || memcmp(data, DB_MAGIC, 8) != 0) {
+        printf("%s is not a position database\n", filename);
+        unmapFile(data);
+        return false;
+    }
+    dbEntries = (const T_DbEntry*)(data + sizeof(T_DbEntry)); // Skip the header
+    dbCount = (size - sizeof(T_DbEntry)) / sizeof(T_DbEntry);
+    printf("Position database %s: %lu position/move pairs\n", filename, (unsigned long)dbCount);
+    return true;
+}
+
+// ### Find all moves played from a position: binary search straight in the mapped file ###
+// Returns the number of entries and points first at the first one; they are sorted by move
+int databaseProbe(unsigned long long key, const T_DbEntry** first) {
+    size_t lo = 0, hi = dbCount;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (dbEntries[mid].key < key) lo = mid + 1;
+        else hi = mid;
+    }
+    size_t end = lo;
+    while (end < dbCount && dbEntries[end].key == key) end++;
+    *first = dbEntries + lo;
+    return (int)(end - lo);
+}
+
+// ### Turn the position database into an opening book for the trainer (main.exe --make-book positions.db book.bin) ###
+// Moves played in fewer than minGames games are left out
+int databaseToBook(const char* dbName, const char* bookName, int minGames) {
+    if (!databaseOpen(dbName)) return 1;
+    FILE* out = fopen(bookName, "wb");
+    if (!out) { printf("Cannot create %s\n", bookName); return 1; }
+    long written = 0;
+    for (size_t i = 0; i < dbCount; i++) { // Already sorted by Polyglot key, which is the order the book needs
+        const T_DbEntry* e = &dbEntries[i];
+        unsigned int games = e->games;
+        if (games < (unsigned int)minGames) continue;
+        T_Move m = decodeMove(e->move);
+        // Polyglot move bits: to file, to rank, from file, from rank (rank 0 is our row 7), promotion
+        int move = m.toCol | ((7 - m.toRow) << 3) | (m.fromCol << 6) | ((7 - m.fromRow) << 9);
+        unsigned char entry[16];
+        for (int b = 0; b < 8; b++) entry[b] = (unsigned char)(e->key >> (56 - 8 * b)); // Big endian
+        entry[8] = (unsigned char)(move >> 8);
+        entry[9] = (unsigned char)move;
+        entry[10] = (unsigned char)((games > 65535 ? 65535 : games) >> 8);
+        entry[11] = (unsigned char)(games > 65535 ? 65535 : games);
+        memset(entry + 12, 0, 4);
+        fwrite(entry, 1, 16, out);
+        written++;
+    }
+    fclose(out);
+    printf("%ld book moves written to %s\n", written, bookName);
+    return 0;
+}
+
+// ### Pack a position into 32 bytes ###
+// Board, side to move, castling rights, en passant column and move counters come from the given state, score and result from the caller
+void packPosition(const T_GameState* state, int score, int result, T_PackedPosition* out) {
+    packBoards(state, 1, out);
+    out->score = (short)score;
+    out->result = (unsigned char)result;
+}
+
+// ### Restore the game state from a packed position ###
+void unpackPosition(const T_PackedPosition* in) {
+    T_GameState state;
+    unpackBoards(in, 1, &state.board);
+    state.currentPlayer = in->flags & 1;
+    state.castling[2] = !(in->flags & 2);
+    state.castling[3] = !(in->flags & 4);
+    state.castling[4] = !(in->flags & 8);
+    state.castling[5] = !(in->flags & 16);
+    state.castling[0] = state.castling[2] && state.castling[3]; // A king that lost both rights counts as moved
+    state.castling[1] = state.castling[4] && state.castling[5];
+    state.enPassantCol = in->enPassant;
+    state.halfmoveClock = in->halfmoveClock;
+    state.fullmoveNumber = in->fullmoveNumber;
+    restoreGameState(&state);
+}
+
+// ### Pack many positions at once, each with its own side to move, castling rights, en passant column and counters ###
+// With SSE2 16 squares at a time become 4-bit codes and occupancy bits; only gathering the codes of occupied squares stays scalar
+void packBoards(const T_GameState states[], int count, T_PackedPosition out[]) {
+    for (int i = 0; i < count; i++) {
+        const T_GameState* state = &states[i];
+        T_PackedPosition* packed = &out[i];
+        memset(packed, 0, sizeof(*packed));
+        unsigned char codes[64]; // Color in bit 3, piece in bits 0-2, 0 = empty
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+        const int* cells = &state->board[0][0];
+        const __m128i ten = _mm_set1_epi8(10), two = _mm_set1_epi8(2), zero = _mm_setzero_si128();
+        for (int sq = 0; sq < 64; sq += 16) {
+            __m128i low = _mm_packs_epi32(_mm_loadu_si128((const __m128i*)(cells + sq)), _mm_loadu_si128((const __m128i*)(cells + sq + 4)));
+            __m128i high = _mm_packs_epi32(_mm_loadu_si128((const __m128i*)(cells + sq + 8)), _mm_loadu_si128((const __m128i*)(cells + sq + 12)));
+            __m128i values = _mm_packus_epi16(low, high); // 16 board values as bytes
+            values = _mm_sub_epi8(values, _mm_and_si128(_mm_cmpgt_epi8(values, ten), two)); // Black 11-16 becomes 9-14
+            _mm_storeu_si128((__m128i*)(codes + sq), values);
+            packed->occupancy |= (unsigned long long)(_mm_movemask_epi8(_mm_cmpeq_epi8(values, zero)) ^ 0xFFFF) << sq;
+        }
+#else
+        for (int sq = 0; sq < 64; sq++) {
+            int val = state->board[sq / 8][sq % 8];
+            codes[sq] = (unsigned char)((val / 10) << 3 | (val % 10));
+            if (val) packed->occupancy |= 1ULL << sq;
+        }
+#endif
+        for (int sq = 0, n = 0; sq < 64; sq++) {
+            if (!codes[sq]) continue;
+            if (n == 32) { packed->occupancy &= ~(1ULL << sq); continue; } // A legal position never has more than 32 pieces
+            packed->pieces[n / 2] |= (unsigned char)(codes[sq] << ((n & 1) * 4));
+            n++;
+        }
+        packed->flags = (unsigned char)(state->currentPlayer
+            | (!state->castling[0] && !state->castling[2]) << 1 | (!state->castling[0] && !state->castling[3]) << 2
+            | (!state->castling[1] && !state->castling[4]) << 3 | (!state->castling[1] && !state->castling[5]) << 4);
+        packed->enPassant = (signed char)state->enPassantCol;
+        packed->halfmoveClock = (unsigned char)(state->halfmoveClock > 255 ? 255 : state->halfmoveClock);
+        packed->fullmoveNumber = (unsigned short)state->fullmoveNumber;
+    }
+}
+
+// ### Decode only the boards of many packed positions ###
+// The n-th code goes to the n-th occupied square, then SSE2 widens 16 codes at a time into board values
+void unpackBoards(const T_PackedPosition in[], int count, int boards[][8][8]) {
+    for (int i = 0; i < count; i++) {
+        int* cells = &boards[i][0][0];
+        unsigned long long occupancy = in[i].occupancy;
+        unsigned char codes[64];
+        for (int sq = 0, n = 0; sq < 64; sq++) {
+            if (!((occupancy >> sq) & 1)) { codes[sq] = 0; continue; }
+            codes[sq] = (in[i].pieces[n / 2] >> ((n & 1) * 4)) & 15;
+            n++;
+        }
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+        const __m128i eight = _mm_set1_epi8(8), two = _mm_set1_epi8(2), zero = _mm_setzero_si128();
+        for (int sq = 0; sq < 64; sq += 16) {
+            __m128i values = _mm_loadu_si128((const __m128i*)(codes + sq));
+            values = _mm_add_epi8(values, _mm_and_si128(_mm_cmpgt_epi8(values, eight), two)); // Black 9-14 becomes 11-16
+            __m128i low = _mm_unpacklo_epi8(values, zero), high = _mm_unpackhi_epi8(values, zero);
+            _mm_storeu_si128((__m128i*)(cells + sq), _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128((__m128i*)(cells + sq + 4), _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128((__m128i*)(cells + sq + 8), _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128((__m128i*)(cells + sq + 12), _mm_unpackhi_epi16(high, zero));
+        }
+#else
+        for (int sq = 0; sq < 64; sq++) cells[sq] = (codes[sq] >> 3) * 10 + (codes[sq] & 7);
+#endif
+    }
+}
+
+// ### Start a sharded dataset: prefix-000.bin, prefix-001.bin, ... with at most perShard positions each ###
+void shardWriterOpen(T_ShardWriter* writer, const char* prefix, long perShard) {
+    strncpy(writer->prefix, prefix, sizeof(writer->prefix) - 1);
+    writer->prefix[sizeof(writer->prefix) - 1] = '\0';
+    writer->perShard = perShard;
+    writer->shard = -1;
+    writer->inShard = 0;
+    writer->total = 0;
+    writer->file = NULL;
+}
+
+// ### Append packed positions, moving on to the next shard file when the current one is full ###
+bool shardWrite(T_ShardWriter* writer, const T_PackedPosition positions[], int count) {
+    while (count > 0) {
+        if (!writer->file || writer->inShard == writer->perShard) {
+            char name[300];
+            if (writer->file) fclose(writer->file);
+            sprintf(name, "%s-%03d.bin", writer->prefix, ++writer->shard);
+            writer->file = fopen(name, "wb");
+            if (!writer->file) { printf("Cannot create %s\n", name); return false; }
+            setvbuf(writer->file, NULL, _IOFBF, 1 << 20);
+            writer->inShard = 0;
+        }
+        long room = writer->perShard - writer->inShard;
+        int n = count < room ? count : (int)room;
+        fwrite(positions, sizeof(T_PackedPosition), n, writer->file);
+        writer->inShard += n;
+        writer->total += n;
+        positions += n;
+        count -= n;
+    }
+    return true;
+}
+
+// ### Finish the current shard ###
+void shardWriterClose(T_ShardWriter* writer) {
+    if (writer->file) fclose(writer->file);
+    writer->file = NULL;
+}
+
+// ### Turn every position of a binary game file into packed training positions (main.exe --pack games.bin prefix) ###
+int packGamesToShards(const char* gamesName, const char* prefix) {
+    FILE* games = binaryOpen(gamesName);
+    if (!games) return 1;
+    T_BinaryGame* game = malloc(sizeof(T_BinaryGame));
+    T_PackedPosition* batch = malloc(MAX_GAME_PLIES * sizeof(T_PackedPosition)); // One game at a time
+    T_ShardWriter writer;
+    shardWriterOpen(&writer, prefix, SHARD_POSITIONS);
+    DWORD start = GetTickCount();
+    while (binaryReadGame(games, game)) {
+        newGame();
+        if (game->startFEN[0]) loadFEN(game->startFEN);
+        for (int i = 0; i < game->count; i++) {
+            T_GameState state;
+            saveGameState(&state);
+            packPosition(&state, 0, game->result, &batch[i]); // No evaluator yet, so the score stays 0
+            playMove(decodeMove(game->moves[i]));
+        }
+        if (!shardWrite(&writer, batch, game->count)) break;
+    }
+    shardWriterClose(&writer);
+    double seconds = (GetTickCount() - start) / 1000.0;
+    if (seconds <= 0) seconds = 0.001;
+    printf("%ld positions (%lu bytes each) in %d shards, %.2f s (%.0f positions/s)\n",
+           writer.total, (unsigned long)sizeof(T_PackedPosition), writer.shard + 1, seconds, writer.total / seconds);
+    free(batch);
+    free(game);
+    fclose(games);
+    return 0;
+}
+
+// ### Parse one EPD line: 4 FEN fields, optional move counters, then "opcode operand;" pairs ###
+// Understood opcodes: id, bm, am and D1-D8 (expected perft counts); returns false for blank or broken lines
+bool epdParse(const char* line, T_EpdPosition* pos) {
+    memset(pos, 0, sizeof(*pos));
+    const char* p = line;
+    while (*p == ' ' || *p == '\t') p++;
+    int fields = 0, n = 0;
+    for (; *p && *p != ';' && *p != '\r' && *p != '\n' && n < FEN_MAX - 1; p++) { // Copy the four position fields
+        if (*p == ' ' && ++fields == 4) break;
+        pos->fen[n++] = *p;
+    }
+    pos->fen[n] = '\0';
+    if (fields < 4) return false;
+    // Full FEN lines also carry the move counters before the opcodes
+    while (*p == ' ') p++;
+    if (*p >= '0' && *p <= '9') {
+        int halfmoves = (int)strtol(p, (char**)&p, 10), fullmoves = (int)strtol(p, (char**)&p, 10);
+        sprintf(pos->fen + n, " %d %d", halfmoves, fullmoves);
+    }
+
+    while (*p) { // Operations separated by ';'
+        while (*p == ' ' || *p == ';' || *p == '\t') p++;
+        if (!*p || *p == '\r' || *p == '\n') break;
+        char opcode[16];
+        int o = 0;
+        while (*p && *p != ' ' && *p != ';' && o < 15) opcode[o++] = *p++;
+        opcode[o] = '\0';
+        while (*p == ' ') p++;
+        const char* operand = p;
+        bool quoted = *p == '"';
+        if (quoted) { operand = ++p; while (*p && *p != '"') p++; }
+        else while (*p && *p != ';' && *p != '\r' && *p != '\n') p++;
+        int length = (int)(p - operand);
+        if (quoted && *p) p++;
+        while (length > 0 && operand[length - 1] == ' ') length--;
+
+        if (strcmp(opcode, "id") == 0) {
+            if (length > (int)sizeof(pos->id) - 1) length = sizeof(pos->id) - 1;
+            memcpy(pos->id, operand, length);
+            pos->id[length] = '\0';
+        } else if (strcmp(opcode, "bm") == 0 || strcmp(opcode, "am") == 0) {
+            // Space separated SAN moves, kept as one string and split when checked
+            char* target = opcode[0] == 'b' ? pos->bestMoves : pos->avoidMoves;
+            if (length > EPD_MOVES_MAX - 1) length = EPD_MOVES_MAX - 1;
+            memcpy(target, operand, length);
+            target[length] = '\0';
+        } else if (opcode[0] == 'D' && opcode[1] >= '1' && opcode[1] <= '0' + EPD_MAX_DEPTH && !opcode[2]) {
+            pos->perft[opcode[1] - '0'] = strtoll(operand, NULL, 10);
+            if (opcode[1] - '0' > pos->maxDepth) pos->maxDepth = opcode[1] - '0';
+        }
+    }
+    return true;
+}
+
+// ### Check one EPD position: perft counts depth by depth within the node budget, bm/am by a search within the node and time budget ###
+void epdRunPosition(T_EpdPosition* pos, T_SearchState* search, long long nodeBudget, DWORD timeBudget) {
+    DWORD start = GetTickCount();
+    pos->solvedNodes = -1;
+    if (!loadFEN(pos->fen)) { pos->status = EPD_FAILED; strcpy(pos->detail, "bad FEN"); return; }
+    T_GameState state;
+    saveGameState(&state);
+    pos->status = EPD_UNSUPPORTED; // Until something can actually be checked
+    for (int depth = 1; depth <= pos->maxDepth; depth++) {
+        if (!pos->perft[depth]) continue;
+        if (pos->nodes + pos->perft[depth] > nodeBudget) { sprintf(pos->detail, "D%d over node budget", depth); break; }
+        long long nodes = perft(depth);
+        restoreGameState(&state);
+        pos->nodes += nodes;
+        pos->depthReached = depth;
+        if (nodes != pos->perft[depth]) {
+            pos->status = EPD_FAILED;
+            sprintf(pos->detail, "D%d: %lld, expected %lld", depth, nodes, pos->perft[depth]);
+            break;
+        }
+        pos->status = EPD_PASSED;
+    }
+    // Every move the suite names must be legal here, then they are resolved once for judging the search
+    T_Move named[2][16];
+    int namedCount[2] = { 0, 0 };
+    for (int list = 0; list < 2 && pos->status != EPD_FAILED; list++) {
+        const char* p = list == 0 ? pos->bestMoves : pos->avoidMoves;
+        while (*p) { // Split by hand, strtok is not safe with several workers
+            char san[PGN_TOKEN_MAX];
+            int n = 0;
+            while (*p == ' ') p++;
+            while (*p && *p != ' ' && n < PGN_TOKEN_MAX - 1) san[n++] = *p++;
+            san[n] = '\0';
+            if (!n) break;
+            T_Move move;
+            if (!sanToMove(san, &move)) {
+                pos->status = EPD_FAILED;
+                sprintf(pos->detail, "%s %s is not legal", list == 0 ? "bm" : "am", san);
+                break;
+            }
+            if (move.promotion == 0) move.promotion = 3; // 0 also means a queen
+            if (namedCount[list] < 16) named[list][namedCount[list]++] = move;
+        }
+    }
+    if (pos->status == EPD_FAILED || (!namedCount[0] && !namedCount[1])) { pos->ms = GetTickCount() - start; return; }
+
+    // Search like a game move and judge every finished depth: the right move is in bm (if given) and not in am
+    long long searchBudget = nodeBudget - pos->nodes;
+    if (searchBudget <= 0) { strcpy(pos->detail, "bm/am over node budget"); pos->ms = GetTickCount() - start; return; }
+    long long hits = search->evalHits, misses = search->evalMisses;
+    searchBestMove(search, searchBudget, timeBudget);
+    restoreGameState(&state);
+    pos->nodes += search->nodes;
+    pos->evalHits = search->evalHits - hits;
+    pos->evalMisses = search->evalMisses - misses;
+    pos->searchDepth = search->depthReached;
+    bool solved = false;
+    for (int depth = search->depthReached; depth >= 0; depth--) { // Walk back to the depth from which the answer never changed
+        T_Move move = depth ? search->depthMoves[depth] : search->bestMove;
+        if (move.promotion == 0) move.promotion = 3;
+        bool good = namedCount[0] == 0;
+        for (int list = 0; list < 2; list++)
+            for (int i = 0; i < namedCount[list]; i++)
+                if (move.fromRow == named[list][i].fromRow && move.fromCol == named[list][i].fromCol && move.toRow == named[list][i].toRow &&
+                    move.toCol == named[list][i].toCol && (board[move.fromRow][move.fromCol] % 10 != 1 || move.promotion == named[list][i].promotion))
+                    good = list == 0;
+        if (depth == search->depthReached) solved = good; // Before depth 1 finished only the seeded first move is known
+        if (!good || !solved || depth == 0) break;
+        pos->solvedNodes = search->depthNodes[depth];
+        pos->solvedMs = search->depthMs[depth];
+    }
+    if (search->bestMove.fromRow >= 0 && search->bestMove.fromRow < 8) moveToSAN(board, currentPlayer, search->bestMove, pos->played);
+    if (!solved) {
+        pos->status = EPD_FAILED;
+        pos->solvedNodes = -1;
+        sprintf(pos->detail, "played %s at depth %d", pos->played[0] ? pos->played : "nothing", pos->searchDepth);
+    } else if (pos->solvedNodes < 0) { // Right only by the seeded move, no depth finished to back it up
+        pos->status = EPD_FAILED;
+        sprintf(pos->detail, "no depth finished within the budget");
+    } else if (pos->status != EPD_FAILED) pos->status = EPD_PASSED;
+    pos->ms = GetTickCount() - start;
+}
+
+// ### Worker thread: take the next EPD position until the suite is done ###
+DWORD WINAPI epdWorker(LPVOID param) {
+    T_EpdSuite* suite = (T_EpdSuite*)param;
+    T_SearchState* search = malloc(sizeof(T_SearchState)); // Too big for the stack, allocated once per worker
+    if (!search) return 1;
+    if (!searchCacheInit(search, evalCacheEntries)) { free(search); return 1; }
+    for (;;) {
+        int index = (int)InterlockedIncrement(&suite->next) - 1;
+        if (index >= suite->count) break;
+        epdRunPosition(&suite->positions[index], search, suite->nodeBudget, suite->timeBudget);
+    }
+    searchCacheFree(search);
+    free(search);
+    return 0;
+}
+
+// ### Copy a string into a JSON string value, escaping quotes, backslashes and control characters ###
+void jsonEscape(const char* text, char* out, int size) {
+    int n = 0;
+    for (const unsigned char* p = (const unsigned char*)text; *p && n < size - 7; p++) { // Room for the longest escape plus terminator
+        if (*p == '"' || *p == '\\') { out[n++] = '\\'; out[n++] = (char)*p; }
+        else if (*p < 0x20) n += sprintf(out + n, "\\u%04x", *p);
+        else out[n++] = (char)*p;
+    }
+    out[n] = '\0';
+}
+
+// ### Run an EPD suite on all cores and print one JSON line per position plus a summary (main.exe --epd suite.epd [--nodes N] [--movetime ms] [--evalcache N]) ###
+int runEpdSuite(const char* filename, int threads, long long nodeBudget, DWORD timeBudget) {
+    FILE* file = fopen(filename, "r");
+    if (!file) { printf("Cannot open %s\n", filename); return 1; }
+    T_EpdSuite suite = { NULL, 0, 0, nodeBudget, timeBudget };
+    int capacity = 0;
+    char line[1024];
+    while (fgets(line, sizeof(line), file)) {
+        if (suite.count == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            suite.positions = realloc(suite.positions, capacity * sizeof(T_EpdPosition));
+        }
+        if (epdParse(line, &suite.positions[suite.count])) suite.count++;
+    }
+    fclose(file);
+
+    if (threads <= 0) {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        threads = (int)info.dwNumberOfProcessors;
+    }
+    if (threads > PGN_MAX_THREADS) threads = PGN_MAX_THREADS;
+    egtOpen("endgame.egt"); // Optional: mapped once and read by every worker, the search probes it in the endings it covers
+    zobristInit(); // Keys of the evaluation caches
+    DWORD start = GetTickCount();
+    HANDLE workers[PGN_MAX_THREADS];
+    for (int i = 0; i < threads; i++)
+        workers[i] = CreateThread(NULL, 0, epdWorker, &suite, 0, NULL);
+    for (int i = 0; i < threads; i++) {
+        WaitForSingleObject(workers[i], INFINITE);
+        CloseHandle(workers[i]);
+    }
+    DWORD elapsed = GetTickCount() - start;
+
+    // Report in suite order, one JSON object per line so dashboards can read it line by line
+    static const char* statusNames[] = { "unsupported", "pass", "fail" };
+    int passed = 0, failed = 0, unsupported = 0, searched = 0, solved = 0;
+    long long nodes = 0, solvedNodes = 0, evalHits = 0, evalMisses = 0;
+    DWORD solvedMs = 0;
+    for (int i = 0; i < suite.count; i++) {
+        T_EpdPosition* pos = &suite.positions[i];
+        char id[sizeof(pos->id) * 6], detail[sizeof(pos->detail) * 6]; // Worst case every byte becomes \u00XX
+        jsonEscape(pos->id, id, sizeof(id));
+        jsonEscape(pos->detail, detail, sizeof(detail));
+        printf("{\"index\":%d,\"id\":\"%s\",\"status\":\"%s\",\"depth\":%d,\"nodes\":%lld,\"ms\":%lu",
+               i, id, statusNames[pos->status], pos->depthReached, pos->nodes, (unsigned long)pos->ms);
+        if (pos->played[0]) { // bm/am positions also report the search
+            printf(",\"move\":\"%s\",\"searchDepth\":%d,\"solved\":%s", pos->played, pos->searchDepth, pos->solvedNodes >= 0 ? "true" : "false");
+            if (pos->solvedNodes >= 0) printf(",\"solvedNodes\":%lld,\"solvedMs\":%lu", pos->solvedNodes, (unsigned long)pos->solvedMs);
+            searched++;
+            if (pos->solvedNodes >= 0) { solved++; solvedNodes += pos->solvedNodes; solvedMs += pos->solvedMs; }
+        }
+        printf(",\"detail\":\"%s\"}\n", detail);
+        if (pos->status == EPD_PASSED) passed++;
+        else if (pos->status == EPD_FAILED) failed++;
+        else unsupported++;
+        nodes += pos->nodes;
+        evalHits += pos->evalHits;
+        evalMisses += pos->evalMisses;
+    }
+    // solveRate counts only the bm/am positions, the average time to solution only the solved ones
+    printf("{\"summary\":true,\"positions\":%d,\"passed\":%d,\"failed\":%d,\"unsupported\":%d,\"searched\":%d,\"solved\":%d,\"solveRate\":%.3f,"
+           "\"avgSolvedNodes\":%.0f,\"avgSolvedMs\":%.1f,\"nodes\":%lld,\"ms\":%lu,\"nps\":%.0f,\"threads\":%d,"
+           "\"evalCacheEntries\":%u,\"evalHits\":%lld,\"evalMisses\":%lld,\"evalHitRate\":%.3f}\n",
+           suite.count, passed, failed, unsupported, searched, solved, searched ? (double)solved / searched : 0.0,
+           solved ? (double)solvedNodes / solved : 0.0, solved ? (double)solvedMs / solved : 0.0,
+           nodes, (unsigned long)elapsed, nodes / (elapsed ? elapsed / 1000.0 : 0.001), threads,
+           evalCacheEntries, evalHits, evalMisses, evalHits + evalMisses ? (double)evalHits / (evalHits + evalMisses) : 0.0);
+    free(suite.positions);
+    return failed ? 1 : 0;
+}
+
+// ### Score the position for the side to move: material plus a small bonus for advanced pawns and central pieces ###
+// King and pawn against king is scored from the bitbase: 0 when drawn, a bonus for the pawn side when won
+int evaluate(void) {
+    static const int values[7] = { 0, 100, 0, 900, 500, 330, 320 }; // Indexed by piece code, the king is not counted
+    int score = 0, pieces = 0;
+    int kings[2] = { 0, 0 }, pawn = 0; // Squares as row * 8 + col, only used for KPK
+    for (int row = 0; row < 8; row++)
+        for (int col = 0; col < 8; col++) {
+            int val = board[row][col];
+            if (!val) continue;
+            pieces++;
+            if (val % 10 == 2) kings[val / 10] = row * 8 + col;
+            else if (val % 10 == 1) pawn = row * 8 + col;
+            int piece = val % 10, sign = val / 10 == currentPlayer ? 1 : -1;
+            int bonus = piece == 1 ? 5 * (val / 10 ? row - 1 : 6 - row)                     // Pawns are worth more the further they got
+                      : piece >= 5 ? 10 - 3 * (abs(2 * row - 7) + abs(2 * col - 7)) / 2 : 0; // Bishops and knights like the centre
+            score += sign * (values[piece] + bonus);
+        }
+    if (pieces == 3) { // Only then can it be KPK
+        int winner, result = probeKPK(board, currentPlayer, &winner);
+        if (result == 0) return 0; // Drawn however far the pawn got
+        if (result == 1) { // The pawn bonus rewards pushing, the king is drawn to the square in front of the pawn so it can escort it
+            int front = pawn + (winner ? 8 : -8), king = kings[winner];
+            int distance = abs(king / 8 - front / 8) > abs(king % 8 - front % 8) ? abs(king / 8 - front / 8) : abs(king % 8 - front % 8);
+            int bonus = KPK_WIN_BONUS - 10 * distance;
+            score += winner == currentPlayer ? bonus : -bonus;
+        }
+    }
+    return score;
+}
+
+// ### Allocate the evaluation cache of a search thread (entries must be a power of two) ###
+bool searchCacheInit(T_SearchState* search, unsigned int entries) {
+    search->evalCache = calloc(entries, sizeof(T_EvalCacheEntry));
+    search->evalCacheMask = entries - 1;
+    search->evalHits = search->evalMisses = 0;
+    if (!search->evalCache) printf("Not enough memory for an evaluation cache of %u entries\n", entries);
+    return search->evalCache != NULL;
+}
+
+// ### Release the evaluation cache of a search thread ###
+void searchCacheFree(T_SearchState* search) {
+    free(search->evalCache);
+    search->evalCache = NULL;
+}
+
+// ### Score the position through the thread's evaluation cache ###
+// Transpositions reach the same leaves again and again; the hash costs less than a full evaluation
+int cachedEvaluate(T_SearchState* search) {
+    unsigned long long key = positionHash(board, currentPlayer);
+    T_EvalCacheEntry* entry = &search->evalCache[key & search->evalCacheMask]; // Direct-mapped: the low bits of the key pick the slot
+    if (entry->key == key) {
+        search->evalHits++;
+        return entry->score;
+    }
+    search->evalMisses++;
+    entry->key = key; // Replace whatever was there
+    entry->score = evaluate();
+    return entry->score;
+}
+
+// ### Exact score of the position from the endgame tables, for the side to move at ply ###
+// Returns false if no loaded table covers it. The tables know nothing about castling, so a side that may still castle is searched.
+bool probeSearchScore(int ply, int* score) {
+    if (!egtData) return false;
+    if ((!whiteKingMoved && (!whiteKingsideRookMoved || !whiteQueensideRookMoved)) ||
+        (!blackKingMoved && (!blackKingsideRookMoved || !blackQueensideRookMoved))) return false;
+    int winner, plies = probeEndgameTable(board, currentPlayer, &winner);
+    if (plies == -2) return false;
+    if (plies == -1) *score = 0;
+    else *score = winner == currentPlayer ? SEARCH_MATE - ply - plies : -SEARCH_MATE + ply + plies; // Mate scores, counted from the root
+    return true;
+}
+
+// ### Pick the root move of a table ending straight from the tables: the fastest mate, a move that keeps the draw, or the longest defence ###
+// The count root moves are in search->moves[0]. Returns false if some move leaves the tables for an ending they do not know.
+bool searchTableRoot(T_SearchState* search, int count, int* score) {
+    T_GameState saved;
+    saveGameState(&saved);
+    int best = -SEARCH_MATE - 1;
+    for (int i = 0; i < count; i++) {
+        T_Move move = search->moves[0][i];
+        playMove(move);
+        int child;
+        bool known = probeSearchScore(1, &child);
+        if (!known && isInsufficientMaterial(board)) { known = true; child = 0; } // A capture that leaves bare kings or a lone minor piece
+        restoreGameState(&saved);
+        if (!known) return false;
+        search->nodes++;
+        search->tableHits++;
+        if (-child > best) { best = -child; search->bestMove = move; }
+    }
+    *score = best;
+    return true;
+}
+
+// ### Alpha-beta search to a fixed depth, stopping once the node or time budget is used up ###
+// Works on the thread's own game state; every ply keeps its move list in the preallocated search state
+int searchPosition(T_SearchState* search, int depth, int alpha, int beta, int ply) {
+    if (++search->nodes >= search->nodeLimit) search->stopped = true;
+    if (search->timeLimit && (search->nodes & 1023) == 0 && GetTickCount() - search->startTime >= search->timeLimit)
+        search->stopped = true; // The clock is only read every 1024 nodes
+    if (search->stopped) return 0;
+    int tableScore;
+    if (ply > 0 && probeSearchScore(ply, &tableScore)) { search->tableHits++; return tableScore; } // Exact, no need to look further
+    if (depth == 0 || ply == SEARCH_MAX_PLY) return cachedEvaluate(search);
+    T_Move* moves = search->moves[ply];
+    int count = generateLegalMoves(board, currentPlayer, -1, -1, moves);
+    if (count == 0) return isInCheck(board, currentPlayer) ? -SEARCH_MATE + ply : 0; // Mate or stalemate
+    if (ply > 0 && (halfmoveClock >= 100 || isInsufficientMaterial(board))) return 0;
+
+    // Try the best move of the last iteration first, then captures with the biggest victim first
+    static const int victims[7] = { 0, 1, 0, 5, 4, 3, 3 }; // Capture order by piece code: queen, rook, minor pieces, pawn
+    int keys[256];
+    for (int i = 0; i < count; i++) {
+        keys[i] = victims[board[moves[i].toRow][moves[i].toCol] % 10];
+        if (ply == 0 && memcmp(&moves[i], &search->bestMove, sizeof(T_Move)) == 0) keys[i] = 100;
+    }
+    for (int i = 1; i < count; i++) // Insertion sort, lists are short
+        for (int j = i; j > 0 && keys[j] > keys[j - 1]; j--) {
+            T_Move move = moves[j]; moves[j] = moves[j - 1]; moves[j - 1] = move;
+            int key = keys[j]; keys[j] = keys[j - 1]; keys[j - 1] = key;
+        }
+
+    T_GameState saved;
+    saveGameState(&saved);
+    T_Move best = moves[0];
+    for (int i = 0; i < count; i++) {
+        playMove(moves[i]);
+        int score = -searchPosition(search, depth - 1, -beta, -alpha, ply + 1);
+        restoreGameState(&saved);
+        if (search->stopped) return 0;
+        if (score > alpha) {
+            alpha = score;
+            best = moves[i];
+            if (alpha >= beta) break;
+        }
+    }
+    if (ply == 0) search->bestMove = best;
+    return alpha;
+}
+
+// ### Find a move for the side to play: deeper and deeper searches until the node or time budget runs out ###
+// Returns the score of the last finished depth; bestMove holds its move (a legal move whenever there is one)
+int searchBestMove(T_SearchState* search, long long nodeLimit, DWORD timeLimit) {
+    search->nodes = 0;
+    search->nodeLimit = nodeLimit;
+    search->startTime = GetTickCount();
+    search->timeLimit = timeLimit;
+    search->stopped = false;
+    search->depthReached = 0;
+    search->tableHits = 0;
+    // Start from the first legal move, so there is a move to play even if the budget runs out before depth 1 is finished
+    memset(&search->bestMove, 0xff, sizeof(T_Move)); // Stays unset only when there is no legal move at all
+    int count = generateLegalMoves(board, currentPlayer, -1, -1, search->moves[0]);
+    if (count > 0) search->bestMove = search->moves[0][0];
+    int score = 0;
+    int tableScore;
+    if (count > 0 && probeSearchScore(0, &tableScore) && searchTableRoot(search, count, &score)) { // Counts as one finished depth
+        search->depthReached = 1;
+        search->depthMoves[1] = search->bestMove;
+        search->depthNodes[1] = search->nodes;
+        search->depthMs[1] = GetTickCount() - search->startTime;
+        return score;
+    }
+    for (int depth = 1; depth <= SEARCH_MAX_PLY; depth++) {
+        T_Move previous = search->bestMove;
+        int result = searchPosition(search, depth, -SEARCH_MATE - 1, SEARCH_MATE + 1, 0);
+        if (search->stopped) { // An unfinished depth is thrown away
+            search->bestMove = previous;
+            break;
+        }
+        score = result;
+        search->depthReached = depth;
+        search->depthMoves[depth] = search->bestMove;
+        search->depthNodes[depth] = search->nodes;
+        search->depthMs[depth] = GetTickCount() - search->startTime;
+        if (abs(score) > SEARCH_MATE - SEARCH_MAX_PLY) break; // A forced mate was found, searching deeper changes nothing
+    }
+    return score;
+}
+
+// ### Per-thread random numbers (xorshift), so workers do not share rand() ###
+unsigned int selfPlayRandom(T_SelfPlayWorker* worker) {
+    unsigned int x = worker->seed;
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    return worker->seed = x;
+}
+
+// ### Worker thread: play whole games until enough were played, each into the worker's own shards ###
+DWORD WINAPI selfPlayWorker(LPVOID param) {
+    T_SelfPlayWorker* worker = (T_SelfPlayWorker*)param;
+    T_SelfPlay* run = worker->run;
+    while ((int)InterlockedIncrement(&run->nextGame) <= run->games) {
+        newGame();
+        int plies = 0, result = 3; // Draw unless someone gets mated
+        int scores[MAX_GAME_PLIES];
+        T_Move moves[256];
+        for (;;) {
+            int count = generateLegalMoves(board, currentPlayer, -1, -1, moves);
+            if (count == 0) { if (isInCheck(board, currentPlayer)) result = currentPlayer ? 1 : 2; break; }
+            if (halfmoveClock >= 100 || isInsufficientMaterial(board) || plies == MAX_GAME_PLIES) break;
+            T_Move move;
+            int score = 0;
+            if (plies < SELFPLAY_RANDOM_PLIES) move = moves[selfPlayRandom(worker) % count]; // Random opening, so no two games are the same
+            else {
+                score = searchBestMove(&worker->search, run->nodesPerMove, 0);
+                move = worker->search.bestMove;
+            }
+            // Positions inside the random opening are not kept: nobody looked at them, so they have no score
+            if (plies >= SELFPLAY_RANDOM_PLIES) {
+                T_GameState state;
+                saveGameState(&state);
+                packPosition(&state, 0, 0, &worker->batch[plies - SELFPLAY_RANDOM_PLIES]);
+                scores[plies - SELFPLAY_RANDOM_PLIES] = currentPlayer ? -score : score; // Stored from white's point of view
+            }
+            playMove(move);
+            plies++;
+        }
+        int kept = plies > SELFPLAY_RANDOM_PLIES ? plies - SELFPLAY_RANDOM_PLIES : 0;
+        for (int i = 0; i < kept; i++) {
+            worker->batch[i].score = (short)(scores[i] > 30000 ? 30000 : scores[i] < -30000 ? -30000 : scores[i]);
+            worker->batch[i].result = (unsigned char)result;
+        }
+        if (!shardWrite(&worker->writer, worker->batch, kept)) break;
+        worker->games++;
+        worker->results[result - 1]++;
+    }
+    return 0;
+}
+
+// ### Generate training data by self-play on all cores (main.exe --selfplay prefix --games N [--nodes N] [--threads N] [--evalcache N]) ###
+// Every worker writes its own shards (prefix-w00-000.bin, ...) and keeps its search state for all of its games
+int runSelfPlay(const char* prefix, int games, long long nodesPerMove, int threads) {
+    if (threads <= 0) {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        threads = (int)info.dwNumberOfProcessors;
+    }
+    if (threads > PGN_MAX_THREADS) threads = PGN_MAX_THREADS;
+    T_SelfPlay run = { games, nodesPerMove, 0 };
+    egtOpen("endgame.egt"); // Optional: mapped once and read by every worker, games play table endings perfectly
+    zobristInit(); // Keys of the evaluation caches
+    T_SelfPlayWorker* workers = calloc(threads, sizeof(T_SelfPlayWorker)); // Big: every worker owns its move stacks and a game of packed positions
+    HANDLE handles[PGN_MAX_THREADS];
+    DWORD start = GetTickCount();
+    for (int i = 0; i < threads; i++) {
+        char name[260];
+        snprintf(name, sizeof(name), "%s-w%02d", prefix, i);
+        workers[i].run = &run;
+        workers[i].seed = (unsigned int)time(NULL) * 2654435761u + i * 40503u + 1; // Never 0, xorshift would get stuck
+        shardWriterOpen(&workers[i].writer, name, SHARD_POSITIONS);
+        handles[i] = searchCacheInit(&workers[i].search, evalCacheEntries) ? CreateThread(NULL, 0, selfPlayWorker, &workers[i], 0, NULL) : NULL;
+    }
+    long positions = 0;
+    long long evalHits = 0, evalMisses = 0;
+    int played = 0, results[3] = { 0, 0, 0 };
+    for (int i = 0; i < threads; i++) {
+        if (handles[i]) {
+            WaitForSingleObject(handles[i], INFINITE);
+            CloseHandle(handles[i]);
+        }
+        shardWriterClose(&workers[i].writer);
+        evalHits += workers[i].search.evalHits;
+        evalMisses += workers[i].search.evalMisses;
+        searchCacheFree(&workers[i].search);
+        positions += workers[i].writer.total;
+        played += workers[i].games;
+        for (int r = 0; r < 3; r++) results[r] += workers[i].results[r];
+    }
+    double seconds = (GetTickCount() - start) / 1000.0;
+    if (seconds <= 0) seconds = 0.001;
+    printf("%d games (+%d -%d =%d), %ld positions, %lld nodes per move\n", played, results[0], results[1], results[2], positions, nodesPerMove);
+    printf("%d threads, %.2f s (%.0f positions/s, %.0f positions/s per thread)\n", threads, seconds, positions / seconds, positions / seconds / threads);
+    printf("Evaluation cache: %lld hits, %lld misses (%.1f%% hit rate), %u entries per thread\n", evalHits, evalMisses,
+           evalHits + evalMisses ? 100.0 * evalHits / (evalHits + evalMisses) : 0.0, evalCacheEntries);
+    free(workers);
+    return played == games ? 0 : 1;
+}
+
+// ### Scale an RGBA image to size x size with a box filter and premultiply it by its alpha, ready for blending ###
+// Every output pixel averages the source pixels that fall inside it (at least the nearest one when enlarging)
+unsigned char* scalePremultiplied(const unsigned char* src, int width, int height, int size) {
+    unsigned char* dst = malloc((size_t)size * size * 4);
+    for (int y = 0; y < size; y++)
+        for (int x = 0; x < size; x++) {
+            int x0 = x * width / size, x1 = (x + 1) * width / size, y0 = y * height / size, y1 = (y + 1) * height / size;
+            if (x1 <= x0) x1 = x0 + 1;
+            if (y1 <= y0) y1 = y0 + 1;
+            unsigned int sum[4] = { 0, 0, 0, 0 }, count = (x1 - x0) * (y1 - y0);
+            for (int sy = y0; sy < y1; sy++)
+                for (int sx = x0; sx < x1; sx++) {
+                    const unsigned char* p = &src[((size_t)sy * width + sx) * 4];
+                    for (int c = 0; c < 3; c++) sum[c] += p[c] * p[3];
+                    sum[3] += p[3];
+                }
+            unsigned char* out = &dst[((size_t)y * size + x) * 4];
+            for (int c = 0; c < 3; c++) out[c] = (unsigned char)((sum[c] + count * 255 / 2) / (count * 255));
+            out[3] = (unsigned char)((sum[3] + count / 2) / count);
+        }
+    return dst;
+}
+
+// ### Blend premultiplied pixels over opaque ones: dst = src + dst * (255 - alpha) / 255 ###
+// SSE2 does four pixels at a time; the scalar loop does the rest, with the same rounding so both give the same bytes
+void blendPremultiplied(unsigned char* dst, const unsigned char* src, int pixels) {
+    int i = 0;
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128(), full = _mm_set1_epi16(255), half = _mm_set1_epi16(128);
+    for (; i + 4 <= pixels; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(src + i * 4)), d = _mm_loadu_si128((const __m128i*)(dst + i * 4));
+        __m128i result[2];
+        for (int k = 0; k < 2; k++) {
+            __m128i s16 = k ? _mm_unpackhi_epi8(s, zero) : _mm_unpacklo_epi8(s, zero); // Two pixels as 16-bit channels
+            __m128i d16 = k ? _mm_unpackhi_epi8(d, zero) : _mm_unpacklo_epi8(d, zero);
+            __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s16, 0xFF), 0xFF); // Each pixel's alpha in all four channels
+            __m128i t = _mm_add_epi16(_mm_mullo_epi16(d16, _mm_sub_epi16(full, alpha)), half);
+            t = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8); // t / 255, rounded
+            result[k] = _mm_add_epi16(s16, t);
+        }
+        _mm_storeu_si128((__m128i*)(dst + i * 4), _mm_packus_epi16(result[0], result[1]));
+    }
+#endif
+    for (; i < pixels; i++)
+        for (int c = 0; c < 4; c++) {
+            unsigned int t = dst[i * 4 + c] * (255u - src[i * 4 + 3]) + 128;
+            dst[i * 4 + c] = (unsigned char)(src[i * 4 + c] + ((t + (t >> 8)) >> 8));
+        }
+}
+
+// ### Draw a board into an RGBA image of 8 x 8 squares: the board colors of the game screen, then every piece on top ###
+void renderDiagram(const T_DiagramRun* run, int board[8][8], unsigned char* image) {
+    static const unsigned char light[4] = { 242, 217, 179, 255 }, dark[4] = { 128, 77, 26, 255 };
+    int size = run->squareSize, stride = BOARD_SIZE * size;
+    for (int y = 0; y < stride; y++)
+        for (int x = 0; x < stride; x++)
+            memcpy(&image[((size_t)y * stride + x) * 4], ((y / size + x / size) % 2 == 0) ? light : dark, 4);
+    for (int row = 0; row < BOARD_SIZE; row++)
+        for (int col = 0; col < BOARD_SIZE; col++) {
+            const unsigned char* piece = run->pieces[board[row][col]];
+            if (!piece) continue;
+            for (int y = 0; y < size; y++) // One row of the piece at a time, the rows are contiguous in both images
+                blendPremultiplied(&image[(((size_t)row * size + y) * stride + col * size) * 4], &piece[(size_t)y * size * 4], size);
+        }
+}
+
+// ### Append bytes to a growing buffer ###
+void byteWrite(T_ByteWriter* out, const void* bytes, size_t count) {
+    if (out->size + count > out->capacity) {
+        out->capacity = (out->size + count) * 2;
+        out->data = realloc(out->data, out->capacity);
+    }
+    memcpy(out->data + out->size, bytes, count);
+    out->size += count;
+}
+
+// ### Append a big-endian 32-bit number (PNG byte order) ###
+void byteWrite32(T_ByteWriter* out, unsigned int value) {
+    unsigned char bytes[4] = { (unsigned char)(value >> 24), (unsigned char)(value >> 16), (unsigned char)(value >> 8), (unsigned char)value };
+    byteWrite(out, bytes, 4);
+}
+
+// ### Append count bits, lowest bit first, the way deflate packs them ###
+void bitWrite(T_ByteWriter* out, unsigned int value, int count) {
+    out->bits |= value << out->bitCount;
+    out->bitCount += count;
+    while (out->bitCount >= 8) {
+        unsigned char byte = (unsigned char)out->bits;
+        byteWrite(out, &byte, 1);
+        out->bits >>= 8;
+        out->bitCount -= 8;
+    }
+}
+
+// ### Append a Huffman code: those are defined from their highest bit, so they go in reversed ###
+void huffmanWrite(T_ByteWriter* out, unsigned int code, int length) {
+    unsigned int reversed = 0;
+    for (int i = 0; i < length; i++) reversed |= ((code >> i) & 1) << (length - 1 - i);
+    bitWrite(out, reversed, length);
+}
+
+// ### Append a literal byte or a length symbol with the fixed Huffman codes of deflate ###
+void deflateSymbol(T_ByteWriter* out, int symbol) {
+    if (symbol < 144) huffmanWrite(out, 0x30 + symbol, 8);
+    else if (symbol < 256) huffmanWrite(out, 0x190 + symbol - 144, 9);
+    else if (symbol < 280) huffmanWrite(out, symbol - 256, 7);
+    else huffmanWrite(out, 0xC0 + symbol - 280, 8);
+}
+
+// ### Compress data into a zlib stream: one deflate block with the fixed codes, matches found through a hash of the next 3 bytes ###
+// Diagrams are mostly runs of the same few colors, so even this simple matcher shrinks them a lot
+void zlibCompress(T_ByteWriter* out, const unsigned char* data, size_t size) {
+    static const unsigned short lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const unsigned char lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const unsigned short distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const unsigned char distanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+    const unsigned char header[2] = { 0x78, 0x01 }; // Deflate with a 32 KB window, no dictionary
+    byteWrite(out, header, 2);
+    bitWrite(out, 1, 1); // Last block
+    bitWrite(out, 1, 2); // Fixed Huffman codes
+    int* head = malloc(sizeof(int) * 65536); // Last position of every 3-byte hash
+    for (int i = 0; i < 65536; i++) head[i] = -1;
+    size_t pos = 0;
+    while (pos < size) {
+        int length = 0;
+        size_t distance = 0;
+        if (pos + 3 <= size) {
+            unsigned int hash = ((data[pos] << 8) ^ (data[pos + 1] << 4) ^ data[pos + 2]) & 0xFFFF;
+            int candidate = head[hash];
+            head[hash] = (int)pos;
+            if (candidate >= 0 && pos - candidate <= PNG_WINDOW) {
+                size_t limit = size - pos < 258 ? size - pos : 258;
+                while ((size_t)length < limit && data[candidate + length] == data[pos + length]) length++;
+                distance = pos - candidate;
+            }
+        }
+        if (length < 3) { deflateSymbol(out, data[pos++]); continue; }
+        int code = 28;
+        while (lengthBase[code] > length) code--;
+        deflateSymbol(out, 257 + code);
+        bitWrite(out, length - lengthBase[code], lengthExtra[code]);
+        code = 29;
+        while (distanceBase[code] > distance) code--;
+        huffmanWrite(out, code, 5);
+        bitWrite(out, (unsigned int)(distance - distanceBase[code]), distanceExtra[code]);
+        size_t end = pos + length;
+        for (pos++; pos < end; pos++) // Positions inside the match can be matched later too
+            if (pos + 3 <= size) head[((data[pos] << 8) ^ (data[pos + 1] << 4) ^ data[pos + 2]) & 0xFFFF] = (int)pos;
+    }
+    deflateSymbol(out, 256); // End of block
+    if (out->bitCount) bitWrite(out, 0, 8 - out->bitCount);
+    unsigned int a = 1, b = 0; // Adler-32 of the uncompressed data
+    for (size_t i = 0; i < size; i++) { a = (a + data[i]) % 65521; b = (b + a) % 65521; }
+    byteWrite32(out, (b << 16) | a);
+    free(head);
+}
+
+// ### CRC-32 as used by PNG chunks ###
+unsigned int pngCrc(const unsigned char* data, size_t size) {
+    static unsigned int table[256];
+    static volatile LONG tableReady = 0;
+    if (!tableReady) { // Every thread computes the same values, so a race here is harmless
+        for (unsigned int n = 0; n < 256; n++) {
+            unsigned int c = n;
+            for (int k = 0; k < 8; k++) c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+        InterlockedExchange(&tableReady, 1);
+    }
+    unsigned int crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+// ### Append a PNG chunk: length, type, data, CRC of type and data ###
+void pngChunk(T_ByteWriter* out, const char* type, const unsigned char* data, size_t size) {
+    byteWrite32(out, (unsigned int)size);
+    size_t start = out->size;
+    byteWrite(out, type, 4);
+    if (size) byteWrite(out, data, size);
+    byteWrite32(out, pngCrc(out->data + start, size + 4));
+}
+
+// ### Write an RGBA image as an RGB PNG (the diagrams are opaque) ###
+bool writePng(const char* filename, const unsigned char* image, int width, int height) {
+    size_t rowSize = (size_t)width * 3 + 1; // Filter byte (0, none) then the row
+    unsigned char* raw = malloc(rowSize * height);
+    for (int y = 0; y < height; y++) {
+        unsigned char* row = &raw[y * rowSize];
+        row[0] = 0;
+        for (int x = 0; x < width; x++) memcpy(&row[1 + x * 3], &image[((size_t)y * width + x) * 4], 3);
+    }
+    T_ByteWriter compressed = { 0 }, png = { 0 };
+    zlibCompress(&compressed, raw, rowSize * height);
+    free(raw);
+    const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    unsigned char header[13] = { 0 };
+    for (int i = 0; i < 4; i++) { header[i] = (unsigned char)(width >> (24 - 8 * i)); header[4 + i] = (unsigned char)(height >> (24 - 8 * i)); }
+    header[8] = 8; // Bits per channel
+    header[9] = 2; // RGB
+    byteWrite(&png, signature, 8);
+    pngChunk(&png, "IHDR", header, 13);
+    pngChunk(&png, "IDAT", compressed.data, compressed.size);
+    pngChunk(&png, "IEND", NULL, 0);
+    free(compressed.data);
+    FILE* file = fopen(filename, "wb");
+    bool ok = file && fwrite(png.data, 1, png.size, file) == png.size;
+    if (file) ok = fclose(file) == 0 && ok;
+    free(png.data);
+    return ok;
+}
+
+// ### Worker thread: render the next position until all diagrams are written, reusing one image buffer ###
+DWORD WINAPI diagramWorker(LPVOID param) {
+    T_DiagramRun* run = (T_DiagramRun*)param;
+    int side = BOARD_SIZE * run->squareSize;
+    unsigned char* image = malloc((size_t)side * side * 4);
+    for (;;) {
+        int index = (int)InterlockedIncrement(&run->next) - 1;
+        if (index >= run->count) break;
+        char filename[300];
+        snprintf(filename, sizeof(filename), "%s-%05d.png", run->prefix, index);
+        if (!loadFEN(run->fens[index])) { // The board is per thread, so every worker sets up its own positions
+            printf("Invalid FEN on line %d: %s\n", index + 1, run->fens[index]);
+            InterlockedIncrement(&run->failed);
+            continue;
+        }
+        renderDiagram(run, board, image);
+        if (writePng(filename, image, side, side)) InterlockedIncrement(&run->written);
+        else { printf("Cannot write %s\n", filename); InterlockedIncrement(&run->failed); }
+    }
+    free(image);
+    return 0;
+}
+
+// ### Render one PNG diagram per FEN line without a window or GPU (main.exe --render-fens positions.txt prefix [--square N] [--threads N]) ###
+// The piece images are decoded and scaled once, then all cores render and compress boards in parallel
+int renderFenFile(const char* filename, const char* prefix, int squareSize, int threads) {
+    FILE* file = fopen(filename, "r");
+    if (!file) { printf("Cannot open %s\n", filename); return 1; }
+    T_DiagramRun run = { { NULL }, squareSize > 0 ? squareSize : DIAGRAM_SQUARE, NULL, 0, prefix, 0, 0, 0 };
+    int capacity = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (!line[0]) continue;
+        if (run.count == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            run.fens = realloc(run.fens, capacity * sizeof(char*));
+        }
+        run.fens[run.count] = malloc(strlen(line) + 1);
+        strcpy(run.fens[run.count++], line);
+    }
+    fclose(file);
+
+    bundleOpen("assets.bin"); // Pre-decoded pieces when there is a bundle
+    for (int i = 0; i < 12; i++) {
+        int width, height;
+        const unsigned char* pixels = imageLoad(assetFiles[i], &width, &height);
+        if (!pixels) { printf("Failed to load texture: %s\n", assetFiles[i]); continue; }
+        run.pieces[(i / 6) * 10 + i % 6 + 1] = scalePremultiplied(pixels, width, height, run.squareSize);
+        imageFree(pixels);
+    }
+
+    if (threads <= 0) {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        threads = (int)info.dwNumberOfProcessors;
+    }
+    if (threads > PGN_MAX_THREADS) threads = PGN_MAX_THREADS;
+    HANDLE handles[PGN_MAX_THREADS];
+    DWORD start = GetTickCount();
+    for (int i = 0; i < threads; i++) handles[i] = CreateThread(NULL, 0, diagramWorker, &run, 0, NULL);
+    for (int i = 0; i < threads; i++) {
+        WaitForSingleObject(handles[i], INFINITE);
+        CloseHandle(handles[i]);
+    }
+    double seconds = (GetTickCount() - start) / 1000.0;
+    if (seconds <= 0) seconds = 0.001;
+    printf("%ld diagrams written, %ld failed, %dx%d pixels\n", (long)run.written, (long)run.failed, BOARD_SIZE * run.squareSize, BOARD_SIZE * run.squareSize);
+    printf("%d threads, %.2f s (%.0f diagrams/s)\n", threads, seconds, run.written / seconds);
+    for (int i = 0; i < run.count; i++) free(run.fens[i]);
+    free(run.fens);
+    for (int i = 0; i < 17; i++) free(run.pieces[i]);
+    return run.failed ? 1 : 0;
+}
+
+// ### Fit the screens into the resized window ###
+// The 700x700 layout is scaled into the largest centred square of the window (the rest stays black).
+// The board's squares are a whole number of pixels on screen, so their edges stay sharp at every size.
+void reshape(int w, int h) {
+    viewportSize = w < h ? w : h;
+    if (viewportSize < BOARD_SIZE) viewportSize = BOARD_SIZE;
+    viewportX = (w - viewportSize) / 2;
+    viewportY = (h - viewportSize) / 2;
+    glViewport(viewportX, viewportY, viewportSize, viewportSize);
+    int squarePixels = viewportSize / BOARD_SIZE;
+    mainBoardView.squareSize = (float)squarePixels * LOGICAL_SIZE / viewportSize; // In layout units
+    updatePieceAtlas();
+    markDirty(DIRTY_ALL);
+}
+
+// ### How many times the piece images can be halved and still be at least as big as a square of that many pixels ###
+int pieceHalvings(int squarePixels) {
+    int largest = 1;
+    for (int i = 0; i < 12; i++) {
+        if (loadingImages[i].width > largest) largest = loadingImages[i].width;
+        if (loadingImages[i].height > largest) largest = loadingImages[i].height;
+    }
+    int halvings = 0;
+    while ((largest >> (halvings + 1)) >= squarePixels) halvings++;
+    return halvings;
+}
+
+// ### Build the piece atlas for the current square size, or rebuild it when the window changed enough to need other image sizes ###
+// Drawing pieces from images no bigger than twice the square keeps the texture reads small; the mip levels cover the rest
+void updatePieceAtlas(void) {
+    for (int i = 0; i < 12; i++) if (!loadingImages[i].done) return; // Still decoding, uploadLoadedImages comes back here
+    int halvings = pieceHalvings(viewportSize / BOARD_SIZE);
+    if (halvings == pieceAtlasHalvings) return;
+    if (pieceAtlasTex) glDeleteTextures(1, &pieceAtlasTex);
+    pieceAtlasTex = buildPieceAtlas(loadingImages, halvings);
+    pieceAtlasHalvings = halvings;
+    updatePieceAtlasUniforms();
+    mainBoardView.instanceCount = -1; // Redraw the pieces with the new atlas
+    markDirty(DIRTY_ALL);
+}
+
+// ### Load texture from file ###
+GLuint loadTexture(const char* filename) { // Load a PNG texture from file
+    // With an asset bundle the image and its mip levels are uploaded straight from the mapped file, nothing is decoded
+    const T_BundleEntry* entry = bundleFind(filename);
+    if (entry) {
+        GLuint tex;
+        glGenTextures(1, &tex);
+        glBindTexture(GL_TEXTURE_2D, tex);
+        const unsigned char* level = bundleData + entry->offset;
+        int width = entry->width, height = entry->height;
+        for (int l = 0; l < (int)entry->levels; l++) {
+            glTexImage2D(GL_TEXTURE_2D, l, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, level);
+            level += (size_t)width * height * 4;
+            width = width > 1 ? width / 2 : 1;
+            height = height > 1 ? height / 2 : 1;
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, entry->levels - 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, entry->levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR); // Smooth when drawn smaller
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        return tex;
+    }
+    // Use stb_image to load the PNG file
+    int width, height; // Variables to hold image dimensions
+    const unsigned char* data = imageLoad(filename, &width, &height); // Load PNG as RGBA
+    if (!data) {
+        printf("Failed to load texture: %s\n", filename); // Print error if file not found
+        return 0;
+    }
+    GLuint tex = createTexture(data, width, height);
+    imageFree(data); // Free image memory
+    return tex; // Return texture handle
+}
+
+// ### Create a texture from decoded RGBA pixels ###
+GLuint createTexture(const unsigned char* data, int width, int height) {
+    GLuint tex; // Texture handle to be returned
+    // Generate and set up the texture
+    glGenTextures(1, &tex); // 1 is the number of textures to be generated and to store the texture ID in the variable tex
+    glBindTexture(GL_TEXTURE_2D, tex); // Bind it for setup (2D setup), which means making it the current texture for 2D rendering
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data); // Upload pixel data, 8 bits per channel
+    generateMipmaps(); // Smaller copies for a small window
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR); // Linear magnification
+    return tex; // Return texture handle
+}
+
+// ### Give the bound texture its mip levels and trilinear filtering (plain linear filtering without OpenGL 3.0) ###
+void generateMipmaps(void) {
+    if (GLEW_VERSION_3_0) {
+        glGenerateMipmap(GL_TEXTURE_2D);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
+    else glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+}
+
+// ### Number of mip levels of an image, down to 1x1 ###
+int mipLevels(int width, int height) {
+    int levels = 1;
+    while (width > 1 || height > 1) {
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+        levels++;
+    }
+    return levels;
+}
+
+// ### Halve an RGBA image with a 2x2 box filter (odd edges repeat their last row or column) ###
+// Colors are weighted by alpha, so transparent pixels do not darken the edges of the pieces
+void downsampleImage(const unsigned char* src, int width, int height, unsigned char* dst) {
+    int halfWidth = width > 1 ? width / 2 : 1, halfHeight = height > 1 ? height / 2 : 1;
+    for (int y = 0; y < halfHeight; y++)
+        for (int x = 0; x < halfWidth; x++) {
+            int sum[4] = { 0, 0, 0, 0 };
+            for (int k = 0; k < 4; k++) {
+                int sx = 2 * x + (k & 1), sy = 2 * y + (k >> 1);
+                const unsigned char* p = &src[((size_t)(sy < height ? sy : height - 1) * width + (sx < width ? sx : width - 1)) * 4];
+                for (int c = 0; c < 3; c++) sum[c] += p[c] * p[3];
+                sum[3] += p[3];
+            }
+            unsigned char* out = &dst[((size_t)y * halfWidth + x) * 4];
+            for (int c = 0; c < 3; c++) out[c] = (unsigned char)(sum[3] ? (sum[c] + sum[3] / 2) / sum[3] : 0);
+            out[3] = (unsigned char)((sum[3] + 2) / 4);
+        }
+}
+
+// ### Decode every image the game uses and write them with their mip chains into one bundle (main.exe --pack-assets assets.bin) ###
+int packAssets(const char* bundleName) {
+    FILE* out = fopen(bundleName, "wb");
+    if (!out) { printf("Cannot create %s\n", bundleName); return 1; }
+    T_BundleHeader header = { BUNDLE_MAGIC, BUNDLE_VERSION, 0 };
+    T_BundleEntry entries[ASSET_COUNT];
+    memset(entries, 0, sizeof(entries));
+    unsigned long long offset = sizeof(header) + sizeof(entries); // The table is written again at the end, once it is filled in
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(entries, sizeof(entries), 1, out);
+    int packed = 0;
+    for (int i = 0; i < ASSET_COUNT; i++) {
+        int width, height, channels;
+        unsigned char* pixels = stbi_load(assetFiles[i], &width, &height, &channels, 4); // Load as RGBA
+        if (!pixels) { printf("Failed to load texture: %s\n", assetFiles[i]); continue; }
+        T_BundleEntry* entry = &entries[packed++];
+        strncpy(entry->name, assetFiles[i], sizeof(entry->name) - 1);
+        entry->width = width;
+        entry->height = height;
+        entry->levels = mipLevels(width, height);
+        entry->offset = offset;
+        unsigned char* level = pixels;
+        for (int l = 0; l < (int)entry->levels; l++) { // Level 0 is the image itself, every next level is half as big
+            size_t bytes = (size_t)width * height * 4;
+            fwrite(level, 1, bytes, out);
+            offset += bytes;
+            if (l + 1 < (int)entry->levels) {
+                unsigned char* smaller = malloc((size_t)(width > 1 ? width / 2 : 1) * (height > 1 ? height / 2 : 1) * 4);
+                downsampleImage(level, width, height, smaller);
+                if (level != pixels) free(level);
+                level = smaller;
+                width = width > 1 ? width / 2 : 1;
+                height = height > 1 ? height / 2 : 1;
+            }
+        }
+        if (level != pixels) free(level);
+        stbi_image_free(pixels);
+        while (offset % 16) { fputc(0, out); offset++; } // Keep every image 16-byte aligned in the mapped file
+    }
+    header.count = packed;
+    fseek(out, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(entries, sizeof(entries), 1, out);
+    fclose(out);
+    printf("%d images packed into %s (%llu bytes)\n", packed, bundleName, offset);
+    return packed == ASSET_COUNT ? 0 : 1;
+}
+
+// ### Map the asset bundle, if there is one ###
+bool bundleOpen(const char* filename) {
+    size_t size = 0;
+    const unsigned char* data = mapFile(filename, &size);
+    if (!data) return false;
+    const T_BundleHeader* header = (const T_BundleHeader*)data;
+    if (size < sizeof(T_BundleHeader) + sizeof(T_BundleEntry) * ASSET_COUNT || memcmp(header->magic, BUNDLE_MAGIC, 4) != 0
+        || header->version != BUNDLE_VERSION || header->count > ASSET_COUNT) {
+        printf("%s is not an asset bundle of this version\n", filename);
+        unmapFile(data);
+        return false;
+    }
+    // Every image with its whole mip chain has to lie inside the file, or the uploads would read past the mapping
+    const T_BundleEntry* entries = (const T_BundleEntry*)(data + sizeof(T_BundleHeader));
+    for (unsigned int i = 0; i < header->count; i++) {
+        const T_BundleEntry* entry = &entries[i];
+        bool ok = memchr(entry->name, '\0', sizeof(entry->name)) && entry->width > 0 && entry->height > 0
+                  && entry->width <= 16384 && entry->height <= 16384
+                  && entry->levels >= 1 && (int)entry->levels <= mipLevels((int)entry->width, (int)entry->height);
+        unsigned long long end = entry->offset;
+        unsigned int width = entry->width, height = entry->height;
+        for (unsigned int l = 0; ok && l < entry->levels; l++) {
+            end += (unsigned long long)width * height * 4;
+            width = width > 1 ? width / 2 : 1;
+            height = height > 1 ? height / 2 : 1;
+        }
+        if (!ok || end > size) {
+            printf("%s is damaged, images are decoded from their files instead\n", filename);
+            unmapFile(data);
+            return false;
+        }
+    }
+    bundleData = data;
+    bundleSize = size;
+    return true;
+}
+
+// ### Find an image in the bundle by file name (not case sensitive, like Windows file names) ###
+const T_BundleEntry* bundleFind(const char* name) {
+    if (!bundleData) return NULL;
+    const T_BundleHeader* header = (const T_BundleHeader*)bundleData;
+    const T_BundleEntry* entries = (const T_BundleEntry*)(bundleData + sizeof(T_BundleHeader));
+    for (unsigned int i = 0; i < header->count; i++)
+        if (_stricmp(entries[i].name, name) == 0) return &entries[i]; // bundleOpen checked that all of it is in the file
+    return NULL;
+}
+
+// ### Get the RGBA pixels of an image: straight from the mapped bundle if it is there, decoded from the file otherwise ###
+const unsigned char* imageLoad(const char* filename, int* width, int* height) {
+    const T_BundleEntry* entry = bundleFind(filename);
+    if (entry) {
+        *width = entry->width;
+        *height = entry->height;
+        return bundleData + entry->offset;
+    }
+    int channels;
+    return stbi_load(filename, width, height, &channels, 4); // Load as RGBA
+}
+
+// ### Release pixels from imageLoad (bundle pixels belong to the mapping and are left alone) ###
+void imageFree(const unsigned char* pixels) {
+    if (pixels && !(bundleData && pixels >= bundleData && pixels < bundleData + bundleSize))
+        stbi_image_free((void*)pixels);
+}
+
+// ### Milliseconds since the window started to be set up ###
+double elapsedMs(void) {
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return (now.QuadPart - startupCounter.QuadPart) * 1000.0 / counterFrequency.QuadPart;
+}
+
+// ### Worker thread: decode the next image until all are taken (stb_image can decode on several threads at once) ###
+DWORD WINAPI imageDecodeWorker(LPVOID param) {
+    for (;;) {
+        int index = (int)InterlockedIncrement(&nextImageToDecode) - 1;
+        if (index >= ASSET_COUNT) break;
+        T_LoadingImage* image = &loadingImages[index];
+        image->pixels = imageLoad(assetFiles[index], &image->width, &image->height);
+        if (!image->pixels) printf("Failed to load texture: %s\n", assetFiles[index]);
+        InterlockedExchange(&image->done, 1); // The main thread may upload it from now on
+    }
+    return 0;
+}
+
+// ### Start getting every image: straight from the asset bundle, or decoded on worker threads while the window already runs ###
+void startImageLoading(void) {
+    if (bundleData) { // Nothing to decode, the pixels are in the mapped file
+        for (int i = 0; i < ASSET_COUNT; i++) {
+            loadingImages[i].pixels = imageLoad(assetFiles[i], &loadingImages[i].width, &loadingImages[i].height);
+            loadingImages[i].done = 1;
+        }
+        return;
+    }
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int threads = (int)info.dwNumberOfProcessors < ASSET_COUNT ? (int)info.dwNumberOfProcessors : ASSET_COUNT;
+    for (int i = 0; i < threads; i++) {
+        HANDLE worker = CreateThread(NULL, 0, imageDecodeWorker, NULL, 0, NULL);
+        if (worker) CloseHandle(worker); // Nobody waits for the workers, they end when the images run out
+        else imageDecodeWorker(NULL);    // No thread, decode right here
+    }
+}
+
+// ### Upload whatever finished decoding (GL calls have to stay on the main thread); runs as the idle function until all is uploaded ###
+// Until then the screens draw placeholders: plain grey images, and no pieces
+void uploadLoadedImages(void) {
+    bool piecesDone = true;
+    for (int i = 0; i < 12; i++) piecesDone = piecesDone && loadingImages[i].done;
+    if (piecesDone && !loadingImages[0].uploaded) { // The atlas needs all twelve pieces at once
+        updatePieceAtlas(); // Pieces that had no image yet get one now
+        for (int i = 0; i < 12; i++) loadingImages[i].uploaded = true; // Their pixels are kept to rebuild the atlas for other window sizes
+    }
+    GLuint* screenTextures[2] = { &menuBackgroundTex, &theCreatorTex };
+    for (int i = 12; i < ASSET_COUNT; i++) {
+        T_LoadingImage* image = &loadingImages[i];
+        if (!image->done || image->uploaded) continue;
+        if (bundleFind(assetFiles[i])) *screenTextures[i - 12] = loadTexture(assetFiles[i]); // Uploads the bundled mip levels too
+        else if (image->pixels) *screenTextures[i - 12] = createTexture(image->pixels, image->width, image->height);
+        imageFree(image->pixels);
+        image->uploaded = true;
+        markDirty(DIRTY_SCREEN);
+    }
+    int uploaded = 0;
+    for (int i = 0; i < ASSET_COUNT; i++) uploaded += loadingImages[i].uploaded;
+    if (uploaded == ASSET_COUNT) {
+        printf("All textures ready after %.1f ms\n", elapsedMs());
+        glutIdleFunc(NULL); // Nothing left to wait for, stop idling
+    }
+}
+
+// ### Update available moves for the selected piece ###
+void updateAvailableMoves() {
+    // Clear previous highlights
+    for (int i = 0; i < BOARD_SIZE; i++)
+        for (int j = 0; j < BOARD_SIZE; j++)
+            availableMoves[i][j] = false;
+
+    if (selectedRow == -1 || selectedCol == -1) // Checks if there is a selected piece
+        return;
+
+    int val = board[selectedRow][selectedCol];
+    int color = val / 10;
+    if (val == 0 || color != currentPlayer) // Checks if there is a piece selected and not just an empty square and the color selected matches the player color to validate players turn
+        return;
+
+    // Look the selected piece up in the move cache first
+    unsigned long long key = positionHash(board, currentPlayer) ^ ((selectedRow * 8 + selectedCol + 1) * 0x9E3779B97F4A7C15ULL); // Mix the square into the position hash
+    if (key == 0) key = 1; // 0 marks an empty entry
+    T_MoveCacheEntry* entry = &moveCache[key & (MOVE_CACHE_SIZE - 1)]; // Direct-mapped: the low bits of the key pick the slot
+    if (entry->key == key) { // Cache hit, so just unpack the stored targets
+        moveCacheHits++;
+        for (int sq = 0; sq < 64; sq++)
+            availableMoves[sq / 8][sq % 8] = (entry->targets >> sq) & 1;
+        return;
+    }
+    moveCacheMisses++;
+
+    // Ask the move generator for every legal move of the selected piece
+    T_Move moves[64];
+    int count = generateLegalMoves(board, currentPlayer, selectedRow * 8 + selectedCol, -1, moves);
+    for (int k = 0; k < count; k++)
+        availableMoves[moves[k].toRow][moves[k].toCol] = true;
+
+    // Store the result so the next selection of this piece in this position is a cache hit
+    entry->key = key;
+    entry->targets = 0;
+    for (int sq = 0; sq < 64; sq++)
+        if (availableMoves[sq / 8][sq % 8])
+            entry->targets |= 1ULL << sq;
+}
+
+// ### Fill the Zobrist key tables with pseudo-random numbers ###
+void zobristInit(void) {
+    unsigned long long seed = 0x2545F4914F6CDD1DULL; // Fixed seed so the hashes are the same on every run
+    // xorshift64 generator, good enough for hashing and needs no library
+    #define ZOBRIST_NEXT() (seed ^= seed << 13, seed ^= seed >> 7, seed ^= seed << 17, seed)
+    for (int color = 0; color < 2; color++)
+        for (int piece = 0; piece < 7; piece++)
+            for (int sq = 0; sq < 64; sq++)
+                zobristPieces[color][piece][sq] = ZOBRIST_NEXT();
+    zobristSide = ZOBRIST_NEXT();
+    for (int i = 0; i < 4; i++)
+        zobristCastling[i] = ZOBRIST_NEXT();
+    for (int i = 0; i < 8; i++)
+        zobristEnPassant[i] = ZOBRIST_NEXT();
+    #undef ZOBRIST_NEXT
+}
+
+// ### Hash the position: pieces, side to move, castling rights and en passant column ###
+unsigned long long positionHash(int board[8][8], int player) {
+    unsigned long long hash = 0;
+    for (int i = 0; i < 8; i++)
+        for (int j = 0; j < 8; j++)
+            if (board[i][j]) // Empty squares do not change the hash
+                hash ^= zobristPieces[board[i][j] / 10][board[i][j] % 10][i * 8 + j];
+    if (player) hash ^= zobristSide;
+    // Castling rights change which king moves are legal, so they are part of the position
+    if (!whiteKingMoved && !whiteKingsideRookMoved) hash ^= zobristCastling[0];
+    if (!whiteKingMoved && !whiteQueensideRookMoved) hash ^= zobristCastling[1];
+    if (!blackKingMoved && !blackKingsideRookMoved) hash ^= zobristCastling[2];
+    if (!blackKingMoved && !blackQueensideRookMoved) hash ^= zobristCastling[3];
+    if (enPassantCol >= 0) hash ^= zobristEnPassant[enPassantCol]; // So does the en passant column
+    return hash;
+}
+
+// ### Hash the position the way Polyglot books do ###
+// Same parts as positionHash, but with the published Random64 keys so the keys match books from other programs.
+// The en passant key only counts when a pawn of the side to move stands next to the pawn that just moved two squares.
+unsigned long long polyglotHash(int board[8][8], int player) {
+    static const int kinds[7] = { 0, 0, 5, 4, 3, 2, 1 }; // Our piece codes to Polyglot's pawn, knight, bishop, rook, queen, king
+    unsigned long long hash = 0;
+    for (int i = 0; i < 8; i++)
+        for (int j = 0; j < 8; j++)
+            if (board[i][j]) { // Polyglot rank 0 is our row 7, and black comes before white in every kind
+                int kind = 2 * kinds[board[i][j] % 10] + (board[i][j] / 10 == 0);
+                hash ^= polyglotRandom[64 * kind + 8 * (7 - i) + j];
+            }
+    if (!whiteKingMoved && !whiteKingsideRookMoved) hash ^= polyglotRandom[768];
+    if (!whiteKingMoved && !whiteQueensideRookMoved) hash ^= polyglotRandom[769];
+    if (!blackKingMoved && !blackKingsideRookMoved) hash ^= polyglotRandom[770];
+    if (!blackKingMoved && !blackQueensideRookMoved) hash ^= polyglotRandom[771];
+    if (enPassantCol >= 0) {
+        int row = player ? 4 : 3, pawn = player ? 11 : 1; // Row of the pawn that moved two squares, and a capturing pawn
+        if ((enPassantCol > 0 && board[row][enPassantCol - 1] == pawn) || (enPassantCol < 7 && board[row][enPassantCol + 1] == pawn))
+            hash ^= polyglotRandom[772 + enPassantCol];
+    }
+    if (!player) hash ^= polyglotRandom[780]; // Polyglot flips the key when white is to move
+    return hash;
+}
+
+// ### Print how often the move cache answered a selection ###
+void printMoveCacheStats(void) {
+    unsigned long total = moveCacheHits + moveCacheMisses;
+    printf("Move cache: %lu hits, %lu misses (%.1f%% hit rate, %d entries)\n",
+           moveCacheHits, moveCacheMisses, total ? 100.0 * moveCacheHits / total : 0.0, MOVE_CACHE_SIZE);
+}
+
+// ### Fill the king pair tables: the strong king in the a1-d1-d4 triangle, the weak king anywhere it is not next to it ###
+// With the strong king on the a1-d4 diagonal the weak king also stays on or below the a1-h8 diagonal, which leaves 462 pairs
+void egtInitKings(void) {
+    if (egtKingsReady) return;
+    int pairs = 0;
+    for (int slot = 0; slot < 10; slot++) {
+        int file = 0, rank = slot;
+        while (rank > file) rank -= ++file;
+        int sk = (7 - rank) * 8 + file;
+        for (int wk = 0; wk < 64; wk++) {
+            egtKingPair[slot][wk] = -1;
+            if (abs(wk / 8 - sk / 8) <= 1 && abs(wk % 8 - sk % 8) <= 1) continue; // Same square or touching kings
+            if (rank == file && 7 - wk / 8 > wk % 8) continue; // Above the diagonal: its mirror image is the one stored
+            egtKingPair[slot][wk] = (short)pairs;
+            egtKingPairSquares[pairs][0] = (unsigned char)sk;
+            egtKingPairSquares[pairs][1] = (unsigned char)wk;
+            pairs++;
+        }
+    }
+    egtKingsReady = true;
+}
+
+// ### Number of positions of an endgame table, both sides to move ###
+// Every piece only counts the squares the pieces placed before it left free
+int egtPositions(const T_EgtDefinition* def) {
+    int positions = def->pawns ? 2 * 24 * 63 * 62 : 2 * EGT_KING_PAIRS; // Pawn on 24 squares then both kings, or a king pair
+    for (int i = def->pawns ? 1 : 0; i < def->count; i++) positions *= 62 - i;
+    return positions;
+}
+
+// ### Apply board symmetry t to a square: bit 2 swaps rows and columns, bit 0 mirrors the columns, bit 1 the rows ###
+int egtTransform(int sq, int t) {
+    int row = sq / 8, col = sq % 8;
+    if (t & 4) { int swap = row; row = col; col = swap; }
+    if (t & 1) col = 7 - col;
+    if (t & 2) row = 7 - row;
+    return row * 8 + col;
+}
+
+// ### Number of sq among the squares that are not taken (taken squares never equal sq) ###
+int egtSkip(int sq, const int taken[], int count) {
+    int n = sq;
+    for (int i = 0; i < count; i++) if (taken[i] < sq) n--;
+    return n;
+}
+
+// ### Square number n among the squares that are not taken (the reverse of egtSkip) ###
+int egtUnskip(int n, const int taken[], int count) {
+    int sorted[2 + EGT_MAX_PIECES];
+    for (int i = 0; i < count; i++) { // Insertion sort, a few squares at most
+        int j = i;
+        for (; j > 0 && sorted[j - 1] > taken[i]; j--) sorted[j] = sorted[j - 1];
+        sorted[j] = taken[i];
+    }
+    for (int i = 0; i < count; i++) if (sorted[i] <= n) n++; // Every taken square at or below it pushes it one square on
+    return n;
+}
+
+// ### Index of a position in a table; squares are strong king, weak king, then the pieces in definition order ###
+// All symmetric copies of a position get the same index (the smallest one), so every position is solved once.
+// Returns -1 for pieces on one square, touching kings or a pawn on the first or last row.
+int egtIndex(const T_EgtDefinition* def, int stm, const int squares[]) {
+    int pieces = 2 + def->count;
+    for (int i = 0; i < pieces; i++)
+        for (int j = 0; j < i; j++) if (squares[i] == squares[j]) return -1;
+    int best = -1;
+    for (int t = 0; t < (def->pawns ? 2 : 8); t++) { // Only the left-right mirror keeps pawns walking the same way
+        int sq[2 + EGT_MAX_PIECES] = { 0 };
+        for (int i = 0; i < pieces; i++) sq[i] = egtTransform(squares[i], t);
+        int idx;
+        if (def->pawns) {
+            if (sq[2] % 8 > 3) continue; // The copy with the pawn on files a-d
+            if (sq[2] / 8 < 1 || sq[2] / 8 > 6) return -1;
+            int taken[2] = { sq[2], sq[0] };
+            idx = ((stm * 24 + (sq[2] / 8 - 1) * 4 + sq[2] % 8) * 63 + egtSkip(sq[0], taken, 1)) * 62 + egtSkip(sq[1], taken, 2);
+        } else {
+            int file = sq[0] % 8, rank = 7 - sq[0] / 8;
+            if (file > 3 || rank > file) continue; // The copy with the strong king in the a1-d1-d4 triangle
+            int pair = egtKingPair[file * (file + 1) / 2 + rank][sq[1]];
+            if (pair < 0) continue; // Touching kings, or the weak king on the wrong side of the diagonal
+            idx = stm * EGT_KING_PAIRS + pair;
+            for (int i = 0; i < def->count; i++) idx = idx * (62 - i) + egtSkip(sq[2 + i], sq, 2 + i);
+        }
+        if (best < 0 || idx < best) best = idx;
+    }
+    return best;
+}
+
+// ### Squares and side to move of the position at an index (the reverse of egtIndex, without checking anything) ###
+void egtSquares(const T_EgtDefinition* def, int idx, int* stm, int squares[]) {
+    if (def->pawns) {
+        int wk = idx % 62; idx /= 62;
+        int sk = idx % 63; idx /= 63;
+        int slot = idx % 24; idx /= 24;
+        squares[2] = (slot / 4 + 1) * 8 + slot % 4;
+        int taken[2] = { squares[2], 0 };
+        squares[0] = taken[1] = egtUnskip(sk, taken, 1);
+        squares[1] = egtUnskip(wk, taken, 2);
+    } else {
+        int numbers[EGT_MAX_PIECES];
+        for (int i = def->count - 1; i >= 0; i--) { numbers[i] = idx % (62 - i); idx /= 62 - i; }
+        int pair = idx % EGT_KING_PAIRS;
+        idx /= EGT_KING_PAIRS;
+        squares[0] = egtKingPairSquares[pair][0];
+        squares[1] = egtKingPairSquares[pair][1];
+        for (int i = 0; i < def->count; i++) squares[2 + i] = egtUnskip(numbers[i], squares, 2 + i);
+    }
+    *stm = idx;
+}
+
+// ### Put a table position on an empty board, the strong side as white ###
+void egtBoard(const T_EgtDefinition* def, const int squares[], int board[8][8]) {
+    memset(board, 0, 64 * sizeof(int));
+    board[squares[0] / 8][squares[0] % 8] = 2;
+    board[squares[1] / 8][squares[1] % 8] = 12;
+    for (int i = 0; i < def->count; i++) board[squares[2 + i] / 8][squares[2 + i] % 8] = def->pieces[i];
+}
+
+// ### Change one working value from expected to value unless another worker changed it first; true if this call did ###
+// Values are bytes, so the compare-exchange works on the aligned 32-bit word around the byte
+bool egtClaim(volatile unsigned char* values, int idx, unsigned char expected, unsigned char value) {
+    if (values[idx] != expected) return false; // Most positions are solved already, no need for a locked instruction
+    volatile LONG* word = (volatile LONG*)(values + (idx & ~3));
+    int shift = (idx & 3) * 8; // x86 is little-endian: byte 0 is the lowest
+    for (;;) {
+        LONG old = *word;
+        if ((unsigned char)((unsigned long)old >> shift) != expected) return false;
+        LONG updated = (LONG)(((unsigned long)old & ~(0xFFul << shift)) | ((unsigned long)value << shift));
+        if (InterlockedCompareExchange(word, updated, old) == old) return true; // Otherwise a neighbouring byte changed, try again
+    }
+}
+
+// ### Worker thread: run one pass of the table generator over its index range ###
+// Positions lost at a ply are only ever reached by pushing from them (strong side) or pulling into them (weak side),
+// so workers never write the same value twice: strong values are set with a compare-exchange, weak ones only by their owner.
+DWORD WINAPI egtWorker(LPVOID param) {
+    T_EgtWorker* worker = (T_EgtWorker*)param;
+    T_EgtBuild* build = worker->build;
+    const T_EgtDefinition* def = build->def;
+    int pieces = 2 + def->count, ply = worker->ply;
+    // The rules functions read these: there is no castling and no en passant in the tables
+    whiteKingMoved = blackKingMoved = true;
+    whiteKingsideRookMoved = whiteQueensideRookMoved = blackKingsideRookMoved = blackQueensideRookMoved = true;
+    enPassantCol = -1;
+    T_Move moves[256];
+    for (int idx = worker->begin; idx < worker->end; idx++) {
+        int stm = idx >= build->positions / 2, squares[2 + EGT_MAX_PIECES], b[8][8]; // The side to move is the top index digit
+        // Most positions have nothing to do in a pass, they are only decoded when they do
+        if (worker->phase == EGT_PHASE_STRONG && (stm == 0 ? build->aux[idx] != ply + 2 : build->values[idx] != ply + 1)) continue;
+        if (worker->phase == EGT_PHASE_WEAK && (stm != 1 || build->values[idx] != 0)) continue;
+        egtSquares(def, idx, &stm, squares);
+
+        if (worker->phase == EGT_PHASE_INIT) {
+            build->values[idx] = EGT_INVALID;
+            build->aux[idx] = 0;
+            if (egtIndex(def, stm, squares) != idx) continue;
+            egtBoard(def, squares, b);
+            if (isInCheck(b, 1 - stm)) continue; // The side that just moved cannot be in check
+            build->values[idx] = 0;
+            if (stm == 1) { // Weak side: mate, stalemate, a capture that leaves a drawn ending, or the king moves to follow later
+                int count = generateLegalMoves(b, 1, -1, -1, moves);
+                if (!count) build->values[idx] = isInCheck(b, 1) ? 1 : EGT_DRAW;
+                for (int i = 0; i < count; i++) {
+                    if (b[moves[i].toRow][moves[i].toCol]) { build->values[idx] = EGT_DRAW; break; }
+                    for (int d = 0; d < 8; d++)
+                        if (moves[i].toRow - moves[i].fromRow == egtKingSteps[d][0] && moves[i].toCol - moves[i].fromCol == egtKingSteps[d][1])
+                            build->aux[idx] |= 1 << d;
+                }
+            } else if (def->pawns) { // Promotions go into KQK or KRK, which are finished already
+                int count = generateLegalMoves(b, 0, -1, -1, moves);
+                for (int i = 0; i < count; i++) {
+                    if (moves[i].promotion != 3 && moves[i].promotion != 4) continue; // A bishop or a knight alone cannot mate
+                    int after[3] = { squares[0], squares[1], moves[i].toRow * 8 + moves[i].toCol };
+                    int value = build->converted[moves[i].promotion - 3][egtIndex(&egtDefinitions[moves[i].promotion - 3], 1, after)];
+                    if (value && (!build->aux[idx] || value + 1 < build->aux[idx])) build->aux[idx] = (unsigned char)(value + 1);
+                }
+                if (build->aux[idx] > worker->longest) worker->longest = build->aux[idx];
+            }
+
+        } else if (worker->phase == EGT_PHASE_STRONG) {
+            if (stm == 0) { // A promotion that mates in ply + 1 plies
+                if (egtClaim(build->values, idx, 0, (unsigned char)(ply + 2))) worker->changed++;
+                continue;
+            }
+            // Take back every strong move that could have led here; the positions before it win in ply + 1
+            egtBoard(def, squares, b);
+            for (int i = 0; i < pieces; i++) {
+                if (i == 1) continue; // The weak king did not move last
+                int s = squares[i], piece = b[s / 8][s % 8];
+                for (int t = 0; t < 64; t++) {
+                    if (b[t / 8][t % 8]) continue;
+                    if (piece == 1 && t != s + 8 && !(t == s + 16 && s / 8 == 4 && !b[s / 8 + 1][s % 8])) continue; // One or two rows back
+                    b[t / 8][t % 8] = piece;
+                    b[s / 8][s % 8] = 0;
+                    bool legal = isLegalMove(b, t / 8, t % 8, s / 8, s % 8, 0) && !isInCheck(b, 1);
+                    b[s / 8][s % 8] = piece;
+                    b[t / 8][t % 8] = 0;
+                    if (!legal) continue;
+                    int before[2 + EGT_MAX_PIECES];
+                    memcpy(before, squares, sizeof(before));
+                    before[i] = t;
+                    int from = egtIndex(def, 0, before);
+                    if (from >= 0 && egtClaim(build->values, from, 0, (unsigned char)(ply + 2))) worker->changed++;
+                }
+            }
+
+        } else { // EGT_PHASE_WEAK: lost once every king move reaches a won position, one ply later than the slowest of them
+            int slowest = 0;
+            for (int d = 0; d < 8; d++) {
+                if (!((build->aux[idx] >> d) & 1)) continue;
+                int after[2 + EGT_MAX_PIECES];
+                memcpy(after, squares, sizeof(after));
+                after[1] += egtKingSteps[d][0] * 8 + egtKingSteps[d][1];
+                int value = build->values[egtIndex(def, 0, after)];
+                if (value == 0 || value >= EGT_DRAW) { slowest = 0; break; } // This move still holds
+                if (value > slowest) slowest = value;
+            }
+            if (slowest) { build->values[idx] = (unsigned char)(slowest + 1); worker->changed++; }
+        }
+    }
+    return 0;
+}
+
+// ### Run one pass of the table generator on all workers, each over its own index range; returns the positions solved ###
+long egtRunPass(T_EgtBuild* build, int phase, int ply, int threads, int* longest) {
+    T_EgtWorker workers[PGN_MAX_THREADS];
+    HANDLE handles[PGN_MAX_THREADS];
+    for (int i = 0; i < threads; i++) {
+        workers[i].build = build;
+        workers[i].phase = phase;
+        workers[i].ply = ply;
+        workers[i].begin = (int)((long long)build->positions * i / threads);
+        workers[i].end = (int)((long long)build->positions * (i + 1) / threads);
+        workers[i].changed = 0;
+        workers[i].longest = 0;
+        handles[i] = CreateThread(NULL, 0, egtWorker, &workers[i], 0, NULL);
+    }
+    long changed = 0;
+    for (int i = 0; i < threads; i++) {
+        WaitForSingleObject(handles[i], INFINITE);
+        CloseHandle(handles[i]);
+        changed += workers[i].changed;
+        if (longest && workers[i].longest > *longest) *longest = workers[i].longest;
+    }
+    return changed;
+}
+
+// ### Generate one endgame table by retrograde analysis ###
+// Starts from the mates and walks back one ply at a time until nothing changes. Returns one byte per position
+// (plies to mate + 1, 0 = draw or impossible) and the largest of them in longest, or NULL without memory.
+unsigned char* egtBuildTable(const T_EgtDefinition* def, const unsigned char* converted[2], int threads, int* longest) {
+    egtInitKings();
+    T_EgtBuild build;
+    build.def = def;
+    build.positions = egtPositions(def);
+    build.values = malloc((build.positions + 3) & ~3); // Whole 32-bit words, egtClaim swaps four bytes at a time
+    build.aux = malloc(build.positions);
+    build.converted[0] = converted ? converted[0] : NULL;
+    build.converted[1] = converted ? converted[1] : NULL;
+    if (!build.values || !build.aux) {
+        printf("Not enough memory for the %s table\n", def->name);
+        free((void*)build.values);
+        free(build.aux);
+        return NULL;
+    }
+    int promotions = 0; // Highest value a promotion gives, the passes must get that far
+    egtRunPass(&build, EGT_PHASE_INIT, 0, threads, &promotions);
+    // Positions lost in ply plies make the ones before them won in ply + 1, then weak positions with only such moves are lost
+    for (int ply = 0; ply + 3 < EGT_DRAW; ply += 2) {
+        long changed = egtRunPass(&build, EGT_PHASE_STRONG, ply, threads, NULL);
+        changed += egtRunPass(&build, EGT_PHASE_WEAK, ply + 1, threads, NULL);
+        if (!changed && ply + 2 >= promotions) break;
+    }
+    free(build.aux);
+    unsigned char* result = (unsigned char*)build.values; // The working values become the result in place
+    *longest = 0;
+    for (int idx = 0; idx < build.positions; idx++) { // Whatever was never solved cannot be forced, so it is a draw
+        if (result[idx] >= EGT_DRAW) result[idx] = 0;
+        if (result[idx] > *longest) *longest = result[idx];
+    }
+    return result;
+}
+
+// ### Generate all endgame tables and write them bit-packed into one file (main.exe --build-egt endgame.egt [--threads N]) ###
+// A table that cannot be built (not enough memory) is left out, the others are still written
+int buildEndgameTables(const char* filename, int threads) {
+    if (threads <= 0) {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        threads = (int)info.dwNumberOfProcessors;
+    }
+    if (threads > PGN_MAX_THREADS) threads = PGN_MAX_THREADS;
+    T_EgtHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, EGT_MAGIC, 8);
+    unsigned char* tables[EGT_TABLES] = { NULL };
+    unsigned char* packed[EGT_TABLES] = { NULL };
+    unsigned int offset = sizeof(header);
+    DWORD start = GetTickCount();
+    for (int t = 0; t < EGT_TABLES; t++) {
+        const T_EgtDefinition* def = &egtDefinitions[t];
+        if (def->pawns && (!tables[0] || !tables[1])) { printf("%s is left out, it needs KQK and KRK\n", def->name); continue; }
+        DWORD tableStart = GetTickCount();
+        const unsigned char* converted[2] = { tables[0], tables[1] };
+        int longest = 0, bits = 1;
+        tables[t] = egtBuildTable(def, converted, threads, &longest);
+        if (!tables[t]) { printf("%s is left out\n", def->name); continue; }
+        while ((1 << bits) <= longest) bits++;
+        T_EgtEntry* entry = &header.entries[header.count];
+        strcpy(entry->name, def->name);
+        entry->positions = (unsigned int)egtPositions(def);
+        entry->bits = (unsigned int)bits;
+        entry->offset = offset;
+        entry->size = (unsigned int)(((unsigned long long)entry->positions * bits + 7) / 8 + 1); // A spare byte, reads take two bytes at a time
+        packed[header.count] = calloc(entry->size, 1);
+        if (!packed[header.count]) { printf("Not enough memory to pack the %s table, it is left out\n", def->name); continue; }
+        unsigned char* out = packed[header.count++];
+        for (unsigned int idx = 0; idx < entry->positions; idx++) { // Lowest bits first
+            unsigned long long bit = (unsigned long long)idx * bits;
+            unsigned int value = (unsigned int)tables[t][idx] << (bit & 7);
+            out[bit >> 3] |= (unsigned char)value;
+            out[(bit >> 3) + 1] |= (unsigned char)(value >> 8);
+        }
+        offset += entry->size;
+        printf("%s: %u positions, longest mate %d plies, %d bits each, %lu ms\n",
+               def->name, entry->positions, longest - 1, bits, (unsigned long)(GetTickCount() - tableStart));
+    }
+
+    bool ok = header.count > 0;
+    FILE* file = ok ? fopen(filename, "wb") : NULL;
+    if (ok && !file) { printf("Cannot create %s\n", filename); ok = false; }
+    if (file) {
+        ok = fwrite(&header, sizeof(header), 1, file) == 1;
+        for (unsigned int i = 0; i < header.count && ok; i++) ok = fwrite(packed[i], 1, header.entries[i].size, file) == header.entries[i].size;
+        if (fclose(file) != 0) ok = false;
+        if (!ok) { printf("Could not write %s\n", filename); remove(filename); }
+    }
+    for (int t = 0; t < EGT_TABLES; t++) { free(tables[t]); free(packed[t]); }
+    if (!ok) return 1;
+    printf("Wrote %s (%u bytes, %u tables) with %d threads in %lu ms\n", filename, offset, header.count, threads, (unsigned long)(GetTickCount() - start));
+    return header.count == EGT_TABLES ? 0 : 1;
+}
+
+// ### Map the endgame table file at startup; without it (or with a damaged one) the game simply has no tables ###
+bool egtOpen(const char* filename) {
+    egtInitKings(); // Probes index the tables
+    size_t size = 0;
+    const unsigned char* data = mapFile(filename, &size);
+    memset(egtEntries, 0, sizeof(egtEntries));
+    if (!data) return false;
+    const T_EgtHeader* header = (const T_EgtHeader*)data;
+    bool ok = size >= sizeof(T_EgtHeader) && memcmp(header->magic, EGT_MAGIC, 8) == 0 && header->count <= EGT_TABLES;
+    for (unsigned int i = 0; ok && i < header->count; i++) {
+        const T_EgtEntry* entry = &header->entries[i];
+        int t = 0;
+        while (t < EGT_TABLES && strncmp(entry->name, egtDefinitions[t].name, sizeof(entry->name)) != 0) t++;
+        ok = t < EGT_TABLES && entry->positions == (unsigned int)egtPositions(&egtDefinitions[t]) && entry->bits >= 1 && entry->bits <= 8 &&
+             entry->offset <= size && entry->size <= size - entry->offset &&
+             entry->size >= ((unsigned long long)entry->positions * entry->bits + 7) / 8 + 1;
+        if (ok) egtEntries[t] = entry;
+    }
+    if (!ok) {
+        printf("%s is not a valid endgame table file, it was not loaded\n", filename);
+        memset(egtEntries, 0, sizeof(egtEntries));
+        unmapFile(data);
+        return false;
+    }
+    egtData = data;
+    printf("Endgame tables %s:", filename);
+    for (int t = 0; t < EGT_TABLES; t++) if (egtEntries[t]) printf(" %s", egtDefinitions[t].name);
+    printf("\n");
+    return true;
+}
+
+// ### Read the value of one position from a mapped table (values never straddle more than two bytes) ###
+int egtReadValue(const T_EgtEntry* entry, int idx) {
+    const unsigned char* data = egtData + entry->offset;
+    unsigned long long bit = (unsigned long long)idx * entry->bits;
+    unsigned int word = data[bit >> 3] | (unsigned int)data[(bit >> 3) + 1] << 8;
+    return (int)((word >> (bit & 7)) & ((1u << entry->bits) - 1));
+}
+
+// ### Look the position up in the endgame tables ###
+// Returns -2 if no loaded table covers it, -1 if it is a draw, otherwise the plies until mate; winner gets the color that mates
+int probeEndgameTable(int board[8][8], int player, int* winner) {
+    int kings[2] = { -1, -1 }, counts[2] = { 0, 0 }, pieces[2][EGT_MAX_PIECES], squares[2][EGT_MAX_PIECES];
+    for (int sq = 0; sq < 64; sq++) {
+        int val = board[sq / 8][sq % 8];
+        if (!val) continue;
+        if (val % 10 == 2) { kings[val / 10] = sq; continue; }
+        if (counts[val / 10] == EGT_MAX_PIECES) return -2; // Too many pieces for the tables
+        pieces[val / 10][counts[val / 10]] = val % 10;
+        squares[val / 10][counts[val / 10]++] = sq;
+    }
+    int strong = counts[0] ? 0 : 1;
+    if (kings[0] < 0 || kings[1] < 0 || !counts[strong] || counts[1 - strong]) return -2; // One side must have only its king
+    int flip = strong ? 56 : 0; // A black strong side is turned into white by turning the board upside down
+    for (int t = 0; t < EGT_TABLES; t++) {
+        const T_EgtDefinition* def = &egtDefinitions[t];
+        if (!egtEntries[t] || def->count != counts[strong]) continue;
+        int sq[2 + EGT_MAX_PIECES] = { kings[strong] ^ flip, kings[1 - strong] ^ flip };
+        int used = 0, matched = 0;
+        for (int i = 0; i < def->count; i++)
+            for (int j = 0; j < counts[strong]; j++)
+                if (!((used >> j) & 1) && pieces[strong][j] == def->pieces[i]) {
+                    sq[2 + i] = squares[strong][j] ^ flip;
+                    used |= 1 << j;
+                    matched++;
+                    break;
+                }
+        if (matched != def->count) continue;
+        int idx = egtIndex(def, player == strong ? 0 : 1, sq);
+        if (idx < 0) return -2;
+        int value = egtReadValue(egtEntries[t], idx);
+        if (!value) return -1; // The weak side can hold (stalemate, or it wins a piece)
+        *winner = strong;
+        return value - 1;
+    }
+    return -2;
+}
+
+// ### Build the king and pawn against king bitbase into table (KPK_POSITIONS / 4 bytes) ###
+// It is the win/draw part of the KPK endgame table, so it comes from the same generator (which needs KQK and KRK for the promotions).
+// The pawn side is always white with the pawn walking up the board (towards row 0).
+bool buildKPKBitbase(unsigned char* table, int threads) {
+    int longest;
+    unsigned char* kqk = egtBuildTable(&egtDefinitions[0], NULL, threads, &longest);
+    unsigned char* krk = kqk ? egtBuildTable(&egtDefinitions[1], NULL, threads, &longest) : NULL;
+    const unsigned char* converted[2] = { kqk, krk };
+    unsigned char* kpk = krk ? egtBuildTable(&egtDefinitions[2], converted, threads, &longest) : NULL;
+    if (kpk) {
+        whiteKingMoved = blackKingMoved = true; // No castling for isInCheck to think about
+        memset(table, 0, KPK_POSITIONS / 4);
+        for (int idx = 0; idx < KPK_POSITIONS; idx++) {
+            int stm = idx / (64 * 64 * 48), wk = idx / (64 * 48) % 64, bk = idx / 48 % 64, psq = idx % 48 + 8;
+            int squares[3] = { wk, bk, psq }, b[8][8];
+            int result = KPK_INVALID; // Overlapping pieces, touching kings, or the side that just moved is in check
+            int tableIndex = egtIndex(&egtDefinitions[2], stm, squares);
+            if (tableIndex >= 0) {
+                egtBoard(&egtDefinitions[2], squares, b);
+                if (!isInCheck(b, 1 - stm)) result = kpk[tableIndex] ? KPK_WIN : KPK_DRAW;
+            }
+            kpkSet(table, idx, result);
+        }
+    }
+    free(kqk);
+    free(krk);
+    free(kpk);
+    return kpk != NULL;
+}
+
+// ### Generate the KPK bitbase and write it as the C header that is compiled in (main.exe --write-kpk kpk_bitbase.h) ###
+int writeKPKBitbase(const char* filename, int threads) {
+    DWORD start = GetTickCount();
+    unsigned char* table = malloc(KPK_POSITIONS / 4);
+    if (!table) { printf("Out of memory\n"); return 1; }
+    if (threads <= 0) {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        threads = (int)info.dwNumberOfProcessors;
+    }
+    if (threads > PGN_MAX_THREADS) threads = PGN_MAX_THREADS;
+    if (!buildKPKBitbase(table, threads)) { free(table); return 1; }
+    FILE* file = fopen(filename, "w");
+    if (!file) { printf("Cannot create %s\n", filename); free(table); return 1; }
+    fprintf(file, "// King and pawn against king bitbase, written by main.exe --write-kpk %s (do not edit)\n", filename);
+    fprintf(file, "// 2 bits per position in KPK_INDEX order, lowest bits first: 0 unknown, 1 draw, 2 win, 3 invalid\n");
+    fprintf(file, "static const unsigned char kpkBitbase[KPK_POSITIONS / 4] = {\n");
+    for (int i = 0; i < KPK_POSITIONS / 4; i++)
+        fprintf(file, "%u%s", table[i], i + 1 == KPK_POSITIONS / 4 ? "\n" : (i + 1) % 32 ? "," : ",\n");
+    fprintf(file, "};\n");
+    bool ok = fclose(file) == 0;
+    free(table);
+    if (!ok) { printf("Could not write %s\n", filename); remove(filename); return 1; }
+    printf("Wrote KPK bitbase (%d bytes) to %s in %lu ms\n", KPK_POSITIONS / 4, filename, (unsigned long)(GetTickCount() - start));
+    return 0;
+}
+
+// ### Look a king and pawn against king position up in the bitbase ###
+// Returns -2 if the position is not KPK, 0 if it is a draw, 1 if the pawn side wins; winner gets the pawn side color
+int probeKPK(int board[8][8], int player, int* winner) {
+    int count = 0, pawnColor = -1, psq = -1;
+    int kings[2] = {-1, -1};
+    for (int i = 0; i < 8; i++)
+        for (int j = 0; j < 8; j++) {
+            int val = board[i][j];
+            if (!val) continue;
+            if (++count > 3) return -2;
+            if (val % 10 == 2) kings[val / 10] = i * 8 + j;
+            else if (val % 10 == 1) { pawnColor = val / 10; psq = i * 8 + j; }
+            else return -2;
+        }
+    if (count != 3 || pawnColor == -1) return -2;
+    int wk = kings[pawnColor], bk = kings[1 - pawnColor];
+    if (pawnColor == 1) { // Black pawn: flip the board upside down so the pawn walks up like a white one
+        wk ^= 56; bk ^= 56; psq ^= 56;
+    }
+    if (psq < 8 || psq >= 56) return -2; // A pawn on the first or last rank is not in the bitbase (KPK_INDEX starts at row 1)
+    *winner = pawnColor;
+    return kpkGet(kpkBitbase, KPK_INDEX(player == pawnColor ? 0 : 1, wk, bk, psq)) == KPK_WIN ? 1 : 0;
+}
+
+// ### Read the 2-bit entry of a bitbase position ###
+int kpkGet(const unsigned char* table, int idx) {
+    return (table[idx >> 2] >> ((idx & 3) * 2)) & 3;
+}
+
+// ### Write the 2-bit entry of a bitbase position ###
+void kpkSet(unsigned char* table, int idx, int value) {
+    table[idx >> 2] = (unsigned char)((table[idx >> 2] & ~(3 << ((idx & 3) * 2))) | (value << ((idx & 3) * 2)));
+}
+
+// ### Memory-map a whole file read-only ###
+// Returns NULL if the file does not exist; size gets the file length
+const unsigned char* mapFile(const char* filename, size_t* size) {
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return NULL;
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(file, &length) || length.QuadPart == 0) { CloseHandle(file); return NULL; }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file); // The mapping keeps the file open
+    if (!mapping) return NULL;
+    const unsigned char* data = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping); // The view keeps the mapping alive
+    if (!data) return NULL;
+    *size = (size_t)length.QuadPart;
+    return data;
+}
+
+// ### Release a view created by mapFile ###
+void unmapFile(const unsigned char* data) {
+    if (data) UnmapViewOfFile(data);
+}
+
+// ### Open the opening book, if there is one next to the executable ###
+bool bookOpen(const char* filename) {
+    size_t size = 0;
+    bookData = mapFile(filename, &size);
+    bookEntries = bookData ? size / 16 : 0; // Every Polyglot entry is 16 bytes
+    if (bookData) printf("Opening book %s: %lu entries\n", filename, (unsigned long)bookEntries);
+    return bookData != NULL;
+}
+
+// ### Read a big-endian number of n bytes (Polyglot stores everything big-endian) ###
+unsigned long long bookRead(const unsigned char* p, int n) {
+    unsigned long long value = 0;
+    for (int i = 0; i < n; i++) value = (value << 8) | p[i];
+    return value;
+}
+
+// ### Find every book move for a position ###
+// Binary search for the first entry with the key, then read the run of equal keys straight from the mapped file
+int bookProbe(int board[8][8], unsigned long long key, T_BookMove moves[], int maxMoves) {
+    size_t lo = 0, hi = bookEntries;
+    while (lo < hi) { // Lower bound: first entry whose key is not smaller than ours
+        size_t mid = lo + (hi - lo) / 2;
+        if (bookRead(bookData + mid * 16, 8) < key) lo = mid + 1;
+        else hi = mid;
+    }
+    int count = 0;
+    for (size_t i = lo; i < bookEntries && count < maxMoves && bookRead(bookData + i * 16, 8) == key; i++) {
+        const unsigned char* entry = bookData + i * 16;
+        int move = (int)bookRead(entry + 8, 2), weight = (int)bookRead(entry + 10, 2);
+        // Polyglot move bits: to file (0-2), to rank (3-5), from file (6-8), from rank (9-11), promotion (12-14); rank 0 is our row 7
+        T_BookMove m = { 7 - ((move >> 9) & 7), (move >> 6) & 7, 7 - ((move >> 3) & 7), move & 7, weight };
+        // Castling is stored as the king capturing its own rook, turn it into the two-square king move the GUI uses
+        int king = board[m.fromRow][m.fromCol], rook = board[m.toRow][m.toCol];
+        if (king % 10 == 2 && rook % 10 == 4 && king / 10 == rook / 10)
+            m.toCol = m.toCol > m.fromCol ? 6 : 2;
+        moves[count++] = m;
+    }
+    return count;
+}
+
+// ### Pick one book move at random, weighted by how often it was played ###
+bool bookPickMove(T_BookMove moves[], int count, T_BookMove* picked) {
+    int total = 0;
+    for (int i = 0; i < count; i++) total += moves[i].weight;
+    if (count == 0 || total == 0) return false;
+    int r = rand() % total; // Land somewhere in the summed weights
+    for (int i = 0; i < count; i++) {
+        if (r < moves[i].weight) { *picked = moves[i]; return true; }
+        r -= moves[i].weight;
+    }
+    return false;
+}
+
+// ### Refresh the book moves highlighted by the opening trainer ###
+void updateBookHints(void) {
+    bookHintCount = 0;
+    if (!trainerMode || !bookData) return;
+    bookHintCount = bookProbe(board, polyglotHash(board, currentPlayer), bookHints, 32);
+}
+
+// ### Main function: initializes everything and starts the game loop ###
+int main(int argc, char **argv) {
+    // Headless tools run before any window is created
+    int threads = 0; // 0 = one worker thread per core
+    long long nodeBudget = 0; // Nodes per EPD position or per self-play move, 0 = the tool's default
+    DWORD moveTime = 5000; // Search time per EPD bm/am position in milliseconds
+    int games = 100; // Self-play games
+    int squareSize = 0; // Square size of rendered diagrams, 0 = DIAGRAM_SQUARE
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0) threads = atoi(argv[i + 1]);
+        if (strcmp(argv[i], "--nodes") == 0) nodeBudget = atoll(argv[i + 1]);
+        if (strcmp(argv[i], "--movetime") == 0) moveTime = (DWORD)atol(argv[i + 1]);
+        if (strcmp(argv[i], "--games") == 0) games = atoi(argv[i + 1]);
+        if (strcmp(argv[i], "--square") == 0) squareSize = atoi(argv[i + 1]);
+        if (strcmp(argv[i], "--evalcache") == 0) evalCacheEntries = (unsigned int)atol(argv[i + 1]);
+    }
+    if (evalCacheEntries < 1) evalCacheEntries = 1;
+    if (evalCacheEntries > (1u << 26)) evalCacheEntries = 1u << 26; // 1 GB per thread at most
+    while (evalCacheEntries & (evalCacheEntries - 1)) evalCacheEntries &= evalCacheEntries - 1; // Round down to a power of two
+    for (int i = 1; i + 1 < argc; i++)
+        if (strcmp(argv[i], "--pgn") == 0) return replayPgnFile(argv[i + 1], threads);
+        else if (strcmp(argv[i], "--bin") == 0) return replayBinaryFile(argv[i + 1]);
+        else if (strcmp(argv[i], "--pgn2bin") == 0 && i + 2 < argc) return convertPgnToBinary(argv[i + 1], argv[i + 2]);
+        else if (strcmp(argv[i], "--build-db") == 0 && i + 2 < argc) { zobristInit(); return buildPositionDatabase(argv[i + 1], argv[i + 2]); }
+        else if (strcmp(argv[i], "--make-book") == 0 && i + 2 < argc) return databaseToBook(argv[i + 1], argv[i + 2], 2);
+        else if (strcmp(argv[i], "--pack") == 0 && i + 2 < argc) return packGamesToShards(argv[i + 1], argv[i + 2]);
+        else if (strcmp(argv[i], "--pack-assets") == 0) return packAssets(argv[i + 1]);
+        else if (strcmp(argv[i], "--render-fens") == 0 && i + 2 < argc) return renderFenFile(argv[i + 1], argv[i + 2], squareSize, threads);
+        else if (strcmp(argv[i], "--write-kpk") == 0) return writeKPKBitbase(argv[i + 1], threads);
+        else if (strcmp(argv[i], "--build-egt") == 0) return buildEndgameTables(argv[i + 1], threads);
+        else if (strcmp(argv[i], "--epd") == 0) return runEpdSuite(argv[i + 1], threads, nodeBudget ? nodeBudget : 50000000, moveTime);
+        else if (strcmp(argv[i], "--selfplay") == 0) return runSelfPlay(argv[i + 1], games, nodeBudget ? nodeBudget : 2000, threads);
+
+    QueryPerformanceFrequency(&counterFrequency);
+    QueryPerformanceCounter(&startupCounter); // Startup timing begins here
+    glutInit(&argc, argv); // Initialize GLUT
+    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA); // Double buffering, RGBA color
+    glutInitWindowSize(LOGICAL_SIZE, LOGICAL_SIZE); // Initial window size, the window can be resized
+    glutCreateWindow("Chess Game"); // Create window with title
+    glewInit(); // Initialize GLEW (must be after window creation)
+
+    // Enable alpha blending for PNG transparency, to show only the chess piece without a background
+    glEnable(GL_BLEND); // Enable blending for transparency
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); // Set blending function for transparency
+
+    // Matching the coordinates of the mouse and input drawing to the chessboard
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f); // Set background color to black
+    glMatrixMode(GL_PROJECTION); // Set projection matrix
+    glLoadIdentity(); // Load identity matrix to reset projection
+    gluOrtho2D(0, LOGICAL_SIZE, LOGICAL_SIZE, 0); // Set orthographic projection (top-left origin), reshape fits it into the window
+    
+    glutReshapeFunc(reshape); // Set reshape callback
+    frameIntervalMs = refreshIntervalMs(); // Pace of the move animations
+
+    PlaySound("sound.wav", NULL, SND_FILENAME | SND_ASYNC | SND_LOOP); // Play background music
+
+    // Textures: the window opens with grey placeholders while worker threads decode the images, which appear as they are uploaded
+    if (bundleOpen("assets.bin")) printf("Textures come from assets.bin\n"); // Pre-decoded images, made with --pack-assets
+    static const unsigned char grey[4] = { 60, 60, 60, 255 };
+    menuBackgroundTex = theCreatorTex = createTexture(grey, 1, 1);
+    initPieceRenderer(); // Instanced piece drawing, if the driver supports it
+    initTextRenderer(); // Font atlases for all text on the screens
+    startImageLoading();
+    uploadLoadedImages(); // With a bundle everything is ready right away
+    if (!loadingImages[0].uploaded || !loadingImages[ASSET_COUNT - 1].uploaded) glutIdleFunc(uploadLoadedImages);
 
     boardInitializer(board); // Set up the initial board
+    // main.exe --fen "<position>" starts from any position instead of the initial one
+    for (int i = 1; i + 1 < argc; i++)
+        if (strcmp(argv[i], "--fen") == 0) {
+            if (loadFEN(argv[i + 1])) starter = currentPlayer;
+            else printf("Invalid FEN: %s\n", argv[i + 1]);
+        }
+    zobristInit(); // Prepare the hash keys used by the move cache
+    srand((unsigned)time(NULL)); // Seed the random book move picks
+    bookOpen("book.bin"); // Optional opening book, the game works without it
+    databaseOpen("positions.db"); // Optional position database for the explorer panel
+    egtOpen("endgame.egt"); // Optional endgame tables, made with --build-egt
+    // Continue the game that was running when the window was last closed, unless a position was given
+    bool fenGiven = false;
+    for (int i = 1; i + 1 < argc; i++) if (strcmp(argv[i], "--fen") == 0) fenGiven = true;
+    if (!fenGiven && snapshotLoad(AUTOSAVE_FILE)) printf("Restored the unfinished game (%d moves).\n", guiGame.count);
+    atexit(printMoveCacheStats); // Report the cache counters when the window is closed
+    atexit(printRenderStats); // Report how much drawing the dirty flags saved
+    atexit(saveGuiGame); // An unfinished game is saved with result "*" when the window is closed
 
     glutDisplayFunc(display); // Set display callback
     glutMouseFunc(mouse);     // Set mouse callback
+    glutKeyboardFunc(keyboard); // Set keyboard callback (copy/paste FEN)
     glutReshapeFunc(reshape); // Set reshape callback
 
     glutMainLoop(); // Start the main event loop